@@ -0,0 +1,434 @@
+//
+//  ImageProcess_bench.cpp
+//  MNN
+//
+//  ImageProcess 预处理吞吐基准（走 C 接口），用于 MNN 升级前后对比：
+//  扫描源格式 x 插值方式 x 边界模式 x 输出类型 x 源尺寸 x 线程数，输出 CSV 或 JSON
+//
+//  编译（在仓库根目录）：
+//    g++ -O2 -std=c++11 -pthread -Imnn -I$MNN_ROOT/include benchmark/ImageProcess_bench.cpp
+//        mnn/*.cpp -L$MNN_ROOT/build -lMNN -o imageprocess_bench
+//
+//  用法：
+//    ./imageprocess_bench [--json] [--min-time 0.2] [--threads 1,2,4] [--sizes 224,1280x720,3840x2160]
+//                         [--dst 224] [--formats RGBA,NV21] [--filters bilinear] [--wraps zero] [--types u8,f32,f16,i8]
+//
+//  指标：
+//    ns_per_call     单线程单次 convert 耗时（各批次中位数）
+//    src_mpix_s      按源像素计的吞吐（MP/s，所有线程合计）
+//    dst_ns_per_pix  每个输出像素耗时
+//    scaling         相对 1 线程的加速比
+//
+
+#include <ImageProcess_c.h>
+#include <Interpreter_c.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct NamedValue {
+    const char* name;
+    int value;
+};
+
+const NamedValue kFormats[] = {
+    {"RGBA", MNN_RGBA}, {"BGR", MNN_BGR}, {"GRAY", MNN_GRAY},
+    {"NV21", MNN_YUV_NV21}, {"NV12", MNN_YUV_NV12}, {"I420", MNN_YUV_I420},
+};
+const NamedValue kFilters[] = {
+    {"nearest", MNN_NEAREST}, {"bilinear", MNN_BILINEAR}, {"bicubic", MNN_BICUBIC},
+};
+const NamedValue kWraps[] = {
+    {"clamp", MNN_CLAMP_TO_EDGE}, {"zero", MNN_ZERO}, {"repeat", MNN_REPEAT},
+};
+// f16 / i8 走 MNN_ImageProcess_convertQuant
+const NamedValue kTypes[] = {
+    {"u8", 0}, {"f32", 1}, {"f16", 2}, {"i8", 3},
+};
+
+struct Size {
+    int w;
+    int h;
+};
+
+struct Options {
+    bool json = false;
+    double minTime = 0.1;               // 每个用例每个线程数的最短测量时间（秒）
+    std::vector<int> threads;
+    std::vector<Size> sizes;
+    std::vector<Size> dsts;
+    std::vector<NamedValue> formats;
+    std::vector<NamedValue> filters;
+    std::vector<NamedValue> wraps;
+    std::vector<NamedValue> types;
+};
+
+struct Case {
+    NamedValue format;
+    NamedValue filter;
+    NamedValue wrap;
+    NamedValue type;
+    Size src;
+    Size dst;
+};
+
+struct Result {
+    int threads;
+    double nsPerCall;
+    double srcMpixPerSec;
+    double dstNsPerPixel;
+    double scaling;
+};
+
+std::vector<std::string> split(const char* s) {
+    std::vector<std::string> out;
+    std::string cur;
+    for (const char* p = s; ; ++p) {
+        if (*p == ',' || *p == '\0') {
+            if (!cur.empty()) {
+                out.push_back(cur);
+            }
+            cur.clear();
+            if (*p == '\0') {
+                break;
+            }
+        } else {
+            cur += *p;
+        }
+    }
+    return out;
+}
+
+// "224" -> 224x224，"1280x720" -> 1280x720
+std::vector<Size> parseSizes(const char* s) {
+    std::vector<Size> out;
+    for (const std::string& item : split(s)) {
+        Size size;
+        if (sscanf(item.c_str(), "%dx%d", &size.w, &size.h) != 2) {
+            size.h = size.w = atoi(item.c_str());
+        }
+        if (size.w > 0 && size.h > 0) {
+            out.push_back(size);
+        }
+    }
+    return out;
+}
+
+template <size_t N>
+std::vector<NamedValue> parseNames(const char* s, const NamedValue (&table)[N]) {
+    std::vector<NamedValue> out;
+    for (const std::string& item : split(s)) {
+        for (size_t i = 0; i < N; ++i) {
+            if (strcasecmp(item.c_str(), table[i].name) == 0) {
+                out.push_back(table[i]);
+            }
+        }
+    }
+    return out;
+}
+
+template <size_t N>
+std::vector<NamedValue> all(const NamedValue (&table)[N]) {
+    return std::vector<NamedValue>(table, table + N);
+}
+
+bool isYUV(int format) {
+    return format == MNN_YUV_NV21 || format == MNN_YUV_NV12 || format == MNN_YUV_I420;
+}
+
+int bytesPerPixel(int format) {
+    switch (format) {
+        case MNN_RGBA:
+        case MNN_BGRA:
+            return 4;
+        case MNN_GRAY:
+            return 1;
+        default:
+            return 3;
+    }
+}
+
+// 每个线程独立的 ImageProcess 与缓冲，避免共享状态干扰测量
+struct Worker {
+    MNN_ImageProcess* process = nullptr;
+    std::vector<uint8_t> source;
+    std::vector<uint8_t> dest;
+    int stride = 0;
+
+    bool init(const Case& c) {
+        MNN_ImageProcess_Config config;
+        config.filterType = static_cast<MNN_Filter>(c.filter.value);
+        config.sourceFormat = static_cast<MNN_ImageFormat>(c.format.value);
+        config.destFormat = MNN_RGB;
+        for (int i = 0; i < 4; ++i) {
+            config.mean[i] = 127.5f;
+            config.normal[i] = 1.0f / 127.5f;
+        }
+        config.wrap = static_cast<MNN_Wrap>(c.wrap.value);
+        process = MNN_ImageProcess_create(&config, nullptr);
+        if (process == nullptr) {
+            return false;
+        }
+        // 轻微的缩放 + 平移，让 ZERO/REPEAT 边界路径真正生效
+        MNN_Matrix9 m = MNN_Matrix9_MakeScaleTranslate((float)c.src.w / c.dst.w * 1.05f, (float)c.src.h / c.dst.h * 1.05f,
+                                                       -0.025f * c.src.w, -0.025f * c.src.h);
+        MNN_ImageProcess_setMatrix9(process, m);
+
+        size_t srcBytes;
+        if (isYUV(c.format.value)) {
+            stride = c.src.w;
+            srcBytes = (size_t)c.src.w * c.src.h * 3 / 2;
+        } else {
+            stride = c.src.w * bytesPerPixel(c.format.value);
+            srcBytes = (size_t)stride * c.src.h;
+        }
+        source.resize(srcBytes);
+        uint32_t seed = 12345;
+        for (size_t i = 0; i < srcBytes; ++i) {
+            seed = seed * 1664525u + 1013904223u;
+            source[i] = (uint8_t)(seed >> 24);
+        }
+        static const size_t kElemSize[] = {1, 4, 2, 1};
+        const size_t elemSize = kElemSize[c.type.value];
+        dest.resize((size_t)c.dst.w * c.dst.h * 3 * elemSize);
+        return true;
+    }
+
+    MNN_ErrorCode run(const Case& c) {
+        halide_type_t type;
+        type.lanes = 1;
+        switch (c.type.value) {
+            case 0:
+                type.code = halide_type_uint;
+                type.bits = 8;
+                break;
+            case 1:
+                type.code = halide_type_float;
+                type.bits = 32;
+                break;
+            case 2:
+                type.code = halide_type_float;
+                type.bits = 16;
+                return MNN_ImageProcess_convertQuant(process, source.data(), c.src.w, c.src.h, stride,
+                                                     dest.data(), c.dst.w, c.dst.h, 3, 0, type, 0.0f, 0);
+            default:
+                type.code = halide_type_int;
+                type.bits = 8;
+                return MNN_ImageProcess_convertQuant(process, source.data(), c.src.w, c.src.h, stride,
+                                                     dest.data(), c.dst.w, c.dst.h, 3, 0, type, 1.0f / 127.0f, 0);
+        }
+        return MNN_ImageProcess_convert_v2(process, source.data(), c.src.w, c.src.h, stride,
+                                           dest.data(), c.dst.w, c.dst.h, 3, 0, type);
+    }
+
+    Worker() = default;
+    Worker(const Worker&) = delete;
+    Worker& operator=(const Worker&) = delete;
+    ~Worker() {
+        MNN_ImageProcess_destroy(process);
+    }
+};
+
+double nowSeconds() {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// 单线程：多批次测量取中位数；多线程：固定时长内统计总调用次数
+bool measure(const Case& c, int threads, double minTime, double* nsPerCall, double* callsPerSec) {
+    std::vector<Worker> workers(threads);
+    for (Worker& w : workers) {
+        if (!w.init(c)) {
+            return false;
+        }
+        if (w.run(c) != MNN_NO_ERROR) {
+            return false;
+        }
+    }
+
+    if (threads == 1) {
+        Worker& w = workers[0];
+        const int kBatches = 7;
+        double t0 = nowSeconds();
+        int calls = 0;
+        while (nowSeconds() - t0 < minTime / kBatches) {
+            w.run(c);
+            ++calls;
+        }
+        std::vector<double> samples;
+        for (int b = 0; b < kBatches; ++b) {
+            double start = nowSeconds();
+            for (int i = 0; i < calls; ++i) {
+                w.run(c);
+            }
+            samples.push_back((nowSeconds() - start) / calls);
+        }
+        std::sort(samples.begin(), samples.end());
+        *nsPerCall = samples[kBatches / 2] * 1e9;
+        *callsPerSec = 1.0 / samples[kBatches / 2];
+        return true;
+    }
+
+    std::atomic<bool> start(false);
+    std::atomic<bool> stop(false);
+    std::vector<long> counts(threads, 0);
+    std::vector<std::thread> pool;
+    for (int t = 0; t < threads; ++t) {
+        pool.emplace_back([&, t]() {
+            while (!start.load()) {
+                std::this_thread::yield();
+            }
+            long n = 0;
+            while (!stop.load(std::memory_order_relaxed)) {
+                workers[t].run(c);
+                ++n;
+            }
+            counts[t] = n;
+        });
+    }
+    double t0 = nowSeconds();
+    start.store(true);
+    std::this_thread::sleep_for(std::chrono::duration<double>(minTime));
+    stop.store(true);
+    for (std::thread& th : pool) {
+        th.join();
+    }
+    double elapsed = nowSeconds() - t0;
+    long total = 0;
+    for (long n : counts) {
+        total += n;
+    }
+    *callsPerSec = total / elapsed;
+    *nsPerCall = elapsed * threads / std::max(1L, total) * 1e9;
+    return true;
+}
+
+void usage(const char* argv0) {
+    fprintf(stderr,
+            "usage: %s [--json] [--min-time sec] [--threads 1,2,4] [--sizes 224,1280x720] [--dst 224]\n"
+            "          [--formats RGBA,BGR,GRAY,NV21,NV12,I420] [--filters nearest,bilinear,bicubic]\n"
+            "          [--wraps clamp,zero,repeat] [--types u8,f32,f16,i8]\n",
+            argv0);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    opt.formats = all(kFormats);
+    opt.filters = all(kFilters);
+    opt.wraps = all(kWraps);
+    opt.types = all(kTypes);
+    opt.sizes = parseSizes("224,640x480,1280x720,1920x1080,3840x2160");
+    opt.dsts = parseSizes("224");
+    int hw = std::max(1, (int)std::thread::hardware_concurrency());
+    for (int t = 1; t < hw; t *= 2) {
+        opt.threads.push_back(t);
+    }
+    opt.threads.push_back(hw);
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+        if (arg == "--json") {
+            opt.json = true;
+            continue;
+        }
+        if (value == nullptr) {
+            usage(argv[0]);
+            return 1;
+        }
+        ++i;
+        if (arg == "--min-time") {
+            opt.minTime = atof(value);
+        } else if (arg == "--threads") {
+            opt.threads.clear();
+            for (const std::string& t : split(value)) {
+                if (atoi(t.c_str()) > 0) {
+                    opt.threads.push_back(atoi(t.c_str()));
+                }
+            }
+        } else if (arg == "--sizes") {
+            opt.sizes = parseSizes(value);
+        } else if (arg == "--dst") {
+            opt.dsts = parseSizes(value);
+        } else if (arg == "--formats") {
+            opt.formats = parseNames(value, kFormats);
+        } else if (arg == "--filters") {
+            opt.filters = parseNames(value, kFilters);
+        } else if (arg == "--wraps") {
+            opt.wraps = parseNames(value, kWraps);
+        } else if (arg == "--types") {
+            opt.types = parseNames(value, kTypes);
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (std::find(opt.threads.begin(), opt.threads.end(), 1) == opt.threads.end()) {
+        opt.threads.insert(opt.threads.begin(), 1);
+    }
+
+    if (opt.json) {
+        printf("{\n  \"mnn_version\": \"%s\",\n  \"hardware_threads\": %d,\n  \"results\": [", MNN_getVersion(), hw);
+    } else {
+        printf("# mnn_version=%s hardware_threads=%d\n", MNN_getVersion(), hw);
+        printf("format,filter,wrap,type,src_w,src_h,dst_w,dst_h,threads,ns_per_call,src_mpix_s,dst_ns_per_pix,scaling\n");
+    }
+
+    bool first = true;
+    for (const Size& src : opt.sizes)
+    for (const Size& dst : opt.dsts)
+    for (const NamedValue& format : opt.formats)
+    for (const NamedValue& filter : opt.filters)
+    for (const NamedValue& wrap : opt.wraps)
+    for (const NamedValue& type : opt.types) {
+        Case c = {format, filter, wrap, type, src, dst};
+        if (isYUV(format.value) && ((src.w & 1) || (src.h & 1))) {
+            continue;
+        }
+        double singleCallsPerSec = 0.0;
+        for (int threads : opt.threads) {
+            double nsPerCall = 0.0;
+            double callsPerSec = 0.0;
+            if (!measure(c, threads, opt.minTime, &nsPerCall, &callsPerSec)) {
+                fprintf(stderr, "skip %s/%s/%s/%s %dx%d: convert failed\n", format.name, filter.name, wrap.name,
+                        type.name, src.w, src.h);
+                break;
+            }
+            if (threads == 1) {
+                singleCallsPerSec = callsPerSec;
+            }
+            Result r;
+            r.threads = threads;
+            r.nsPerCall = nsPerCall;
+            r.srcMpixPerSec = callsPerSec * src.w * src.h / 1e6;
+            r.dstNsPerPixel = nsPerCall / ((double)dst.w * dst.h);
+            r.scaling = singleCallsPerSec > 0.0 ? callsPerSec / singleCallsPerSec : 0.0;
+            if (opt.json) {
+                printf("%s\n    {\"format\": \"%s\", \"filter\": \"%s\", \"wrap\": \"%s\", \"type\": \"%s\", "
+                       "\"src_w\": %d, \"src_h\": %d, \"dst_w\": %d, \"dst_h\": %d, \"threads\": %d, "
+                       "\"ns_per_call\": %.1f, \"src_mpix_s\": %.2f, \"dst_ns_per_pix\": %.3f, \"scaling\": %.2f}",
+                       first ? "" : ",", format.name, filter.name, wrap.name, type.name, src.w, src.h, dst.w, dst.h,
+                       r.threads, r.nsPerCall, r.srcMpixPerSec, r.dstNsPerPixel, r.scaling);
+            } else {
+                printf("%s,%s,%s,%s,%d,%d,%d,%d,%d,%.1f,%.2f,%.3f,%.2f\n", format.name, filter.name, wrap.name,
+                       type.name, src.w, src.h, dst.w, dst.h, r.threads, r.nsPerCall, r.srcMpixPerSec,
+                       r.dstNsPerPixel, r.scaling);
+            }
+            first = false;
+            fflush(stdout);
+        }
+    }
+    if (opt.json) {
+        printf("\n  ]\n}\n");
+    }
+    return 0;
+}
@@ -0,0 +1,611 @@
+//
+//  Interpreter_bench.cpp
+//  MNN
+//
+//  推理吞吐与尾延迟基准（走 C 接口）：
+//  扫描 numThread x 精度 x 内存模式 x 功耗模式 x Session 模式 x 并发数，输出 CSV 或 JSON；
+//  --overhead 单独测量 C 封装相对直接调用 C++ 接口的额外开销
+//
+//  编译（在仓库根目录）：
+//    g++ -O2 -std=c++11 -pthread -Imnn -I$MNN_ROOT/include benchmark/Interpreter_bench.cpp
+//        mnn/*.cpp -L$MNN_ROOT/build -lMNN -o interpreter_bench
+//
+//  用法：
+//    ./interpreter_bench model.mnn [--json] [--input data:1x3x224x224] [--min-time 1] [--warmup 10]
+//                        [--threads 1,4] [--precision normal,low] [--memory normal] [--power normal]
+//                        [--modes default,resize_fix] [--concurrency 1,2,4] [--no-io] [--overhead]
+//
+//  指标：
+//    p50/p90/p99/p999_ms  单次推理延迟分位数（所有并发 Session 的样本合并）
+//    qps                  所有并发 Session 合计的每秒推理次数；同一 Interpreter 的运行在 MNN 内串行，
+//                         每个并发 Session 在各自的 Interpreter（模型缓冲的副本）上
+//    session_mb           getSessionInfo(MEMORY) 报告的单个 Session 内存
+//    rss_mb               测量结束时进程常驻内存（/proc/self/status VmRSS）
+//    默认每次推理包含输入拷入与输出拷出，--no-io 时只计 runSession
+//
+
+#include <Interpreter_c.h>
+#include <Tensor_c.h>
+#include <MNN/Interpreter.hpp>
+#include <MNN/Tensor.hpp>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct NamedValue {
+    const char* name;
+    int value;
+};
+
+const NamedValue kPrecisions[] = {
+    {"normal", MNN_PRECISION_NORMAL}, {"high", MNN_PRECISION_HIGH}, {"low", MNN_PRECISION_LOW},
+    {"low_bf16", MNN_PRECISION_LOW_BF16},
+};
+const NamedValue kMemories[] = {
+    {"normal", MNN_MEMORY_NORMAL}, {"high", MNN_MEMORY_HIGH}, {"low", MNN_MEMORY_LOW},
+};
+const NamedValue kPowers[] = {
+    {"normal", MNN_POWER_NORMAL}, {"high", MNN_POWER_HIGH}, {"low", MNN_POWER_LOW},
+};
+// default 不调用 setSessionMode
+const NamedValue kModes[] = {
+    {"default", -1},
+    {"memory_collect", MNN_SESSION_MODE_MEMORY_COLLECT},
+    {"memory_cache", MNN_SESSION_MODE_MEMORY_CACHE},
+    {"resize_fix", MNN_SESSION_MODE_RESIZE_FIX},
+    {"codegen", MNN_SESSION_MODE_CODEGEN_ENABLE},
+};
+
+struct InputShape {
+    std::string name;                   // 为空时作用于模型的第一个输入
+    std::vector<int> dims;
+};
+
+struct Options {
+    const char* model = nullptr;
+    bool json = false;
+    bool io = true;
+    bool overhead = false;
+    double minTime = 1.0;               // 每个用例的最短测量时间（秒）
+    int warmup = 10;
+    std::vector<InputShape> inputs;
+    std::vector<int> threads;
+    std::vector<int> concurrency;
+    std::vector<NamedValue> precisions;
+    std::vector<NamedValue> memories;
+    std::vector<NamedValue> powers;
+    std::vector<NamedValue> modes;
+};
+
+struct Case {
+    int threads;
+    NamedValue precision;
+    NamedValue memory;
+    NamedValue power;
+    NamedValue mode;
+    int concurrency;
+};
+
+struct Result {
+    double p50;
+    double p90;
+    double p99;
+    double p999;
+    double qps;
+    double sessionMB;
+    double rssMB;
+};
+
+std::vector<std::string> split(const char* s, char sep = ',') {
+    std::vector<std::string> out;
+    std::string cur;
+    for (const char* p = s; ; ++p) {
+        if (*p == sep || *p == '\0') {
+            if (!cur.empty()) {
+                out.push_back(cur);
+            }
+            cur.clear();
+            if (*p == '\0') {
+                break;
+            }
+        } else {
+            cur += *p;
+        }
+    }
+    return out;
+}
+
+std::vector<int> parseInts(const char* s) {
+    std::vector<int> out;
+    for (const std::string& item : split(s)) {
+        if (atoi(item.c_str()) > 0) {
+            out.push_back(atoi(item.c_str()));
+        }
+    }
+    return out;
+}
+
+// "data:1x3x224x224" 或 "1x3x224x224"
+bool parseInput(const char* s, InputShape* shape) {
+    std::string text = s;
+    size_t colon = text.rfind(':');
+    if (colon != std::string::npos) {
+        shape->name = text.substr(0, colon);
+        text = text.substr(colon + 1);
+    }
+    shape->dims.clear();
+    for (const std::string& d : split(text.c_str(), 'x')) {
+        if (atoi(d.c_str()) <= 0) {
+            return false;
+        }
+        shape->dims.push_back(atoi(d.c_str()));
+    }
+    return !shape->dims.empty();
+}
+
+template <size_t N>
+std::vector<NamedValue> parseNames(const char* s, const NamedValue (&table)[N]) {
+    std::vector<NamedValue> out;
+    for (const std::string& item : split(s)) {
+        for (size_t i = 0; i < N; ++i) {
+            if (strcasecmp(item.c_str(), table[i].name) == 0) {
+                out.push_back(table[i]);
+            }
+        }
+    }
+    return out;
+}
+
+double nowSeconds() {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+double rssMB() {
+    FILE* f = fopen("/proc/self/status", "r");
+    if (f == nullptr) {
+        return 0.0;
+    }
+    char line[256];
+    long kb = 0;
+    while (fgets(line, sizeof(line), f) != nullptr) {
+        if (sscanf(line, "VmRSS: %ld kB", &kb) == 1) {
+            break;
+        }
+    }
+    fclose(f);
+    return kb / 1024.0;
+}
+
+double percentile(const std::vector<double>& sorted, double q) {
+    if (sorted.empty()) {
+        return 0.0;
+    }
+    size_t index = (size_t)(q * (sorted.size() - 1) + 0.5);
+    return sorted[std::min(index, sorted.size() - 1)];
+}
+
+void fillRandom(MNN_Tensor* host) {
+    halide_type_t type;
+    MNN_Tensor_GetHalideType(host, &type);
+    uint8_t* data = static_cast<uint8_t*>(MNN_Tensor_Host(host));
+    size_t bytes = (size_t)MNN_Tensor_Size(host);
+    uint32_t seed = 12345;
+    if (type.code == halide_type_float && type.bits == 32) {
+        float* f = reinterpret_cast<float*>(data);
+        for (size_t i = 0; i < bytes / sizeof(float); ++i) {
+            seed = seed * 1664525u + 1013904223u;
+            f[i] = (float)(seed >> 8) / (float)(1u << 24) * 2.0f - 1.0f;
+        }
+        return;
+    }
+    for (size_t i = 0; i < bytes; ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        data[i] = (uint8_t)(seed >> 24);
+    }
+}
+
+// 每个并发 Session 独立的输入输出缓冲
+struct Worker {
+    MNN_Interpreter* net = nullptr;
+    MNN_Session* session = nullptr;
+    std::vector<std::pair<MNN_Tensor*, MNN_Tensor*>> inputs;    // (device, host)
+    std::vector<std::pair<MNN_Tensor*, MNN_Tensor*>> outputs;
+    std::vector<double> samples;
+
+    bool init(MNN_Interpreter* interpreter, const MNN_ScheduleConfig* config, const std::vector<InputShape>& shapes) {
+        net = interpreter;
+        session = MNN_Interpreter_createSession(net, config);
+        if (session == nullptr) {
+            return false;
+        }
+        if (!shapes.empty()) {
+            MNN_NamedTensorList all = MNN_Interpreter_GetSessionInputAll(net, session);
+            for (const InputShape& shape : shapes) {
+                MNN_Tensor* tensor = nullptr;
+                if (shape.name.empty()) {
+                    tensor = all.count > 0 ? all.tensors[0].tensor : nullptr;
+                } else {
+                    tensor = MNN_Interpreter_getSessionInput(net, session, shape.name.c_str());
+                }
+                if (tensor != nullptr) {
+                    MNN_Interpreter_resizeTensor(net, tensor, shape.dims.data(), (int)shape.dims.size());
+                }
+            }
+            MNN_NamedTensorList_Free(all);
+            MNN_Interpreter_resizeSession(net, session);
+        }
+        MNN_NamedTensorList in = MNN_Interpreter_GetSessionInputAll(net, session);
+        for (int i = 0; i < in.count; ++i) {
+            MNN_Tensor* host = MNN_Tensor_CreateHostTensorFromDevice(in.tensors[i].tensor, false);
+            fillRandom(host);
+            MNN_Tensor_CopyFromHostTensor(in.tensors[i].tensor, host);
+            inputs.push_back(std::make_pair(in.tensors[i].tensor, host));
+        }
+        MNN_NamedTensorList_Free(in);
+        MNN_NamedTensorList out = MNN_Interpreter_GetSessionOutputAll(net, session);
+        for (int i = 0; i < out.count; ++i) {
+            outputs.push_back(std::make_pair(out.tensors[i].tensor,
+                                             MNN_Tensor_CreateHostTensorFromDevice(out.tensors[i].tensor, false)));
+        }
+        MNN_NamedTensorList_Free(out);
+        return true;
+    }
+
+    MNN_ErrorCode run(bool io) {
+        if (io) {
+            for (auto& item : inputs) {
+                MNN_Tensor_CopyFromHostTensor(item.first, item.second);
+            }
+        }
+        MNN_ErrorCode code = MNN_Interpreter_runSession(net, session);
+        if (io) {
+            for (auto& item : outputs) {
+                MNN_Tensor_CopyToHostTensor(item.first, item.second);
+            }
+        }
+        return code;
+    }
+
+    Worker() = default;
+    Worker(const Worker&) = delete;
+    Worker& operator=(const Worker&) = delete;
+    ~Worker() {
+        for (auto& item : inputs) {
+            MNN_Tensor_Destroy(item.second);
+        }
+        for (auto& item : outputs) {
+            MNN_Tensor_Destroy(item.second);
+        }
+        if (session != nullptr) {
+            MNN_Interpreter_releaseSession(net, session);
+        }
+    }
+};
+
+void makeConfig(int threads, MNN_BackendConfig* backend, MNN_ScheduleConfig* config) {
+    memset(config, 0, sizeof(*config));
+    config->type_ = MNN_FORWARD_CPU;
+    config->numThread = threads;
+    config->path.mode = MNN_PATH_MODE_OP;
+    config->backupType = MNN_FORWARD_CPU;
+    config->backendConfig = backend;
+}
+
+// 每个用例重新加载模型：Session 模式作用于整个 Interpreter；
+// 第一个 Worker 用加载的 net，其余各用一个副本，否则并发的 runSession 会在 Interpreter 锁上排队
+bool measure(const Options& opt, const Case& c, Result* result) {
+    MNN_Interpreter* net = MNN_Interpreter_createFromFile(opt.model);
+    if (net == nullptr) {
+        return false;
+    }
+    std::vector<MNN_Interpreter*> nets(1, net);
+    bool ok = true;
+    for (int i = 1; i < c.concurrency && ok; ++i) {
+        MNN_Interpreter* replica = MNN_Interpreter_createReplica(net);
+        ok = replica != nullptr;
+        if (ok) {
+            nets.push_back(replica);
+        }
+    }
+    if (c.mode.value >= 0) {
+        for (MNN_Interpreter* item : nets) {
+            MNN_Interpreter_setSessionMode(item, static_cast<MNN_SessionMode>(c.mode.value));
+        }
+    }
+    MNN_BackendConfig backend;
+    memset(&backend, 0, sizeof(backend));
+    backend.precision = static_cast<MNN_Gpu_PrecisionMode>(c.precision.value);
+    backend.memory = static_cast<MNN_MemoryMode>(c.memory.value);
+    backend.power = static_cast<MNN_Gpu_PowerMode>(c.power.value);
+    MNN_ScheduleConfig config;
+    makeConfig(c.threads, &backend, &config);
+
+    if (ok) {
+        std::vector<Worker> workers(c.concurrency);
+        for (size_t index = 0; index < workers.size() && ok; ++index) {
+            Worker& w = workers[index];
+            if (!w.init(nets[index], &config, opt.inputs)) {
+                ok = false;
+                break;
+            }
+            for (int i = 0; i < opt.warmup && ok; ++i) {
+                ok = w.run(opt.io) == MNN_NO_ERROR;
+            }
+        }
+        if (ok) {
+            float memory = 0.0f;
+            MNN_Interpreter_getSessionInfo(net, workers[0].session, MNN_SESSION_INFO_CODE_MEMORY, &memory);
+            result->sessionMB = memory;
+
+            std::atomic<bool> start(false);
+            std::atomic<bool> stop(false);
+            std::vector<std::thread> pool;
+            for (Worker& w : workers) {
+                Worker* worker = &w;
+                pool.emplace_back([&, worker]() {
+                    while (!start.load()) {
+                        std::this_thread::yield();
+                    }
+                    while (!stop.load(std::memory_order_relaxed)) {
+                        double begin = nowSeconds();
+                        worker->run(opt.io);
+                        worker->samples.push_back((nowSeconds() - begin) * 1e3);
+                    }
+                });
+            }
+            double t0 = nowSeconds();
+            start.store(true);
+            std::this_thread::sleep_for(std::chrono::duration<double>(opt.minTime));
+            stop.store(true);
+            for (std::thread& th : pool) {
+                th.join();
+            }
+            double elapsed = nowSeconds() - t0;
+
+            std::vector<double> samples;
+            for (Worker& w : workers) {
+                samples.insert(samples.end(), w.samples.begin(), w.samples.end());
+            }
+            std::sort(samples.begin(), samples.end());
+            result->p50 = percentile(samples, 0.5);
+            result->p90 = percentile(samples, 0.9);
+            result->p99 = percentile(samples, 0.99);
+            result->p999 = percentile(samples, 0.999);
+            result->qps = samples.size() / elapsed;
+            result->rssMB = rssMB();
+        }
+    }
+    for (MNN_Interpreter* item : nets) {
+        MNN_Interpreter_destroy(item);
+    }
+    return ok;
+}
+
+// 交替执行 C 接口与 C++ 接口的同一调用，取多批次中位数
+template <typename CallC, typename CallCpp>
+void compare(const char* name, double minTime, CallC callC, CallCpp callCpp, bool json, bool* first) {
+    const int kBatches = 7;
+    int calls = 0;
+    double t0 = nowSeconds();
+    while (nowSeconds() - t0 < minTime / (2 * kBatches)) {
+        callC();
+        ++calls;
+    }
+    calls = std::max(calls, 1);
+    std::vector<double> cSamples;
+    std::vector<double> cppSamples;
+    for (int b = 0; b < kBatches; ++b) {
+        double start = nowSeconds();
+        for (int i = 0; i < calls; ++i) {
+            callC();
+        }
+        cSamples.push_back((nowSeconds() - start) / calls * 1e9);
+        start = nowSeconds();
+        for (int i = 0; i < calls; ++i) {
+            callCpp();
+        }
+        cppSamples.push_back((nowSeconds() - start) / calls * 1e9);
+    }
+    std::sort(cSamples.begin(), cSamples.end());
+    std::sort(cppSamples.begin(), cppSamples.end());
+    double cNs = cSamples[kBatches / 2];
+    double cppNs = cppSamples[kBatches / 2];
+    if (json) {
+        printf("%s\n    {\"call\": \"%s\", \"c_ns\": %.1f, \"cpp_ns\": %.1f, \"overhead_ns\": %.1f}", *first ? "" : ",",
+               name, cNs, cppNs, cNs - cppNs);
+    } else {
+        printf("%s,%.1f,%.1f,%.1f\n", name, cNs, cppNs, cNs - cppNs);
+    }
+    *first = false;
+    fflush(stdout);
+}
+
+// MNN_Interpreter / MNN_Session / MNN_Tensor 与 C++ 对象是同一指针，直接转换即可走原生接口
+bool measureOverhead(const Options& opt) {
+    MNN_Interpreter* net = MNN_Interpreter_createFromFile(opt.model);
+    if (net == nullptr) {
+        return false;
+    }
+    MNN_BackendConfig backend;
+    memset(&backend, 0, sizeof(backend));
+    MNN_ScheduleConfig config;
+    makeConfig(1, &backend, &config);
+    bool ok = false;
+    {
+        Worker w;
+        if (w.init(net, &config, opt.inputs) && !w.inputs.empty() && !w.outputs.empty()) {
+            ok = true;
+            auto cppNet = reinterpret_cast<MNN::Interpreter*>(net);
+            auto cppSession = reinterpret_cast<MNN::Session*>(w.session);
+            auto input = w.inputs[0];
+            auto output = w.outputs[0];
+            auto cppInput = std::make_pair(reinterpret_cast<MNN::Tensor*>(input.first), reinterpret_cast<MNN::Tensor*>(input.second));
+            auto cppOutput = std::make_pair(reinterpret_cast<MNN::Tensor*>(output.first), reinterpret_cast<MNN::Tensor*>(output.second));
+            MNN_NamedTensorList in = MNN_Interpreter_GetSessionInputAll(net, w.session);
+            std::string inputName = in.tensors[0].name;
+            MNN_NamedTensorList_Free(in);
+
+            if (opt.json) {
+                printf("{\n  \"mnn_version\": \"%s\",\n  \"overhead\": [", MNN_getVersion());
+            } else {
+                printf("# mnn_version=%s\n", MNN_getVersion());
+                printf("call,c_ns,cpp_ns,overhead_ns\n");
+            }
+            bool first = true;
+            compare("getSessionInput", opt.minTime,
+                    [&]() { MNN_Interpreter_getSessionInput(net, w.session, inputName.c_str()); },
+                    [&]() { cppNet->getSessionInput(cppSession, inputName.c_str()); }, opt.json, &first);
+            compare("copyFromHostTensor", opt.minTime,
+                    [&]() { MNN_Tensor_CopyFromHostTensor(input.first, input.second); },
+                    [&]() { cppInput.first->copyFromHostTensor(cppInput.second); }, opt.json, &first);
+            compare("copyToHostTensor", opt.minTime,
+                    [&]() { MNN_Tensor_CopyToHostTensor(output.first, output.second); },
+                    [&]() { cppOutput.first->copyToHostTensor(cppOutput.second); }, opt.json, &first);
+            compare("runSession", opt.minTime,
+                    [&]() { MNN_Interpreter_runSession(net, w.session); },
+                    [&]() { cppNet->runSession(cppSession); }, opt.json, &first);
+            if (opt.json) {
+                printf("\n  ]\n}\n");
+            }
+        }
+    }
+    MNN_Interpreter_destroy(net);
+    return ok;
+}
+
+void usage(const char* argv0) {
+    fprintf(stderr,
+            "usage: %s model.mnn [--json] [--input name:1x3x224x224] [--min-time sec] [--warmup n]\n"
+            "          [--threads 1,4] [--precision normal,high,low,low_bf16] [--memory normal,high,low]\n"
+            "          [--power normal,high,low] [--modes default,memory_collect,memory_cache,resize_fix,codegen]\n"
+            "          [--concurrency 1,2,4] [--no-io] [--overhead]\n",
+            argv0);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    opt.precisions = parseNames("normal,low", kPrecisions);
+    opt.memories = parseNames("normal", kMemories);
+    opt.powers = parseNames("normal", kPowers);
+    opt.modes = parseNames("default", kModes);
+    opt.concurrency.push_back(1);
+    int hw = std::max(1, (int)std::thread::hardware_concurrency());
+    for (int t = 1; t < hw; t *= 2) {
+        opt.threads.push_back(t);
+    }
+    opt.threads.push_back(hw);
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+        if (arg == "--json") {
+            opt.json = true;
+            continue;
+        }
+        if (arg == "--no-io") {
+            opt.io = false;
+            continue;
+        }
+        if (arg == "--overhead") {
+            opt.overhead = true;
+            continue;
+        }
+        if (arg[0] != '-' && opt.model == nullptr) {
+            opt.model = argv[i];
+            continue;
+        }
+        if (value == nullptr) {
+            usage(argv[0]);
+            return 1;
+        }
+        ++i;
+        if (arg == "--min-time") {
+            opt.minTime = atof(value);
+        } else if (arg == "--warmup") {
+            opt.warmup = atoi(value);
+        } else if (arg == "--input") {
+            InputShape shape;
+            if (!parseInput(value, &shape)) {
+                usage(argv[0]);
+                return 1;
+            }
+            opt.inputs.push_back(shape);
+        } else if (arg == "--threads") {
+            opt.threads = parseInts(value);
+        } else if (arg == "--concurrency") {
+            opt.concurrency = parseInts(value);
+        } else if (arg == "--precision") {
+            opt.precisions = parseNames(value, kPrecisions);
+        } else if (arg == "--memory") {
+            opt.memories = parseNames(value, kMemories);
+        } else if (arg == "--power") {
+            opt.powers = parseNames(value, kPowers);
+        } else if (arg == "--modes") {
+            opt.modes = parseNames(value, kModes);
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (opt.model == nullptr) {
+        usage(argv[0]);
+        return 1;
+    }
+    if (opt.overhead) {
+        if (!measureOverhead(opt)) {
+            fprintf(stderr, "failed to load %s or it has no input/output\n", opt.model);
+            return 1;
+        }
+        return 0;
+    }
+
+    if (opt.json) {
+        printf("{\n  \"mnn_version\": \"%s\",\n  \"model\": \"%s\",\n  \"hardware_threads\": %d,\n  \"io\": %s,\n"
+               "  \"results\": [", MNN_getVersion(), opt.model, hw, opt.io ? "true" : "false");
+    } else {
+        printf("# mnn_version=%s model=%s hardware_threads=%d io=%d\n", MNN_getVersion(), opt.model, hw, opt.io ? 1 : 0);
+        printf("threads,precision,memory,power,mode,concurrency,p50_ms,p90_ms,p99_ms,p999_ms,qps,session_mb,rss_mb\n");
+    }
+
+    bool first = true;
+    for (const NamedValue& mode : opt.modes)
+    for (const NamedValue& precision : opt.precisions)
+    for (const NamedValue& memory : opt.memories)
+    for (const NamedValue& power : opt.powers)
+    for (int threads : opt.threads)
+    for (int concurrency : opt.concurrency) {
+        Case c = {threads, precision, memory, power, mode, concurrency};
+        Result r;
+        if (!measure(opt, c, &r)) {
+            fprintf(stderr, "skip threads=%d %s/%s/%s/%s x%d: session failed\n", threads, precision.name, memory.name,
+                    power.name, mode.name, concurrency);
+            continue;
+        }
+        if (opt.json) {
+            printf("%s\n    {\"threads\": %d, \"precision\": \"%s\", \"memory\": \"%s\", \"power\": \"%s\", "
+                   "\"mode\": \"%s\", \"concurrency\": %d, \"p50_ms\": %.3f, \"p90_ms\": %.3f, \"p99_ms\": %.3f, "
+                   "\"p999_ms\": %.3f, \"qps\": %.1f, \"session_mb\": %.2f, \"rss_mb\": %.1f}",
+                   first ? "" : ",", threads, precision.name, memory.name, power.name, mode.name, concurrency, r.p50,
+                   r.p90, r.p99, r.p999, r.qps, r.sessionMB, r.rssMB);
+        } else {
+            printf("%d,%s,%s,%s,%s,%d,%.3f,%.3f,%.3f,%.3f,%.1f,%.2f,%.1f\n", threads, precision.name, memory.name,
+                   power.name, mode.name, concurrency, r.p50, r.p90, r.p99, r.p999, r.qps, r.sessionMB, r.rssMB);
+        }
+        first = false;
+        fflush(stdout);
+    }
+    if (opt.json) {
+        printf("\n  ]\n}\n");
+    }
+    return 0;
+}
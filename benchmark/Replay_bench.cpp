@@ -0,0 +1,346 @@
+//
+//  Replay_bench.cpp
+//  MNN
+//
+//  回放 Recorder 录制的线上流量（走 C 接口）：按录制时的间隔或最大速率把每条记录的输入
+//  送回 runSession，输出录制延迟、回放延迟与基线延迟的分布及差异，用于不同构建之间的延迟回归对比
+//
+//  编译（在仓库根目录）：
+//    g++ -O2 -std=c++11 -pthread -Imnn -I$MNN_ROOT/include benchmark/Replay_bench.cpp
+//        mnn/*.cpp -L$MNN_ROOT/build -lMNN -o replay_bench
+//
+//  用法：
+//    ./replay_bench model.mnn capture.rec [--json] [--rate recorded|max] [--max-gap 1] [--threads 4]
+//                   [--precision normal] [--warmup 10] [--dump latencies.txt] [--baseline latencies.txt]
+//
+//    先用旧构建 --dump old.txt，再用新构建 --baseline old.txt，两次回放的是同一批输入，
+//    paired_ratio 为逐条 新/旧 延迟比值的中位数，对分布尾部的噪声不敏感
+//
+//  指标：
+//    recorded  录制时 runSession 的延迟（线上环境）
+//    replayed  本次回放 runSession 的延迟，不含输入拷贝与形状变化引起的 resize
+//    baseline  --baseline 文件中的延迟
+//    apply_ms  每条记录拷入输入（及必要的 resize）的平均耗时
+//
+
+#include <Interpreter_c.h>
+#include <Recorder_c.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+const struct {
+    const char* name;
+    MNN_Gpu_PrecisionMode value;
+} kPrecisions[] = {
+    {"normal", MNN_PRECISION_NORMAL}, {"high", MNN_PRECISION_HIGH}, {"low", MNN_PRECISION_LOW},
+    {"low_bf16", MNN_PRECISION_LOW_BF16},
+};
+
+struct Options {
+    const char* model = nullptr;
+    const char* capture = nullptr;
+    const char* dump = nullptr;
+    const char* baseline = nullptr;
+    bool json = false;
+    bool recordedRate = false;
+    double maxGap = 1.0;                // 按录制速率回放时单个间隔的上限（秒）
+    int threads = 4;
+    int warmup = 10;
+    MNN_Gpu_PrecisionMode precision = MNN_PRECISION_NORMAL;
+};
+
+struct Summary {
+    size_t count = 0;
+    double p50 = 0.0;
+    double p90 = 0.0;
+    double p99 = 0.0;
+    double p999 = 0.0;
+    double max = 0.0;
+    double mean = 0.0;
+};
+
+double nowSeconds() {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+double percentile(const std::vector<double>& sorted, double q) {
+    if (sorted.empty()) {
+        return 0.0;
+    }
+    size_t index = (size_t)(q * (sorted.size() - 1) + 0.5);
+    return sorted[std::min(index, sorted.size() - 1)];
+}
+
+Summary summarize(std::vector<double> samples) {
+    Summary s;
+    if (samples.empty()) {
+        return s;
+    }
+    std::sort(samples.begin(), samples.end());
+    s.count = samples.size();
+    s.p50 = percentile(samples, 0.5);
+    s.p90 = percentile(samples, 0.9);
+    s.p99 = percentile(samples, 0.99);
+    s.p999 = percentile(samples, 0.999);
+    s.max = samples.back();
+    double sum = 0.0;
+    for (double v : samples) {
+        sum += v;
+    }
+    s.mean = sum / samples.size();
+    return s;
+}
+
+// 逐条比值的中位数，两组长度不同时返回 0
+double pairedRatio(const std::vector<double>& current, const std::vector<double>& reference) {
+    if (current.empty() || current.size() != reference.size()) {
+        return 0.0;
+    }
+    std::vector<double> ratios;
+    for (size_t i = 0; i < current.size(); ++i) {
+        if (reference[i] > 0.0) {
+            ratios.push_back(current[i] / reference[i]);
+        }
+    }
+    std::sort(ratios.begin(), ratios.end());
+    return percentile(ratios, 0.5);
+}
+
+bool loadLatencies(const char* path, std::vector<double>* out) {
+    FILE* f = fopen(path, "r");
+    if (f == nullptr) {
+        return false;
+    }
+    double v = 0.0;
+    while (fscanf(f, "%lf", &v) == 1) {
+        out->push_back(v);
+    }
+    fclose(f);
+    return true;
+}
+
+void printSummary(const char* name, const Summary& s, bool json, bool* first) {
+    if (json) {
+        printf("%s\n    {\"series\": \"%s\", \"count\": %zu, \"p50_ms\": %.3f, \"p90_ms\": %.3f, \"p99_ms\": %.3f, "
+               "\"p999_ms\": %.3f, \"max_ms\": %.3f, \"mean_ms\": %.3f}",
+               *first ? "" : ",", name, s.count, s.p50, s.p90, s.p99, s.p999, s.max, s.mean);
+    } else {
+        printf("%s,%zu,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f\n", name, s.count, s.p50, s.p90, s.p99, s.p999, s.max, s.mean);
+    }
+    *first = false;
+}
+
+void usage(const char* argv0) {
+    fprintf(stderr,
+            "usage: %s model.mnn capture.rec [--json] [--rate recorded|max] [--max-gap sec] [--threads n]\n"
+            "          [--precision normal,high,low,low_bf16] [--warmup n] [--dump file] [--baseline file]\n",
+            argv0);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+        if (arg == "--json") {
+            opt.json = true;
+            continue;
+        }
+        if (arg[0] != '-') {
+            if (opt.model == nullptr) {
+                opt.model = argv[i];
+            } else if (opt.capture == nullptr) {
+                opt.capture = argv[i];
+            } else {
+                usage(argv[0]);
+                return 1;
+            }
+            continue;
+        }
+        if (value == nullptr) {
+            usage(argv[0]);
+            return 1;
+        }
+        ++i;
+        if (arg == "--rate") {
+            opt.recordedRate = strcmp(value, "recorded") == 0;
+        } else if (arg == "--max-gap") {
+            opt.maxGap = atof(value);
+        } else if (arg == "--threads") {
+            opt.threads = std::max(1, atoi(value));
+        } else if (arg == "--warmup") {
+            opt.warmup = atoi(value);
+        } else if (arg == "--dump") {
+            opt.dump = value;
+        } else if (arg == "--baseline") {
+            opt.baseline = value;
+        } else if (arg == "--precision") {
+            bool found = false;
+            for (const auto& p : kPrecisions) {
+                if (strcasecmp(value, p.name) == 0) {
+                    opt.precision = p.value;
+                    found = true;
+                }
+            }
+            if (!found) {
+                usage(argv[0]);
+                return 1;
+            }
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (opt.model == nullptr || opt.capture == nullptr) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    MNN_Interpreter* net = MNN_Interpreter_createFromFile(opt.model);
+    if (net == nullptr) {
+        fprintf(stderr, "failed to load %s\n", opt.model);
+        return 1;
+    }
+    MNN_BackendConfig backend;
+    memset(&backend, 0, sizeof(backend));
+    backend.precision = opt.precision;
+    MNN_ScheduleConfig config;
+    memset(&config, 0, sizeof(config));
+    config.type_ = MNN_FORWARD_CPU;
+    config.numThread = opt.threads;
+    config.backupType = MNN_FORWARD_CPU;
+    config.backendConfig = &backend;
+    MNN_Session* session = MNN_Interpreter_createSession(net, &config);
+    if (session == nullptr) {
+        fprintf(stderr, "failed to create session\n");
+        MNN_Interpreter_destroy(net);
+        return 1;
+    }
+    const char* uuid = MNN_Interpreter_uuid(net);
+    std::string modelId = uuid != nullptr ? uuid : "";
+
+    // 预热：用第一条记录运行若干次
+    MNN_RecordReader* reader = MNN_RecordReader_open(opt.capture);
+    if (reader == nullptr) {
+        fprintf(stderr, "failed to open capture %s\n", opt.capture);
+        MNN_Interpreter_releaseSession(net, session);
+        MNN_Interpreter_destroy(net);
+        return 1;
+    }
+    MNN_Record record;
+    if (MNN_RecordReader_next(reader, &record) && MNN_Record_apply(net, session, &record, nullptr) == MNN_NO_ERROR) {
+        for (int i = 0; i < opt.warmup; ++i) {
+            MNN_Interpreter_runSession(net, session);
+        }
+    }
+    MNN_RecordReader_close(reader);
+
+    reader = MNN_RecordReader_open(opt.capture);
+    std::vector<double> recorded;
+    std::vector<double> replayed;
+    size_t skipped = 0;
+    size_t resizes = 0;
+    double applySeconds = 0.0;
+    bool haveFirst = false;
+    uint64_t firstTimestamp = 0;
+    double wallStart = nowSeconds();
+    double shift = 0.0;                 // 超过 maxGap 的间隔被压缩掉的累计时间
+    double lastOffset = 0.0;
+    while (MNN_RecordReader_next(reader, &record)) {
+        if (!modelId.empty() && record.model[0] != '\0' && modelId != record.model) {
+            ++skipped;
+            continue;
+        }
+        if (opt.recordedRate) {
+            if (!haveFirst) {
+                haveFirst = true;
+                firstTimestamp = record.timestampNs;
+            }
+            // 多线程录制时记录可能乱序，早于前一条的记录按间隔 0 立即重放
+            double offset = (double)(int64_t)(record.timestampNs - firstTimestamp) / 1e9;
+            if (offset < lastOffset) {
+                offset = lastOffset;
+            }
+            if (offset - lastOffset > opt.maxGap) {
+                shift += offset - lastOffset - opt.maxGap;
+            }
+            lastOffset = offset;
+            double wait = wallStart + offset - shift - nowSeconds();
+            if (wait > 0.0) {
+                std::this_thread::sleep_for(std::chrono::duration<double>(wait));
+            }
+        }
+        double begin = nowSeconds();
+        MNN_BOOL resized = false;
+        if (MNN_Record_apply(net, session, &record, &resized) != MNN_NO_ERROR) {
+            ++skipped;
+            continue;
+        }
+        resizes += resized ? 1 : 0;
+        double start = nowSeconds();
+        applySeconds += start - begin;
+        if (MNN_Interpreter_runSession(net, session) != MNN_NO_ERROR) {
+            ++skipped;
+            continue;
+        }
+        replayed.push_back((nowSeconds() - start) * 1e3);
+        recorded.push_back(record.latencyNs / 1e6);
+    }
+    MNN_RecordReader_close(reader);
+    MNN_Interpreter_releaseSession(net, session);
+    MNN_Interpreter_destroy(net);
+
+    if (opt.dump != nullptr) {
+        FILE* f = fopen(opt.dump, "w");
+        if (f != nullptr) {
+            for (double v : replayed) {
+                fprintf(f, "%.6f\n", v);
+            }
+            fclose(f);
+        }
+    }
+    std::vector<double> baseline;
+    if (opt.baseline != nullptr && !loadLatencies(opt.baseline, &baseline)) {
+        fprintf(stderr, "failed to read baseline %s\n", opt.baseline);
+    }
+
+    Summary recordedSummary = summarize(recorded);
+    Summary replayedSummary = summarize(replayed);
+    Summary baselineSummary = summarize(baseline);
+    double applyMs = replayed.empty() ? 0.0 : applySeconds / replayed.size() * 1e3;
+    double pairedRecorded = pairedRatio(replayed, recorded);
+    double pairedBaseline = pairedRatio(replayed, baseline);
+
+    bool first = true;
+    if (opt.json) {
+        printf("{\n  \"mnn_version\": \"%s\",\n  \"model\": \"%s\",\n  \"capture\": \"%s\",\n  \"rate\": \"%s\",\n"
+               "  \"skipped\": %zu,\n  \"resizes\": %zu,\n  \"apply_ms\": %.3f,\n"
+               "  \"paired_ratio_recorded\": %.4f,\n  \"paired_ratio_baseline\": %.4f,\n  \"series\": [",
+               MNN_getVersion(), opt.model, opt.capture, opt.recordedRate ? "recorded" : "max", skipped, resizes,
+               applyMs, pairedRecorded, pairedBaseline);
+    } else {
+        printf("# mnn_version=%s model=%s capture=%s rate=%s skipped=%zu resizes=%zu apply_ms=%.3f\n", MNN_getVersion(),
+               opt.model, opt.capture, opt.recordedRate ? "recorded" : "max", skipped, resizes, applyMs);
+        printf("# paired_ratio_recorded=%.4f paired_ratio_baseline=%.4f\n", pairedRecorded, pairedBaseline);
+        printf("series,count,p50_ms,p90_ms,p99_ms,p999_ms,max_ms,mean_ms\n");
+    }
+    printSummary("recorded", recordedSummary, opt.json, &first);
+    printSummary("replayed", replayedSummary, opt.json, &first);
+    if (!baseline.empty()) {
+        printSummary("baseline", baselineSummary, opt.json, &first);
+    }
+    if (opt.json) {
+        printf("\n  ]\n}\n");
+    }
+    return 0;
+}
@@ -0,0 +1,207 @@
+//
+//  Resize_bench.cpp
+//  MNN
+//
+//  动态形状 resize 开销测试（走 C 接口）：对一个输入按给定的形状序列循环 resize + runSession，
+//  分别测量 resizeSession、resizeSessionEx(needRelloc = 0)、RESIZE_CHECK + RESIZE_FIX 及其组合，
+//  校验各策略输出与默认策略一致，并给出调优结果（即 MNN_ResizeTuner_tune 的选择）
+//
+//  编译（在仓库根目录）：
+//    g++ -O2 -std=c++11 -pthread -Imnn -I$MNN_ROOT/include benchmark/Resize_bench.cpp
+//        mnn/*.cpp -L$MNN_ROOT/build -lMNN -o resize_bench
+//
+//  用法：
+//    ./resize_bench model.mnn --shapes 1x3x224x224,1x3x320x320,1x3x256x256 [--json] [--input name]
+//                   [--rounds 20] [--threads 4] [--precision normal]
+//
+//    形状序列应接近线上实际的变化顺序；同一形状重复出现时也会按序列执行 resize
+//
+//  指标：
+//    prepare_ms   创建 Session 并过一遍形状序列（FIXED 策略在这一遍追踪）的耗时
+//    resize_*_ms  每步 resizeTensor + resize 的耗时分布
+//    run_mean_ms  每步 runSession 的平均耗时，resize 策略可能影响运行时的内存布局
+//    total_ms     resize_mean_ms + run_mean_ms，选择策略的依据
+//    matched      每次运行的输出与默认策略一致（相对误差 1e-3 以内）
+//
+
+#include <Interpreter_c.h>
+#include <ResizeTuner_c.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace {
+
+const struct {
+    const char* name;
+    MNN_Gpu_PrecisionMode value;
+} kPrecisions[] = {
+    {"normal", MNN_PRECISION_NORMAL}, {"high", MNN_PRECISION_HIGH}, {"low", MNN_PRECISION_LOW},
+    {"low_bf16", MNN_PRECISION_LOW_BF16},
+};
+
+const char* kStrategies[MNN_RESIZE_STRATEGY_COUNT] = {"default", "no_realloc", "fixed", "fixed_no_realloc"};
+
+struct Options {
+    const char* model = nullptr;
+    const char* input = nullptr;
+    bool json = false;
+    int rounds = 20;
+    int threads = 4;
+    MNN_Gpu_PrecisionMode precision = MNN_PRECISION_NORMAL;
+    std::vector<std::vector<int>> shapes;
+};
+
+// "1x3x224x224,1x3x320x320"
+bool parseShapes(const char* value, std::vector<std::vector<int>>* shapes) {
+    std::string text = value;
+    size_t begin = 0;
+    while (begin <= text.size()) {
+        size_t end = text.find(',', begin);
+        std::string item = text.substr(begin, end == std::string::npos ? std::string::npos : end - begin);
+        std::vector<int> dims;
+        size_t pos = 0;
+        while (pos <= item.size()) {
+            size_t next = item.find('x', pos);
+            std::string dim = item.substr(pos, next == std::string::npos ? std::string::npos : next - pos);
+            int v = atoi(dim.c_str());
+            if (v <= 0) {
+                return false;
+            }
+            dims.push_back(v);
+            if (next == std::string::npos) {
+                break;
+            }
+            pos = next + 1;
+        }
+        shapes->push_back(dims);
+        if (end == std::string::npos) {
+            break;
+        }
+        begin = end + 1;
+    }
+    return !shapes->empty();
+}
+
+void usage(const char* argv0) {
+    fprintf(stderr,
+            "usage: %s model.mnn --shapes 1x3x224x224,1x3x320x320 [--json] [--input name] [--rounds n]\n"
+            "          [--threads n] [--precision normal,high,low,low_bf16]\n",
+            argv0);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+        if (arg == "--json") {
+            opt.json = true;
+            continue;
+        }
+        if (arg[0] != '-') {
+            if (opt.model != nullptr) {
+                usage(argv[0]);
+                return 1;
+            }
+            opt.model = argv[i];
+            continue;
+        }
+        if (value == nullptr) {
+            usage(argv[0]);
+            return 1;
+        }
+        ++i;
+        if (arg == "--shapes") {
+            if (!parseShapes(value, &opt.shapes)) {
+                usage(argv[0]);
+                return 1;
+            }
+        } else if (arg == "--input") {
+            opt.input = value;
+        } else if (arg == "--rounds") {
+            opt.rounds = std::max(1, atoi(value));
+        } else if (arg == "--threads") {
+            opt.threads = std::max(1, atoi(value));
+        } else if (arg == "--precision") {
+            bool found = false;
+            for (const auto& p : kPrecisions) {
+                if (strcasecmp(value, p.name) == 0) {
+                    opt.precision = p.value;
+                    found = true;
+                }
+            }
+            if (!found) {
+                usage(argv[0]);
+                return 1;
+            }
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (opt.model == nullptr || opt.shapes.empty()) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    MNN_Interpreter* net = MNN_Interpreter_createFromFile(opt.model);
+    if (net == nullptr) {
+        fprintf(stderr, "failed to load %s\n", opt.model);
+        return 1;
+    }
+    MNN_BackendConfig backend;
+    memset(&backend, 0, sizeof(backend));
+    backend.precision = opt.precision;
+    MNN_ScheduleConfig config;
+    memset(&config, 0, sizeof(config));
+    config.type_ = MNN_FORWARD_CPU;
+    config.numThread = opt.threads;
+    config.backupType = MNN_FORWARD_CPU;
+    config.backendConfig = &backend;
+
+    std::vector<MNN_ResizeShape> shapes(opt.shapes.size());
+    for (size_t i = 0; i < shapes.size(); ++i) {
+        shapes[i].dims = opt.shapes[i].data();
+        shapes[i].dimCount = (int)opt.shapes[i].size();
+    }
+    MNN_ResizeTrial trials[MNN_RESIZE_STRATEGY_COUNT];
+    int best = MNN_ResizeTuner_tune(net, &config, opt.input, shapes.data(), (int)shapes.size(), opt.rounds, trials);
+    MNN_Interpreter_destroy(net);
+
+    const char* chosen = best >= 0 ? kStrategies[best] : "none";
+    if (opt.json) {
+        printf("{\n  \"mnn_version\": \"%s\",\n  \"model\": \"%s\",\n  \"shapes\": %zu,\n  \"rounds\": %d,\n"
+               "  \"threads\": %d,\n  \"best\": \"%s\",\n  \"strategies\": [",
+               MNN_getVersion(), opt.model, shapes.size(), opt.rounds, opt.threads, chosen);
+    } else {
+        printf("# mnn_version=%s model=%s shapes=%zu rounds=%d threads=%d best=%s\n", MNN_getVersion(), opt.model,
+               shapes.size(), opt.rounds, opt.threads, chosen);
+        printf("strategy,matched,error,max_error,resizes,prepare_ms,resize_mean_ms,resize_p50_ms,resize_p99_ms,"
+               "resize_max_ms,run_mean_ms,total_ms\n");
+    }
+    for (int s = 0; s < MNN_RESIZE_STRATEGY_COUNT; ++s) {
+        const MNN_ResizeTrial& t = trials[s];
+        if (opt.json) {
+            printf("%s\n    {\"strategy\": \"%s\", \"matched\": %s, \"error\": %d, \"max_error\": %g, \"resizes\": %d, "
+                   "\"prepare_ms\": %.3f, \"resize_mean_ms\": %.3f, \"resize_p50_ms\": %.3f, \"resize_p99_ms\": %.3f, "
+                   "\"resize_max_ms\": %.3f, \"run_mean_ms\": %.3f, \"total_ms\": %.3f}",
+                   s == 0 ? "" : ",", kStrategies[s], t.matched ? "true" : "false", (int)t.error, t.maxError,
+                   t.resizes, t.prepareMs, t.resizeMeanMs, t.resizeP50Ms, t.resizeP99Ms, t.resizeMaxMs, t.runMeanMs,
+                   t.resizeMeanMs + t.runMeanMs);
+        } else {
+            printf("%s,%d,%d,%g,%d,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f\n", kStrategies[s], t.matched ? 1 : 0,
+                   (int)t.error, t.maxError, t.resizes, t.prepareMs, t.resizeMeanMs, t.resizeP50Ms, t.resizeP99Ms,
+                   t.resizeMaxMs, t.runMeanMs, t.resizeMeanMs + t.runMeanMs);
+        }
+    }
+    if (opt.json) {
+        printf("\n  ]\n}\n");
+    }
+    return best >= 0 ? 0 : 1;
+}
@@ -0,0 +1,137 @@
+//
+//  BulkLoader_c.cpp
+//  MNN
+//
+
+#include "BulkLoader_c.h"
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "ScheduleConfigCopy.hpp"
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define MNN_BULKLOADER_USE_FADVISE
+#else
+#include <stdio.h>
+#endif
+
+typedef std::chrono::steady_clock Clock;
+
+// -------------------------- 内部工具 --------------------------
+static double elapsedMs(Clock::time_point begin, Clock::time_point end) {
+    return std::chrono::duration<double, std::milli>(end - begin).count();
+}
+
+// 通知内核异步预读整个文件，返回文件大小；不阻塞等待 I/O 完成
+static size_t prefetch(const char* file) {
+#ifdef MNN_BULKLOADER_USE_FADVISE
+    int fd = open(file, O_RDONLY);
+    if (fd < 0) {
+        return 0;
+    }
+    struct stat info;
+    size_t size = fstat(fd, &info) == 0 ? (size_t)info.st_size : 0;
+    posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+    close(fd);
+    return size;
+#else
+    FILE* handle = fopen(file, "rb");
+    if (handle == nullptr) {
+        return 0;
+    }
+    fseek(handle, 0, SEEK_END);
+    long size = ftell(handle);
+    fclose(handle);
+    return size > 0 ? (size_t)size : 0;
+#endif
+}
+
+static void loadOne(const MNN_BulkLoadItem& item, const ScheduleConfigCopy& defaultConfig, MNN_BulkLoadResult* result) {
+    auto begin = Clock::now();
+    result->net = MNN_Interpreter_createFromFile(item.file);
+    auto loaded = Clock::now();
+    result->loadMs = elapsedMs(begin, loaded);
+    if (result->net == nullptr) {
+        result->code = MNN_FILE_OPEN_FAILED;
+        return;
+    }
+    if (item.initThreadNumber > 0) {
+        MNN_Interpreter_setSessionHint(result->net, MNN_HINT_MODE_INIT_THREAD_NUMBER, item.initThreadNumber);
+    }
+    const struct MNN_ScheduleConfig* config = item.config != nullptr ? item.config : defaultConfig.get();
+    result->session = MNN_Interpreter_createSession(result->net, config);
+    result->sessionMs = elapsedMs(loaded, Clock::now());
+    if (result->session == nullptr) {
+        MNN_Interpreter_destroy(result->net);
+        result->net = nullptr;
+        result->code = MNN_NOT_SUPPORT;
+    }
+}
+
+// -------------------------- 接口实现 --------------------------
+MNN_ErrorCode MNN_BulkLoader_load(const MNN_BulkLoadItem* items, int count, int maxConcurrency,
+                                  MNN_BulkLoadResult* results) {
+    if (items == nullptr || results == nullptr || count < 0) {
+        return MNN_INVALID_VALUE;
+    }
+    auto start = Clock::now();
+    for (int i = 0; i < count; ++i) {
+        memset(&results[i], 0, sizeof(results[i]));
+        results[i].code = MNN_NO_ERROR;
+        if (items[i].file == nullptr) {
+            results[i].code = MNN_INVALID_VALUE;
+            continue;
+        }
+        results[i].fileSize = prefetch(items[i].file);
+    }
+
+    if (maxConcurrency <= 0) {
+        maxConcurrency = (int)std::thread::hardware_concurrency();
+    }
+    const int workers = std::max(1, std::min(maxConcurrency, count));
+    const ScheduleConfigCopy defaultConfig;
+    // 按文件大小降序领取（最长任务优先），避免最大的模型最后才开始而拖长总耗时
+    std::vector<int> order(count);
+    for (int i = 0; i < count; ++i) {
+        order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+        return results[a].fileSize > results[b].fileSize;
+    });
+    std::atomic<int> next(0);
+    auto work = [&]() {
+        while (true) {
+            int position = next.fetch_add(1);
+            if (position >= count) {
+                return;
+            }
+            int index = order[position];
+            MNN_BulkLoadResult* result = &results[index];
+            if (result->code != MNN_NO_ERROR) {
+                continue;
+            }
+            result->queueMs = elapsedMs(start, Clock::now());
+            loadOne(items[index], defaultConfig, result);
+        }
+    };
+    std::vector<std::thread> threads;
+    for (int i = 1; i < workers; ++i) {
+        threads.emplace_back(work);
+    }
+    work();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (int i = 0; i < count; ++i) {
+        if (results[i].code != MNN_NO_ERROR) {
+            return results[i].code;
+        }
+    }
+    return MNN_NO_ERROR;
+}
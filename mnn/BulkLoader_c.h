@@ -0,0 +1,56 @@
+//
+//  BulkLoader_c.h
+//  MNN
+//
+//  批量并行加载模型：先对所有模型文件发起预读，再在有界线程池上并发执行
+//  createFromFile + createSession，启动耗时取决于最慢的模型而不是所有模型之和
+//
+
+#ifndef MNN_BulkLoader_c_h
+#define MNN_BulkLoader_c_h
+
+#include "Interpreter_c.h"
+
+// 导出宏：Windows下导出，其他平台兼容
+#ifdef MNN_C_EXPORTS
+    // 仅当编译 libmnn.dll 时定义 MNN_C_EXPORTS，此时用 dllexport
+    #define MNN_C_API __declspec(dllexport)
+#else
+    #define MNN_C_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct MNN_BulkLoadItem {
+    const char* file;
+    const struct MNN_ScheduleConfig* config;    // NULL 表示默认配置（CPU，4 线程）
+    int initThreadNumber;                       // > 0 时设置 MNN_HINT_MODE_INIT_THREAD_NUMBER
+} MNN_BulkLoadItem;
+
+typedef struct MNN_BulkLoadResult {
+    struct MNN_Interpreter* net;    // 由调用方负责释放 Session 并销毁
+    struct MNN_Session* session;
+    MNN_ErrorCode code;
+    size_t fileSize;
+    double queueMs;                 // 从开始到被工作线程取走的等待时间
+    double loadMs;                  // createFromFile 耗时
+    double sessionMs;               // createSession 耗时
+} MNN_BulkLoadResult;
+
+/**
+ * @brief load models concurrently, largest file first. Readahead is requested for every file before loading starts.
+ * Failed items leave net and session NULL; the other items are still loaded.
+ * @param maxConcurrency worker count, <= 0 means the number of online cores.
+ * @param results count entries.
+ * @return the first failing item's code, MNN_NO_ERROR if all succeeded.
+ */
+MNN_C_API MNN_ErrorCode MNN_BulkLoader_load(const MNN_BulkLoadItem* items, int count, int maxConcurrency,
+                                            MNN_BulkLoadResult* results);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MNN_BulkLoader_c_h */
@@ -0,0 +1,344 @@
+//
+//  CostModel_c.cpp
+//  MNN
+//
+
+#include "CostModel_c.h"
+#include "Tensor_c.h"
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace {
+
+// 带遗忘因子的一元最小二乘
+struct Fit {
+    double n = 0, sx = 0, sy = 0, sxx = 0, sxy = 0;
+
+    void add(double x, double y, double decay) {
+        n = n * decay + 1;
+        sx = sx * decay + x;
+        sy = sy * decay + y;
+        sxx = sxx * decay + x * x;
+        sxy = sxy * decay + x * y;
+    }
+    // 只有一个形状时 x 没有方差，退化为过原点的比例模型
+    bool solve(double& intercept, double& slope) const {
+        if (n <= 0 || sx <= 0) {
+            return false;
+        }
+        double det = n * sxx - sx * sx;
+        if (n >= 2 && det > 1e-9 * n * sxx) {
+            slope = (n * sxy - sx * sy) / det;
+            intercept = (sy - slope * sx) / n;
+            if (slope > 0 && intercept >= 0) {
+                return true;
+            }
+        }
+        intercept = 0;
+        slope = sy / sx;
+        return true;
+    }
+};
+
+struct Bucket {
+    double n = 0;
+    double meanMs = 0;
+};
+
+struct Candidate {
+    MNN_Interpreter* net = nullptr;
+    MNN_Session* session = nullptr;
+    int threads = 1;
+    Fit fit;
+    std::map<int, Bucket> buckets;
+    std::map<std::vector<int>, double> mflopsByShape;
+    // 最近一次读到的当前形状与 FLOPs；持锁时只用缓存，不调用 MNN
+    std::vector<int> shape;
+    double mflops = -1;
+    uint64_t samples = 0;
+    int inflight = 0;
+};
+
+} // namespace
+
+struct MNN_CostModel {
+    std::mutex lock;
+    double decay = 0.99;
+    std::vector<Candidate> candidates;
+    Fit pooled;     // x 为 MFLOPs / 线程数
+};
+
+// -------------------------- 内部工具 --------------------------
+static const int kBucketMinSamples = 3;
+
+// 四分之一倍频程的 FLOPs 桶
+static int bucketOf(double mflops) {
+    return (int)lround(log2(mflops > 1e-6 ? mflops : 1e-6) * 4);
+}
+
+static long long elementsOf(const std::vector<int>& dims) {
+    long long count = 1;
+    for (int d : dims) {
+        count *= d > 0 ? d : 1;
+    }
+    return count;
+}
+
+// 调用方不持有 model->lock
+static bool currentShape(MNN_Interpreter* net, MNN_Session* session, std::vector<int>& dims, double& mflops) {
+    MNN_Tensor* input = MNN_Interpreter_getSessionInput(net, session, nullptr);
+    float flops = 0.0f;
+    if (input == nullptr || !MNN_Interpreter_getSessionInfo(net, session, MNN_SESSION_INFO_CODE_FLOPS, &flops)) {
+        return false;
+    }
+    int count = 0;
+    int* shape = MNN_Tensor_Shape(input, &count);
+    if (shape == nullptr) {
+        return false;
+    }
+    dims.assign(shape, shape + count);
+    MNN_Tensor_FreeShape(shape);
+    mflops = flops;
+    return true;
+}
+
+// 调用方持有 model->lock
+static void remember(Candidate& c, const std::vector<int>& dims, double mflops) {
+    c.shape = dims;
+    c.mflops = mflops;
+    c.mflopsByShape[dims] = mflops;
+}
+
+// 形状的 FLOPs：见过的形状直接查表，否则按元素数从最接近的已知形状线性缩放
+static double mflopsFor(const Candidate& c, const std::vector<int>& dims) {
+    auto iter = c.mflopsByShape.find(dims);
+    if (iter != c.mflopsByShape.end()) {
+        return iter->second;
+    }
+    long long elements = elementsOf(dims);
+    double best = -1, bestDistance = 0;
+    for (const auto& known : c.mflopsByShape) {
+        long long knownElements = elementsOf(known.first);
+        double distance = fabs(log((double)elements / knownElements));
+        if (best < 0 || distance < bestDistance) {
+            best = known.second * elements / knownElements;
+            bestDistance = distance;
+        }
+    }
+    return best;
+}
+
+static double predictMs(const MNN_CostModel* model, const Candidate& c, double mflops, double& intercept, double& slope) {
+    intercept = slope = 0;
+    if (mflops < 0) {
+        return -1;
+    }
+    auto bucket = c.buckets.find(bucketOf(mflops));
+    bool haveFit = c.fit.solve(intercept, slope);
+    if (bucket != c.buckets.end() && bucket->second.n >= kBucketMinSamples) {
+        return bucket->second.meanMs;
+    }
+    if (haveFit) {
+        return intercept + slope * mflops;
+    }
+    double pooledIntercept = 0, pooledSlope = 0;
+    if (model->pooled.solve(pooledIntercept, pooledSlope)) {
+        intercept = pooledIntercept;
+        slope = pooledSlope / c.threads;
+        return intercept + slope * mflops;
+    }
+    return -1;
+}
+
+static void estimate(MNN_CostModel* model, const Candidate& c, const int* dims, int dimCount, MNN_CostEstimate* out) {
+    memset(out, 0, sizeof(*out));
+    double mflops = c.mflops;
+    if (dims != nullptr) {
+        mflops = mflopsFor(c, std::vector<int>(dims, dims + dimCount));
+    }
+    out->mflops = mflops;
+    out->threads = c.threads;
+    out->samples = c.samples;
+    out->predictedMs = predictMs(model, c, mflops, out->intercept, out->msPerMFlop);
+    if (out->predictedMs < 0) {
+        out->completionMs = -1;
+        return;
+    }
+    out->completionMs = out->predictedMs * (1 + c.inflight);
+    out->qps = out->predictedMs > 0 ? 1000.0 / out->predictedMs : 0.0;
+    out->qpsPerCore = out->qps / c.threads;
+}
+
+static void record(MNN_CostModel* model, Candidate& c, const std::vector<int>& dims, double mflops, double latencyMs) {
+    remember(c, dims, mflops);
+    c.fit.add(mflops, latencyMs, model->decay);
+    model->pooled.add(mflops / c.threads, latencyMs, model->decay);
+    Bucket& bucket = c.buckets[bucketOf(mflops)];
+    bucket.n = std::min(bucket.n + 1, 1.0 / (1.0 - model->decay + 1e-9));
+    bucket.meanMs += (latencyMs - bucket.meanMs) / bucket.n;
+    c.samples++;
+}
+
+// 取候选的 net 与 session，之后在锁外调用 MNN
+static bool locate(MNN_CostModel* model, int candidate, MNN_Interpreter** net, MNN_Session** session) {
+    std::lock_guard<std::mutex> guard(model->lock);
+    if (candidate < 0 || candidate >= (int)model->candidates.size()) {
+        return false;
+    }
+    *net = model->candidates[candidate].net;
+    *session = model->candidates[candidate].session;
+    return true;
+}
+
+// -------------------------- 接口实现 --------------------------
+struct MNN_CostModel* MNN_CostModel_create(double decay) {
+    auto model = new MNN_CostModel();
+    model->decay = decay > 0 && decay <= 1 ? decay : 0.99;
+    return model;
+}
+
+void MNN_CostModel_destroy(struct MNN_CostModel* model) {
+    delete model;
+}
+
+int MNN_CostModel_addCandidate(struct MNN_CostModel* model, struct MNN_Interpreter* net, struct MNN_Session* session) {
+    if (model == nullptr || net == nullptr || session == nullptr) {
+        return -1;
+    }
+    Candidate c;
+    c.net = net;
+    c.session = session;
+    int threads = 1;
+    if (MNN_Interpreter_getSessionInfo(net, session, MNN_SESSION_INFO_CODE_THREAD_NUMBER, &threads) && threads > 0) {
+        c.threads = threads;
+    }
+    std::vector<int> dims;
+    double mflops = 0;
+    if (currentShape(net, session, dims, mflops)) {
+        remember(c, dims, mflops);
+    }
+    std::lock_guard<std::mutex> guard(model->lock);
+    model->candidates.push_back(c);
+    return (int)model->candidates.size() - 1;
+}
+
+void MNN_CostModel_observe(struct MNN_CostModel* model, int candidate, double latencyMs) {
+    if (model == nullptr || latencyMs < 0) {
+        return;
+    }
+    MNN_Interpreter* net = nullptr;
+    MNN_Session* session = nullptr;
+    std::vector<int> dims;
+    double mflops = 0;
+    if (!locate(model, candidate, &net, &session) || !currentShape(net, session, dims, mflops)) {
+        return;
+    }
+    std::lock_guard<std::mutex> guard(model->lock);
+    record(model, model->candidates[candidate], dims, mflops, latencyMs);
+}
+
+MNN_BOOL MNN_CostModel_refresh(struct MNN_CostModel* model, int candidate) {
+    if (model == nullptr) {
+        return false;
+    }
+    MNN_Interpreter* net = nullptr;
+    MNN_Session* session = nullptr;
+    std::vector<int> dims;
+    double mflops = 0;
+    if (!locate(model, candidate, &net, &session) || !currentShape(net, session, dims, mflops)) {
+        return false;
+    }
+    std::lock_guard<std::mutex> guard(model->lock);
+    remember(model->candidates[candidate], dims, mflops);
+    return true;
+}
+
+MNN_ErrorCode MNN_CostModel_run(struct MNN_CostModel* model, int candidate) {
+    if (model == nullptr) {
+        return MNN_INVALID_VALUE;
+    }
+    MNN_Interpreter* net = nullptr;
+    MNN_Session* session = nullptr;
+    {
+        std::lock_guard<std::mutex> guard(model->lock);
+        if (candidate < 0 || candidate >= (int)model->candidates.size()) {
+            return MNN_INVALID_VALUE;
+        }
+        Candidate& c = model->candidates[candidate];
+        net = c.net;
+        session = c.session;
+        c.inflight++;
+    }
+    auto start = std::chrono::steady_clock::now();
+    MNN_ErrorCode code = MNN_Interpreter_runSession(net, session);
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    std::vector<int> dims;
+    double mflops = 0;
+    bool known = code == MNN_NO_ERROR && currentShape(net, session, dims, mflops);
+    std::lock_guard<std::mutex> guard(model->lock);
+    Candidate& c = model->candidates[candidate];
+    c.inflight--;
+    if (known) {
+        record(model, c, dims, mflops, ms);
+    }
+    return code;
+}
+
+MNN_BOOL MNN_CostModel_predict(struct MNN_CostModel* model, int candidate, const int* dims, int dimCount,
+                               MNN_CostEstimate* estimateOut) {
+    if (model == nullptr || estimateOut == nullptr) {
+        return false;
+    }
+    std::lock_guard<std::mutex> guard(model->lock);
+    if (candidate < 0 || candidate >= (int)model->candidates.size()) {
+        return false;
+    }
+    estimate(model, model->candidates[candidate], dims, dimCount, estimateOut);
+    return estimateOut->predictedMs >= 0;
+}
+
+int MNN_CostModel_select(struct MNN_CostModel* model, const int* dims, int dimCount, double sloMs, MNN_BOOL* meetsSlo,
+                         MNN_CostEstimate* estimateOut) {
+    if (meetsSlo != nullptr) {
+        *meetsSlo = false;
+    }
+    if (model == nullptr) {
+        return -1;
+    }
+    std::lock_guard<std::mutex> guard(model->lock);
+    int cheapest = -1, earliest = -1, idle = -1;
+    double cheapestCost = 0;
+    std::vector<MNN_CostEstimate> estimates(model->candidates.size());
+    for (int i = 0; i < (int)model->candidates.size(); ++i) {
+        Candidate& c = model->candidates[i];
+        MNN_CostEstimate& e = estimates[i];
+        estimate(model, c, dims, dimCount, &e);
+        if (e.predictedMs < 0) {
+            if (idle < 0 || c.inflight < model->candidates[idle].inflight) {
+                idle = i;
+            }
+            continue;
+        }
+        if (earliest < 0 || e.completionMs < estimates[earliest].completionMs) {
+            earliest = i;
+        }
+        double cost = e.predictedMs * c.threads;
+        if ((sloMs <= 0 || e.completionMs <= sloMs) && (cheapest < 0 || cost < cheapestCost)) {
+            cheapest = i;
+            cheapestCost = cost;
+        }
+    }
+    int pick = cheapest >= 0 ? cheapest : (earliest >= 0 ? earliest : idle);
+    if (pick >= 0 && estimateOut != nullptr) {
+        *estimateOut = estimates[pick];
+    }
+    if (meetsSlo != nullptr) {
+        *meetsSlo = cheapest >= 0;
+    }
+    return pick;
+}
@@ -0,0 +1,88 @@
+//
+//  CostModel_c.h
+//  MNN
+//
+//  基于 FLOPs 的延迟模型：对每个候选 Session（不同模型变体、线程数或副本）在线拟合 延迟 = a + b * FLOPs，
+//  FLOPs 取自 MNN_SESSION_INFO_CODE_FLOPS；同一形状桶样本足够时直接用桶内均值，
+//  新 Session 在样本不足时借用按 FLOPs/线程数 汇总的全局拟合。
+//  据此预测新输入形状的延迟，选出满足 SLO 且核时最少的候选，并给出每核 QPS 供扩缩容参考
+//
+
+#ifndef MNN_CostModel_c_h
+#define MNN_CostModel_c_h
+
+#include <stdint.h>
+#include "Interpreter_c.h"
+
+// 导出宏：Windows下导出，其他平台兼容
+#ifdef MNN_C_EXPORTS
+    // 仅当编译 libmnn.dll 时定义 MNN_C_EXPORTS，此时用 dllexport
+    #define MNN_C_API __declspec(dllexport)
+#else
+    #define MNN_C_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct MNN_CostModel MNN_CostModel;
+
+typedef struct MNN_CostEstimate {
+    double predictedMs;     // 单次运行预测延迟，未知时 < 0
+    double completionMs;    // 计入该候选已在运行的请求后的预计完成时间
+    double mflops;          // 该形状的 FLOPs（百万）
+    double qps;             // 单个 Session 连续运行的吞吐
+    double qpsPerCore;      // qps / 线程数
+    int threads;
+    uint64_t samples;       // 该候选已记录的样本数
+    double intercept;       // 拟合参数：延迟 = intercept + msPerMFlop * mflops
+    double msPerMFlop;
+} MNN_CostEstimate;
+
+/**
+ * @param decay forgetting factor of the fit per sample in (0, 1]; <= 0 means 0.99.
+ */
+MNN_C_API struct MNN_CostModel* MNN_CostModel_create(double decay);
+MNN_C_API void MNN_CostModel_destroy(struct MNN_CostModel* model);
+/**
+ * @brief register a session as a candidate; its thread count is read from the session.
+ * @return candidate index.
+ */
+MNN_C_API int MNN_CostModel_addCandidate(struct MNN_CostModel* model, struct MNN_Interpreter* net, struct MNN_Session* session);
+/**
+ * @brief record a latency measured for the candidate's current shape and FLOPs.
+ */
+MNN_C_API void MNN_CostModel_observe(struct MNN_CostModel* model, int candidate, double latencyMs);
+/**
+ * @brief run the candidate's session, timing and recording it.
+ * Runs of one candidate are counted as in flight so selection sees its queue.
+ */
+MNN_C_API MNN_ErrorCode MNN_CostModel_run(struct MNN_CostModel* model, int candidate);
+/**
+ * @brief read the candidate's current shape and FLOPs again; call it after resizing the session.
+ * Runs and observations refresh them too. Prediction and selection only use these cached values.
+ * @return false when the session reports no FLOPs.
+ */
+MNN_C_API MNN_BOOL MNN_CostModel_refresh(struct MNN_CostModel* model, int candidate);
+/**
+ * @brief predict the candidate for a shape of its first input; dims NULL uses the current shape
+ * (as last refreshed).
+ * FLOPs of shapes never resized to are scaled from the nearest known shape by element count.
+ */
+MNN_C_API MNN_BOOL MNN_CostModel_predict(struct MNN_CostModel* model, int candidate, const int* dims, int dimCount,
+                                         MNN_CostEstimate* estimate);
+/**
+ * @brief pick the candidate with the fewest core-milliseconds whose completion time meets sloMs
+ * (sloMs <= 0 means no SLO). When none meets it, the earliest completing candidate is returned and
+ * meetsSlo is set to false. Candidates without any estimate are only picked when nothing else is known.
+ * @return candidate index, or -1 without candidates.
+ */
+MNN_C_API int MNN_CostModel_select(struct MNN_CostModel* model, const int* dims, int dimCount, double sloMs,
+                                   MNN_BOOL* meetsSlo, MNN_CostEstimate* estimate);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MNN_CostModel_c_h */
@@ -0,0 +1,67 @@
+//
+//  CpuAffinity.hpp
+//  MNN
+//
+//  调用线程绑核工具，在不支持线程亲和性的平台上为空操作
+//
+
+#ifndef MNN_CpuAffinity_hpp
+#define MNN_CpuAffinity_hpp
+
+#include <vector>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+// 把调用线程绑定到给定核心，cores 为空时不做任何事
+inline bool pinCurrentThread(const std::vector<int>& cores) {
+#ifdef __linux__
+    if (cores.empty()) {
+        return false;
+    }
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    for (int cpu : cores) {
+        if (cpu >= 0 && cpu < CPU_SETSIZE) {
+            CPU_SET(cpu, &mask);
+        }
+    }
+    return pthread_setaffinity_np(pthread_self(), sizeof(mask), &mask) == 0;
+#else
+    (void)cores;
+    return false;
+#endif
+}
+
+// 在作用域内把调用线程绑定到给定核心，析构时恢复原来的亲和性
+class ScopedAffinity {
+public:
+    explicit ScopedAffinity(const std::vector<int>& cores) {
+#ifdef __linux__
+        if (cores.empty() || pthread_getaffinity_np(pthread_self(), sizeof(mPrevious), &mPrevious) != 0) {
+            return;
+        }
+        mPinned = pinCurrentThread(cores);
+#else
+        (void)cores;
+#endif
+    }
+    ~ScopedAffinity() {
+#ifdef __linux__
+        if (mPinned) {
+            pthread_setaffinity_np(pthread_self(), sizeof(mPrevious), &mPrevious);
+        }
+#endif
+    }
+    ScopedAffinity(const ScopedAffinity&) = delete;
+    ScopedAffinity& operator=(const ScopedAffinity&) = delete;
+
+private:
+#ifdef __linux__
+    cpu_set_t mPrevious;
+#endif
+    bool mPinned = false;
+};
+
+#endif /* MNN_CpuAffinity_hpp */
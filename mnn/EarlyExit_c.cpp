@@ -0,0 +1,185 @@
+//
+//  EarlyExit_c.cpp
+//  MNN
+//
+
+#include "EarlyExit_c.h"
+#include <math.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "ScheduleConfigCopy.hpp"
+
+struct ExitState {
+    std::string tensor;
+    float threshold = 1.0f;
+    bool logits = false;
+    MNN_ExitPredicate predicate = nullptr;
+    void* userData = nullptr;
+    const MNN_Tensor* resolved = nullptr;   // 本次运行中该张量在 Session 里的指针
+};
+
+struct MNN_EarlyExit {
+    MNN_Interpreter* net = nullptr;
+    MNN_Session* session = nullptr;
+    std::vector<ExitState> exits;
+    // 单次运行的状态，同一 Session 不会并发运行
+    int taken = -1;
+    float score = 0.0f;
+};
+
+// -------------------------- 内部工具 --------------------------
+// 每个样本最后一维（softmax 后）的最大值，返回所有样本中的最小者
+static bool confidence(const MNN_Tensor* host, bool logits, float* result) {
+    halide_type_t type;
+    MNN_Tensor_GetHalideType(host, &type);
+    if (type.code != halide_type_float || type.bits != 32) {
+        return false;
+    }
+    int dimCount = 0;
+    int* shape = MNN_Tensor_Shape(host, &dimCount);
+    int classes = dimCount > 0 ? shape[dimCount - 1] : 0;
+    MNN_Tensor_FreeShape(shape);
+    int total = MNN_Tensor_Size(host) / (int)sizeof(float);
+    if (classes <= 0 || total < classes) {
+        return false;
+    }
+    const float* data = static_cast<const float*>(MNN_Tensor_Host(host));
+    float lowest = 1.0f;
+    for (int row = 0; row + classes <= total; row += classes) {
+        const float* p = data + row;
+        float maxValue = p[0];
+        for (int i = 1; i < classes; ++i) {
+            maxValue = p[i] > maxValue ? p[i] : maxValue;
+        }
+        float best = maxValue;
+        if (logits) {
+            // 最大类的概率 = 1 / sum(exp(x - max))
+            float sum = 0.0f;
+            for (int i = 0; i < classes; ++i) {
+                sum += expf(p[i] - maxValue);
+            }
+            best = 1.0f / sum;
+        }
+        lowest = best < lowest ? best : lowest;
+    }
+    *result = lowest;
+    return true;
+}
+
+static bool evaluate(MNN_EarlyExit* earlyExit, int index, const MNN_Tensor* tensor) {
+    const ExitState& exit = earlyExit->exits[index];
+    MNN_Tensor* host = MNN_Tensor_CreateHostTensorFromDevice(tensor, true);
+    if (host == nullptr) {
+        return false;
+    }
+    float score = 0.0f;
+    bool stop = false;
+    if (exit.predicate != nullptr) {
+        stop = exit.predicate(host, &score, exit.userData) != 0;
+    } else if (confidence(host, exit.logits, &score)) {
+        stop = score >= exit.threshold;
+    }
+    MNN_Tensor_Destroy(host);
+    if (stop) {
+        earlyExit->taken = index;
+        earlyExit->score = score;
+    }
+    return stop;
+}
+
+static int beforeOp(const MNN_Tensor**, size_t, const char*, void*) {
+    return 1;
+}
+
+// 返回 0 时 MNN 停止执行剩余算子
+static int afterOp(const MNN_Tensor** tensors, size_t tensorCount, const char* opName, void* userData) {
+    auto earlyExit = static_cast<MNN_EarlyExit*>(userData);
+    for (size_t e = 0; e < earlyExit->exits.size(); ++e) {
+        const ExitState& exit = earlyExit->exits[e];
+        for (size_t i = 0; i < tensorCount; ++i) {
+            if (tensors[i] == exit.resolved) {
+                return evaluate(earlyExit, (int)e, tensors[i]) ? 0 : 1;
+            }
+        }
+        // 几何计算改写后输出可能不是同一个张量对象，退而按算子名匹配
+        if (tensorCount > 0 && opName != nullptr && exit.tensor == opName) {
+            return evaluate(earlyExit, (int)e, tensors[0]) ? 0 : 1;
+        }
+    }
+    return 1;
+}
+
+// -------------------------- 接口实现 --------------------------
+struct MNN_EarlyExit* MNN_EarlyExit_create(struct MNN_Interpreter* net, const struct MNN_ScheduleConfig* config,
+                                           const MNN_ExitPoint* exits, int exitCount) {
+    if (net == nullptr || config == nullptr || exits == nullptr || exitCount <= 0) {
+        return nullptr;
+    }
+    ScheduleConfigCopy copy(*config);
+    auto earlyExit = new MNN_EarlyExit();
+    earlyExit->net = net;
+    for (int i = 0; i < exitCount; ++i) {
+        if (exits[i].tensor == nullptr) {
+            delete earlyExit;
+            return nullptr;
+        }
+        ExitState exit;
+        exit.tensor = exits[i].tensor;
+        exit.threshold = exits[i].threshold;
+        exit.logits = exits[i].logits != 0;
+        exit.predicate = exits[i].predicate;
+        exit.userData = exits[i].userData;
+        earlyExit->exits.push_back(exit);
+        copy.addSaveTensor(exits[i].tensor);
+    }
+    earlyExit->session = MNN_Interpreter_createSession(net, copy.get());
+    if (earlyExit->session == nullptr) {
+        delete earlyExit;
+        return nullptr;
+    }
+    return earlyExit;
+}
+
+void MNN_EarlyExit_destroy(struct MNN_EarlyExit* earlyExit) {
+    if (earlyExit == nullptr) {
+        return;
+    }
+    MNN_Interpreter_releaseSession(earlyExit->net, earlyExit->session);
+    delete earlyExit;
+}
+
+struct MNN_Session* MNN_EarlyExit_session(struct MNN_EarlyExit* earlyExit) {
+    return earlyExit != nullptr ? earlyExit->session : nullptr;
+}
+
+void MNN_EarlyExit_setThreshold(struct MNN_EarlyExit* earlyExit, int index, float threshold) {
+    if (earlyExit == nullptr || index < 0 || index >= (int)earlyExit->exits.size()) {
+        return;
+    }
+    earlyExit->exits[index].threshold = threshold;
+}
+
+MNN_ErrorCode MNN_EarlyExit_run(struct MNN_EarlyExit* earlyExit, int* exitIndex, float* score) {
+    if (earlyExit == nullptr) {
+        return MNN_INVALID_VALUE;
+    }
+    // resize 后张量对象可能变化，每次运行重新解析
+    for (auto& exit : earlyExit->exits) {
+        exit.resolved = MNN_Interpreter_getSessionOutput(earlyExit->net, earlyExit->session, exit.tensor.c_str());
+    }
+    earlyExit->taken = -1;
+    earlyExit->score = 0.0f;
+    MNN_ErrorCode code = MNN_Interpreter_runSessionWithCallBack(earlyExit->net, earlyExit->session, beforeOp, afterOp,
+                                                                true, earlyExit);
+    if (code == MNN_CALL_BACK_STOP && earlyExit->taken >= 0) {
+        code = MNN_NO_ERROR;
+    }
+    if (exitIndex != nullptr) {
+        *exitIndex = earlyExit->taken;
+    }
+    if (score != nullptr) {
+        *score = earlyExit->score;
+    }
+    return code;
+}
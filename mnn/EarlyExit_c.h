@@ -0,0 +1,65 @@
+//
+//  EarlyExit_c.h
+//  MNN
+//
+//  级联/提前退出：为带辅助分类头的模型声明若干退出张量与判定条件，
+//  在产生该张量的算子执行完后立即在 C++ 中判定，满足时停止执行剩余算子
+//
+
+#ifndef MNN_EarlyExit_c_h
+#define MNN_EarlyExit_c_h
+
+#include "Interpreter_c.h"
+
+// 导出宏：Windows下导出，其他平台兼容
+#ifdef MNN_C_EXPORTS
+    // 仅当编译 libmnn.dll 时定义 MNN_C_EXPORTS，此时用 dllexport
+    #define MNN_C_API __declspec(dllexport)
+#else
+    #define MNN_C_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct MNN_EarlyExit MNN_EarlyExit;
+
+/**
+ * @brief user predicate on an exit tensor, called on the inference thread right after the producing op.
+ * @param tensor host copy of the exit tensor, valid only during the call.
+ * @param score optional output reported back by MNN_EarlyExit_run.
+ * @return nonzero to stop the run here.
+ */
+typedef int (*MNN_ExitPredicate)(const MNN_Tensor* tensor, float* score, void* userData);
+
+typedef struct MNN_ExitPoint {
+    const char* tensor;             // 中间张量名，通常与产生它的算子同名
+    float threshold;                // predicate 为 NULL 时：每个样本最后一维的最大概率都 >= threshold 则退出
+    MNN_BOOL logits;                // 为真时先对最后一维做 softmax
+    MNN_ExitPredicate predicate;    // 非 NULL 时替代阈值判定
+    void* userData;
+} MNN_ExitPoint;
+
+/**
+ * @brief create a session of net whose exit tensors are kept (added to saveTensors) and can be read
+ * with MNN_Interpreter_getSessionOutput after an early exit. Exits are checked in the order they are produced.
+ */
+MNN_C_API struct MNN_EarlyExit* MNN_EarlyExit_create(struct MNN_Interpreter* net, const struct MNN_ScheduleConfig* config,
+                                                     const MNN_ExitPoint* exits, int exitCount);
+MNN_C_API void MNN_EarlyExit_destroy(struct MNN_EarlyExit* earlyExit);
+MNN_C_API struct MNN_Session* MNN_EarlyExit_session(struct MNN_EarlyExit* earlyExit);
+MNN_C_API void MNN_EarlyExit_setThreshold(struct MNN_EarlyExit* earlyExit, int index, float threshold);
+/**
+ * @brief run the session, stopping at the first satisfied exit.
+ * @param exitIndex optional, index of the exit taken or -1 when the whole graph ran.
+ * @param score optional, confidence of the exit taken (max probability, or what the predicate reported).
+ * @return MNN_NO_ERROR both for an early exit and a full run.
+ */
+MNN_C_API MNN_ErrorCode MNN_EarlyExit_run(struct MNN_EarlyExit* earlyExit, int* exitIndex, float* score);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MNN_EarlyExit_c_h */
@@ -36,7 +36,12 @@ typedef enum {
     MNN_FILE_RESIZE_FAILED = 34,
     MNN_FILE_SEEK_FAILED   = 35,
     MNN_FILE_NOT_EXIST     = 36,
-    MNN_FILE_UNMAP_FAILED  = 37
+    MNN_FILE_UNMAP_FAILED  = 37,
+
+    // Binding resource error
+    MNN_RESOURCE_EXHAUSTED = 40,
+    MNN_DEADLINE_EXCEEDED  = 41,
+    MNN_CANCELLED          = 42
 } MNN_ErrorCode;
 
 #endif /* MNN_ErrorCode_c_h */
\ No newline at end of file
@@ -0,0 +1,284 @@
+//
+//  Executor_c.cpp
+//  MNN
+//
+
+#include "Executor_c.h"
+#include <stdint.h>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct Task {
+    MNN_TaskGroup* group = nullptr;
+    std::function<MNN_ErrorCode()> body;
+    int permits = 1;
+};
+
+struct Worker {
+    std::mutex lock;
+    std::deque<Task*> tasks;    // 本线程从尾部取（后进先出，缓存友好），窃取者从头部取
+    std::thread thread;
+};
+
+// 按取号顺序发放许可：大任务不会被源源不断的小任务饿死
+struct PermitPool {
+    std::mutex lock;
+    std::condition_variable changed;
+    int total = 0;
+    int available = 0;
+    int peak = 0;
+    uint64_t nextTicket = 0;
+    uint64_t serving = 0;
+};
+
+} // namespace
+
+struct MNN_Executor {
+    std::vector<Worker*> workers;
+    PermitPool permits;
+    std::atomic<int> queued{0};
+    std::atomic<unsigned> nextWorker{0};
+    std::atomic<bool> stopping{false};
+    std::mutex sleepLock;
+    std::condition_variable wake;
+    std::atomic<int> sleepers{0};
+    std::atomic<uint64_t> tasks{0};
+    std::atomic<uint64_t> steals{0};
+    std::atomic<uint64_t> permitWaits{0};
+};
+
+struct MNN_TaskGroup {
+    MNN_Executor* executor = nullptr;
+    std::mutex lock;
+    std::condition_variable finished;
+    int pending = 0;
+    MNN_ErrorCode error = MNN_NO_ERROR;
+};
+
+// 当前线程所属的执行器与工作线程下标，任务里再提交时直接压入本线程队列
+static thread_local MNN_Executor* tCurrentExecutor = nullptr;
+static thread_local int tCurrentWorker = -1;
+
+// -------------------------- 内部工具 --------------------------
+static void acquirePermits(MNN_Executor* executor, int count) {
+    PermitPool& pool = executor->permits;
+    std::unique_lock<std::mutex> guard(pool.lock);
+    uint64_t ticket = pool.nextTicket++;
+    auto ready = [&]() { return pool.serving == ticket && pool.available >= count; };
+    if (!ready()) {
+        executor->permitWaits.fetch_add(1, std::memory_order_relaxed);
+        pool.changed.wait(guard, ready);
+    }
+    pool.available -= count;
+    pool.serving++;
+    pool.peak = std::max(pool.peak, pool.total - pool.available);
+    pool.changed.notify_all();
+}
+
+static void releasePermits(MNN_Executor* executor, int count) {
+    PermitPool& pool = executor->permits;
+    std::lock_guard<std::mutex> guard(pool.lock);
+    pool.available += count;
+    pool.changed.notify_all();
+}
+
+static void push(MNN_Executor* executor, Task* task) {
+    int index = tCurrentExecutor == executor ? tCurrentWorker
+                                             : (int)(executor->nextWorker.fetch_add(1) % executor->workers.size());
+    Worker* worker = executor->workers[index];
+    {
+        std::lock_guard<std::mutex> guard(worker->lock);
+        worker->tasks.push_back(task);
+    }
+    executor->queued.fetch_add(1);
+    if (executor->sleepers.load() > 0) {
+        std::lock_guard<std::mutex> guard(executor->sleepLock);
+        executor->wake.notify_one();
+    }
+}
+
+static Task* take(MNN_Executor* executor, int self) {
+    Worker* own = executor->workers[self];
+    {
+        std::lock_guard<std::mutex> guard(own->lock);
+        if (!own->tasks.empty()) {
+            Task* task = own->tasks.back();
+            own->tasks.pop_back();
+            executor->queued.fetch_sub(1);
+            return task;
+        }
+    }
+    int count = (int)executor->workers.size();
+    for (int i = 1; i < count; ++i) {
+        Worker* victim = executor->workers[(self + i) % count];
+        std::lock_guard<std::mutex> guard(victim->lock);
+        if (!victim->tasks.empty()) {
+            Task* task = victim->tasks.front();
+            victim->tasks.pop_front();
+            executor->queued.fetch_sub(1);
+            executor->steals.fetch_add(1, std::memory_order_relaxed);
+            return task;
+        }
+    }
+    return nullptr;
+}
+
+// 持锁通知：等待方醒来后可能立即销毁任务组
+static void finish(MNN_TaskGroup* group, MNN_ErrorCode code) {
+    std::lock_guard<std::mutex> guard(group->lock);
+    if (code != MNN_NO_ERROR && group->error == MNN_NO_ERROR) {
+        group->error = code;
+    }
+    if (--group->pending == 0) {
+        group->finished.notify_all();
+    }
+}
+
+static void workerLoop(MNN_Executor* executor, int self) {
+    tCurrentExecutor = executor;
+    tCurrentWorker = self;
+    for (;;) {
+        Task* task = take(executor, self);
+        if (task == nullptr) {
+            std::unique_lock<std::mutex> guard(executor->sleepLock);
+            executor->sleepers.fetch_add(1);
+            while (executor->queued.load() == 0 && !executor->stopping.load()) {
+                executor->wake.wait(guard);
+            }
+            executor->sleepers.fetch_sub(1);
+            if (executor->queued.load() == 0 && executor->stopping.load()) {
+                return;
+            }
+            continue;
+        }
+        acquirePermits(executor, task->permits);
+        MNN_ErrorCode code = task->body();
+        releasePermits(executor, task->permits);
+        executor->tasks.fetch_add(1, std::memory_order_relaxed);
+        finish(task->group, code);
+        delete task;
+    }
+}
+
+static void submitTask(MNN_TaskGroup* group, std::function<MNN_ErrorCode()> body, int permits) {
+    MNN_Executor* executor = group->executor;
+    auto task = new Task();
+    task->group = group;
+    task->body = std::move(body);
+    task->permits = std::max(1, std::min(permits, executor->permits.total));
+    {
+        std::lock_guard<std::mutex> guard(group->lock);
+        group->pending++;
+    }
+    push(executor, task);
+}
+
+// -------------------------- 接口实现 --------------------------
+struct MNN_Executor* MNN_Executor_create(int threads) {
+    if (threads <= 0) {
+        threads = (int)std::thread::hardware_concurrency();
+    }
+    threads = threads > 0 ? threads : 1;
+    auto executor = new MNN_Executor();
+    executor->permits.total = threads;
+    executor->permits.available = threads;
+    for (int i = 0; i < threads; ++i) {
+        executor->workers.push_back(new Worker());
+    }
+    for (int i = 0; i < threads; ++i) {
+        executor->workers[i]->thread = std::thread(workerLoop, executor, i);
+    }
+    return executor;
+}
+
+void MNN_Executor_destroy(struct MNN_Executor* executor) {
+    if (executor == nullptr) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> guard(executor->sleepLock);
+        executor->stopping.store(true);
+    }
+    executor->wake.notify_all();
+    // 先全部 join 再释放：退出前的工作线程仍可能扫描其他线程的队列
+    for (auto worker : executor->workers) {
+        worker->thread.join();
+    }
+    for (auto worker : executor->workers) {
+        delete worker;
+    }
+    delete executor;
+}
+
+void MNN_Executor_getStats(struct MNN_Executor* executor, MNN_ExecutorStats* stats) {
+    if (executor == nullptr || stats == nullptr) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> guard(executor->permits.lock);
+        stats->threads = executor->permits.total;
+        stats->permitsInUse = executor->permits.total - executor->permits.available;
+        stats->peakPermitsInUse = executor->permits.peak;
+    }
+    stats->tasks = executor->tasks.load(std::memory_order_relaxed);
+    stats->steals = executor->steals.load(std::memory_order_relaxed);
+    stats->permitWaits = executor->permitWaits.load(std::memory_order_relaxed);
+}
+
+struct MNN_TaskGroup* MNN_Executor_createGroup(struct MNN_Executor* executor) {
+    if (executor == nullptr) {
+        return nullptr;
+    }
+    auto group = new MNN_TaskGroup();
+    group->executor = executor;
+    return group;
+}
+
+void MNN_TaskGroup_destroy(struct MNN_TaskGroup* group) {
+    delete group;
+}
+
+MNN_ErrorCode MNN_TaskGroup_wait(struct MNN_TaskGroup* group) {
+    if (group == nullptr) {
+        return MNN_INVALID_VALUE;
+    }
+    std::unique_lock<std::mutex> guard(group->lock);
+    group->finished.wait(guard, [group]() { return group->pending == 0; });
+    MNN_ErrorCode error = group->error;
+    group->error = MNN_NO_ERROR;
+    return error;
+}
+
+void MNN_TaskGroup_submit(struct MNN_TaskGroup* group, MNN_TaskFunc func, void* userData, int permits) {
+    if (group == nullptr || func == nullptr) {
+        return;
+    }
+    submitTask(group, [func, userData]() { return func(userData); }, permits);
+}
+
+void MNN_TaskGroup_submitConvert(struct MNN_TaskGroup* group, const struct MNN_ImageProcess* process,
+                                 const uint8_t* source, int iw, int ih, int stride, struct MNN_Tensor* dest) {
+    if (group == nullptr || process == nullptr || source == nullptr || dest == nullptr) {
+        return;
+    }
+    submitTask(group, [=]() { return MNN_ImageProcess_convert(process, source, iw, ih, stride, dest); }, 1);
+}
+
+void MNN_TaskGroup_submitRun(struct MNN_TaskGroup* group, const struct MNN_Interpreter* net,
+                             struct MNN_Session* session) {
+    if (group == nullptr || net == nullptr || session == nullptr) {
+        return;
+    }
+    int threads = 1;
+    MNN_Interpreter_getSessionInfo(const_cast<MNN_Interpreter*>(net), session, MNN_SESSION_INFO_CODE_THREAD_NUMBER,
+                                   &threads);
+    submitTask(group, [=]() { return MNN_Interpreter_runSession(net, session); }, threads);
+}
@@ -0,0 +1,86 @@
+//
+//  Executor_c.h
+//  MNN
+//
+//  统一线程预算的工作窃取执行器：预处理（ImageProcess 转换）与推理（runSession）作为任务提交到同一组工作线程，
+//  每个任务运行前从许可池取许可：预处理取 1 个，推理按 Session 的线程数取（MNN 线程池的其余线程也算在内），
+//  许可总数即线程预算，因此混合负载能占满核心而不会超额订阅
+//
+
+#ifndef MNN_Executor_c_h
+#define MNN_Executor_c_h
+
+#include <stdint.h>
+#include "Interpreter_c.h"
+#include "ImageProcess_c.h"
+
+// 导出宏：Windows下导出，其他平台兼容
+#ifdef MNN_C_EXPORTS
+    // 仅当编译 libmnn.dll 时定义 MNN_C_EXPORTS，此时用 dllexport
+    #define MNN_C_API __declspec(dllexport)
+#else
+    #define MNN_C_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct MNN_Executor MNN_Executor;
+// 一组任务，用于等待完成并取得第一个错误
+typedef struct MNN_TaskGroup MNN_TaskGroup;
+
+typedef MNN_ErrorCode (*MNN_TaskFunc)(void* userData);
+
+typedef struct MNN_ExecutorStats {
+    int threads;                // 线程预算，即许可总数
+    int permitsInUse;
+    int peakPermitsInUse;
+    uint64_t tasks;             // 已完成的任务数
+    uint64_t steals;            // 从其他工作线程偷来的任务数
+    uint64_t permitWaits;       // 因许可不足而等待的次数
+} MNN_ExecutorStats;
+
+/**
+ * @brief start the workers.
+ * @param threads thread budget shared by all tasks, <= 0 means the number of online cores.
+ */
+MNN_C_API struct MNN_Executor* MNN_Executor_create(int threads);
+/**
+ * @brief finish the submitted tasks and stop the workers.
+ */
+MNN_C_API void MNN_Executor_destroy(struct MNN_Executor* executor);
+MNN_C_API void MNN_Executor_getStats(struct MNN_Executor* executor, MNN_ExecutorStats* stats);
+
+MNN_C_API struct MNN_TaskGroup* MNN_Executor_createGroup(struct MNN_Executor* executor);
+/**
+ * @brief free a group after its tasks have finished.
+ */
+MNN_C_API void MNN_TaskGroup_destroy(struct MNN_TaskGroup* group);
+/**
+ * @brief block until every task of the group has finished. Must not be called from inside a task.
+ * @return the first error reported by a task of the group since the last wait.
+ */
+MNN_C_API MNN_ErrorCode MNN_TaskGroup_wait(struct MNN_TaskGroup* group);
+
+/**
+ * @brief run func(userData) on the executor holding permits permits (clamped to 1..threads).
+ */
+MNN_C_API void MNN_TaskGroup_submit(struct MNN_TaskGroup* group, MNN_TaskFunc func, void* userData, int permits);
+/**
+ * @brief MNN_ImageProcess_convert as a single-permit task. The source must stay valid until wait,
+ * and one image process must not be used by two tasks at the same time.
+ */
+MNN_C_API void MNN_TaskGroup_submitConvert(struct MNN_TaskGroup* group, const struct MNN_ImageProcess* process,
+                                           const uint8_t* source, int iw, int ih, int stride, struct MNN_Tensor* dest);
+/**
+ * @brief run the session as a task holding as many permits as the session's thread count.
+ */
+MNN_C_API void MNN_TaskGroup_submitRun(struct MNN_TaskGroup* group, const struct MNN_Interpreter* net,
+                                       struct MNN_Session* session);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MNN_Executor_c_h */
@@ -0,0 +1,300 @@
+//
+//  Graph_c.cpp
+//  MNN
+//
+
+#include "Graph_c.h"
+#include "Tensor_c.h"
+#include <string.h>
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct Edge {
+    int from = 0;
+    int to = 0;
+    std::string output;
+    std::string input;
+    MNN_Tensor* source = nullptr;
+    MNN_Tensor* target = nullptr;
+    MNN_GraphEdgeMode mode = MNN_GRAPH_EDGE_NONE;
+};
+
+struct Node {
+    MNN_Interpreter* net = nullptr;
+    MNN_Session* session = nullptr;
+    std::vector<int> inputs;        // 入边下标
+    std::vector<int> consumers;     // 下游节点，按边去重
+    MNN_ErrorCode status = MNN_NO_ERROR;
+};
+
+// 一次运行的调度状态：pending 为各节点尚未完成的上游数
+struct Run {
+    std::mutex lock;
+    std::condition_variable finished;
+    std::vector<int> pending;
+    std::vector<std::thread> threads;
+    int done = 0;
+};
+
+} // namespace
+
+struct MNN_Graph {
+    std::vector<Node> nodes;
+    std::vector<Edge> edges;
+    std::vector<int> roots;
+    bool prepared = false;
+};
+
+// -------------------------- 内部工具 --------------------------
+static bool sameShape(const MNN_Tensor* a, const MNN_Tensor* b) {
+    int countA = 0, countB = 0;
+    int* shapeA = MNN_Tensor_Shape(a, &countA);
+    int* shapeB = MNN_Tensor_Shape(b, &countB);
+    bool same = shapeA != nullptr && shapeB != nullptr && countA == countB && std::equal(shapeA, shapeA + countA, shapeB);
+    MNN_Tensor_FreeShape(shapeA);
+    MNN_Tensor_FreeShape(shapeB);
+    return same;
+}
+
+// 把下游输入改成上游输出的形状，返回是否改动
+static bool followShape(MNN_Interpreter* net, const Edge& edge) {
+    if (sameShape(edge.source, edge.target)) {
+        return false;
+    }
+    int count = 0;
+    int* shape = MNN_Tensor_Shape(edge.source, &count);
+    if (shape == nullptr) {
+        return false;
+    }
+    MNN_Interpreter_resizeTensor(net, edge.target, shape, count);
+    MNN_Tensor_FreeShape(shape);
+    return true;
+}
+
+static bool transfer(Edge& edge) {
+    void* src = MNN_Tensor_Host(edge.source);
+    void* dst = MNN_Tensor_Host(edge.target);
+    halide_type_t srcType, dstType;
+    MNN_Tensor_GetHalideType(edge.source, &srcType);
+    MNN_Tensor_GetHalideType(edge.target, &dstType);
+    size_t size = MNN_Tensor_USize(edge.source);
+    if (src != nullptr && dst != nullptr && srcType.code == dstType.code && srcType.bits == dstType.bits &&
+        MNN_Tensor_GetDimensionType(edge.source) == MNN_Tensor_GetDimensionType(edge.target) &&
+        size == MNN_Tensor_USize(edge.target)) {
+        memcpy(dst, src, size);
+        edge.mode = MNN_GRAPH_EDGE_MEMCPY;
+        return true;
+    }
+    if (src != nullptr) {
+        edge.mode = MNN_GRAPH_EDGE_CONVERT;
+        return MNN_Tensor_CopyFromHostTensor(edge.target, edge.source);
+    }
+    MNN_Tensor* host = MNN_Tensor_CreateHostTensorFromDevice(edge.source, true);
+    if (host == nullptr) {
+        return false;
+    }
+    bool ok = MNN_Tensor_CopyFromHostTensor(edge.target, host);
+    MNN_Tensor_Destroy(host);
+    edge.mode = MNN_GRAPH_EDGE_STAGED;
+    return ok;
+}
+
+static MNN_ErrorCode execute(MNN_Graph* graph, int index) {
+    Node& node = graph->nodes[index];
+    for (int e : node.inputs) {
+        MNN_ErrorCode upstream = graph->nodes[graph->edges[e].from].status;
+        if (upstream != MNN_NO_ERROR) {
+            return upstream;
+        }
+    }
+    // 上游输出形状变了（如检测框数量）就先改下游输入再整体 resize 一次
+    bool resized = false;
+    for (int e : node.inputs) {
+        resized = followShape(node.net, graph->edges[e]) || resized;
+    }
+    if (resized) {
+        MNN_Interpreter_resizeSession(node.net, node.session);
+    }
+    for (int e : node.inputs) {
+        if (!transfer(graph->edges[e])) {
+            return MNN_INVALID_VALUE;
+        }
+    }
+    return MNN_Interpreter_runSession(node.net, node.session);
+}
+
+// 执行 index 后把就绪的下游接着在本线程执行，多出来的就绪节点各开一个线程，分支因此并发
+static void runFrom(MNN_Graph* graph, Run* run, int index) {
+    while (index >= 0) {
+        graph->nodes[index].status = execute(graph, index);
+        std::vector<int> ready;
+        {
+            std::lock_guard<std::mutex> guard(run->lock);
+            for (int consumer : graph->nodes[index].consumers) {
+                if (--run->pending[consumer] == 0) {
+                    ready.push_back(consumer);
+                }
+            }
+            for (size_t i = 1; i < ready.size(); ++i) {
+                run->threads.emplace_back(runFrom, graph, run, ready[i]);
+            }
+            run->done++;
+        }
+        if (ready.empty()) {
+            run->finished.notify_all();
+        }
+        index = ready.empty() ? -1 : ready[0];
+    }
+}
+
+// -------------------------- 接口实现 --------------------------
+struct MNN_Graph* MNN_Graph_create() {
+    return new MNN_Graph();
+}
+
+void MNN_Graph_destroy(struct MNN_Graph* graph) {
+    delete graph;
+}
+
+int MNN_Graph_addNode(struct MNN_Graph* graph, struct MNN_Interpreter* net, struct MNN_Session* session) {
+    if (graph == nullptr || net == nullptr || session == nullptr) {
+        return -1;
+    }
+    Node node;
+    node.net = net;
+    node.session = session;
+    graph->nodes.push_back(node);
+    graph->prepared = false;
+    return (int)graph->nodes.size() - 1;
+}
+
+int MNN_Graph_connect(struct MNN_Graph* graph, int from, const char* output, int to, const char* input) {
+    if (graph == nullptr || output == nullptr || input == nullptr || from < 0 || to < 0 ||
+        from >= (int)graph->nodes.size() || to >= (int)graph->nodes.size() || from == to) {
+        return -1;
+    }
+    Edge edge;
+    edge.from = from;
+    edge.to = to;
+    edge.output = output;
+    edge.input = input;
+    graph->edges.push_back(edge);
+    graph->prepared = false;
+    return (int)graph->edges.size() - 1;
+}
+
+MNN_ErrorCode MNN_Graph_prepare(struct MNN_Graph* graph) {
+    if (graph == nullptr || graph->nodes.empty()) {
+        return MNN_INVALID_VALUE;
+    }
+    graph->prepared = false;
+    for (auto& node : graph->nodes) {
+        node.inputs.clear();
+        node.consumers.clear();
+    }
+    std::vector<int> indegree(graph->nodes.size(), 0);
+    for (int e = 0; e < (int)graph->edges.size(); ++e) {
+        Edge& edge = graph->edges[e];
+        Node& producer = graph->nodes[edge.from];
+        Node& consumer = graph->nodes[edge.to];
+        edge.source = MNN_Interpreter_getSessionOutput(producer.net, producer.session, edge.output.c_str());
+        edge.target = MNN_Interpreter_getSessionInput(consumer.net, consumer.session, edge.input.c_str());
+        if (edge.source == nullptr || edge.target == nullptr) {
+            return MNN_INVALID_VALUE;
+        }
+        consumer.inputs.push_back(e);
+        if (std::find(producer.consumers.begin(), producer.consumers.end(), edge.to) == producer.consumers.end()) {
+            producer.consumers.push_back(edge.to);
+            indegree[edge.to]++;
+        }
+    }
+    // Kahn 拓扑序：检查无环，并按序把形状从上游传到下游
+    graph->roots.clear();
+    std::vector<int> order;
+    std::vector<int> remaining = indegree;
+    for (int i = 0; i < (int)graph->nodes.size(); ++i) {
+        if (remaining[i] == 0) {
+            graph->roots.push_back(i);
+            order.push_back(i);
+        }
+    }
+    for (size_t i = 0; i < order.size(); ++i) {
+        for (int consumer : graph->nodes[order[i]].consumers) {
+            if (--remaining[consumer] == 0) {
+                order.push_back(consumer);
+            }
+        }
+    }
+    if (order.size() != graph->nodes.size()) {
+        return MNN_INVALID_VALUE;
+    }
+    for (int index : order) {
+        Node& node = graph->nodes[index];
+        bool resized = false;
+        for (int e : node.inputs) {
+            resized = followShape(node.net, graph->edges[e]) || resized;
+        }
+        if (resized) {
+            MNN_Interpreter_resizeSession(node.net, node.session);
+        }
+    }
+    graph->prepared = true;
+    return MNN_NO_ERROR;
+}
+
+MNN_ErrorCode MNN_Graph_run(struct MNN_Graph* graph) {
+    if (graph == nullptr || !graph->prepared) {
+        return MNN_INVALID_VALUE;
+    }
+    Run run;
+    run.pending.assign(graph->nodes.size(), 0);
+    for (auto& node : graph->nodes) {
+        for (int consumer : node.consumers) {
+            run.pending[consumer]++;
+        }
+    }
+    for (auto& edge : graph->edges) {
+        edge.mode = MNN_GRAPH_EDGE_NONE;
+    }
+    {
+        std::lock_guard<std::mutex> guard(run.lock);
+        for (size_t i = 1; i < graph->roots.size(); ++i) {
+            run.threads.emplace_back(runFrom, graph, &run, graph->roots[i]);
+        }
+    }
+    runFrom(graph, &run, graph->roots[0]);
+    {
+        std::unique_lock<std::mutex> guard(run.lock);
+        run.finished.wait(guard, [&]() { return run.done == (int)graph->nodes.size(); });
+    }
+    // 全部节点完成后不会再有新线程加入
+    for (auto& thread : run.threads) {
+        thread.join();
+    }
+    for (auto& node : graph->nodes) {
+        if (node.status != MNN_NO_ERROR) {
+            return node.status;
+        }
+    }
+    return MNN_NO_ERROR;
+}
+
+MNN_ErrorCode MNN_Graph_nodeStatus(struct MNN_Graph* graph, int node) {
+    if (graph == nullptr || node < 0 || node >= (int)graph->nodes.size()) {
+        return MNN_INVALID_VALUE;
+    }
+    return graph->nodes[node].status;
+}
+
+MNN_GraphEdgeMode MNN_Graph_edgeMode(struct MNN_Graph* graph, int edge) {
+    if (graph == nullptr || edge < 0 || edge >= (int)graph->edges.size()) {
+        return MNN_GRAPH_EDGE_NONE;
+    }
+    return graph->edges[edge].mode;
+}
@@ -0,0 +1,75 @@
+//
+//  Graph_c.h
+//  MNN
+//
+//  多模型有向无环图：把若干 Session 的输出按名字接到其他 Session 的输入，
+//  一次调用在原生侧按依赖顺序执行，互不依赖的分支并发运行，
+//  张量在 C++ 内直接交接：类型、布局与大小一致时只做一次内存拷贝，否则交给 MNN 做布局转换
+//
+
+#ifndef MNN_Graph_c_h
+#define MNN_Graph_c_h
+
+#include "Interpreter_c.h"
+
+// 导出宏：Windows下导出，其他平台兼容
+#ifdef MNN_C_EXPORTS
+    // 仅当编译 libmnn.dll 时定义 MNN_C_EXPORTS，此时用 dllexport
+    #define MNN_C_API __declspec(dllexport)
+#else
+    #define MNN_C_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct MNN_Graph MNN_Graph;
+
+typedef enum MNN_GraphEdgeMode {
+    MNN_GRAPH_EDGE_NONE = 0,        // 尚未传递
+    MNN_GRAPH_EDGE_MEMCPY = 1,      // 两端都在主机内存且类型、布局、大小一致，直接拷贝
+    MNN_GRAPH_EDGE_CONVERT = 2,     // 源在主机内存，由 MNN 拷贝并转换布局或上传到设备
+    MNN_GRAPH_EDGE_STAGED = 3,      // 源在设备上，经主机张量中转
+} MNN_GraphEdgeMode;
+
+MNN_C_API struct MNN_Graph* MNN_Graph_create();
+/**
+ * @brief free the graph; the sessions are owned by the caller.
+ */
+MNN_C_API void MNN_Graph_destroy(struct MNN_Graph* graph);
+/**
+ * @brief add a session as a node.
+ * @return node index, or -1.
+ */
+MNN_C_API int MNN_Graph_addNode(struct MNN_Graph* graph, struct MNN_Interpreter* net, struct MNN_Session* session);
+/**
+ * @brief feed output of node from into input of node to.
+ * @return edge index, or -1.
+ */
+MNN_C_API int MNN_Graph_connect(struct MNN_Graph* graph, int from, const char* output, int to, const char* input);
+/**
+ * @brief check the graph is acyclic, resolve the tensors and resize every input to the shape of its producer.
+ * Call again after adding nodes or edges or resizing the graph inputs.
+ */
+MNN_C_API MNN_ErrorCode MNN_Graph_prepare(struct MNN_Graph* graph);
+/**
+ * @brief run every node once. Fill the inputs of the source nodes before and read the sink nodes after.
+ * Consumers are resized when a producer's output shape changes. Must not be called concurrently.
+ * @return the error of a failed node; nodes depending on it are skipped.
+ */
+MNN_C_API MNN_ErrorCode MNN_Graph_run(struct MNN_Graph* graph);
+/**
+ * @brief result of a node in the last run.
+ */
+MNN_C_API MNN_ErrorCode MNN_Graph_nodeStatus(struct MNN_Graph* graph, int node);
+/**
+ * @brief how the edge was transferred in the last run.
+ */
+MNN_C_API MNN_GraphEdgeMode MNN_Graph_edgeMode(struct MNN_Graph* graph, int edge);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MNN_Graph_c_h */
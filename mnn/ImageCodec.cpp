@@ -0,0 +1,1745 @@
+//
+//  ImageCodec.cpp
+//  MNN
+//
+//  内置的 JPEG/PNG 解码器实现
+//  - JPEG 熵解码参考 ITU T.81 附录 F/G；8x8 整数 IDCT 与 Go image/jpeg 相同（结果逐位一致），
+//    1/2、1/4 降采样使用低频 NxN 系数的浮点 IDCT，1/8 直接取 DC
+//  - PNG 解压为完整 inflate（RFC 1951）实现，使用 9 bit 快表
+//
+
+#include "ImageCodec.hpp"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <memory>
+
+namespace ImageCodec {
+
+// -------------------------- 通用 --------------------------
+static inline uint8_t clampToByte(int v) {
+    return (uint8_t)(v < 0 ? 0 : (v > 255 ? 255 : v));
+}
+
+static inline int readU16BE(const uint8_t* p) {
+    return (p[0] << 8) | p[1];
+}
+
+static inline uint32_t readU32BE(const uint8_t* p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+}
+
+// 单张图像像素数上限（防止恶意头部导致超大分配）
+static const int64_t kMaxPixels = (int64_t)1 << 28;
+
+static const uint8_t kPngSignature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+
+Codec detect(const uint8_t* data, size_t size) {
+    if (data == nullptr) {
+        return CODEC_UNKNOWN;
+    }
+    if (size >= 3 && data[0] == 0xFF && data[1] == 0xD8 && data[2] == 0xFF) {
+        return CODEC_JPEG;
+    }
+    if (size >= 8 && memcmp(data, kPngSignature, 8) == 0) {
+        return CODEC_PNG;
+    }
+    return CODEC_UNKNOWN;
+}
+
+// ============================================================================
+//                                   JPEG
+// ============================================================================
+
+// zigzag 序 -> 自然序
+static const uint8_t kDeZigZag[64] = {
+     0,  1,  8, 16,  9,  2,  3, 10,
+    17, 24, 32, 25, 18, 11,  4,  5,
+    12, 19, 26, 33, 40, 48, 41, 34,
+    27, 20, 13,  6,  7, 14, 21, 28,
+    35, 42, 49, 56, 57, 50, 43, 36,
+    29, 22, 15, 23, 30, 37, 44, 51,
+    58, 59, 52, 45, 38, 31, 39, 46,
+    53, 60, 61, 54, 47, 55, 62, 63
+};
+
+static const int kFastBits = 9;
+
+struct JpegHuffman {
+    uint8_t fast[1 << kFastBits];   // 快表：码长 <= 9 的符号下标，255 表示需要慢速路径
+    uint16_t code[256];
+    uint8_t values[256];
+    uint8_t size[257];
+    uint32_t maxcode[18];           // 左对齐到 16 bit 的最大码字 + 1
+    int delta[17];                  // 码字 -> 符号下标的偏移
+    bool valid;
+};
+
+static bool buildHuffman(JpegHuffman* h, const uint8_t counts[16]) {
+    int k = 0;
+    for (int i = 0; i < 16; ++i) {
+        for (int j = 0; j < counts[i]; ++j) {
+            if (k >= 256) {
+                return false;
+            }
+            h->size[k++] = (uint8_t)(i + 1);
+        }
+    }
+    h->size[k] = 0;
+
+    uint32_t code = 0;
+    k = 0;
+    for (int j = 1; j <= 16; ++j) {
+        h->delta[j] = k - (int)code;
+        if (h->size[k] == j) {
+            while (h->size[k] == j) {
+                h->code[k++] = (uint16_t)(code++);
+            }
+            if (code - 1 >= (1u << j)) {
+                return false;
+            }
+        }
+        h->maxcode[j] = code << (16 - j);
+        code <<= 1;
+    }
+    h->maxcode[17] = 0xffffffffu;
+
+    memset(h->fast, 255, sizeof(h->fast));
+    for (int i = 0; i < k; ++i) {
+        int s = h->size[i];
+        if (s <= kFastBits) {
+            int c = h->code[i] << (kFastBits - s);
+            int m = 1 << (kFastBits - s);
+            for (int j = 0; j < m; ++j) {
+                h->fast[c + j] = (uint8_t)i;
+            }
+        }
+    }
+    h->valid = true;
+    return true;
+}
+
+// 熵编码段位读取器：遇到 marker 后停止消费输入，之后补 0
+struct JpegBits {
+    const uint8_t* p;
+    const uint8_t* end;
+    uint32_t buffer;
+    int bits;
+    int marker;         // -1 表示尚未遇到 marker
+    bool noMore;
+
+    void reset(const uint8_t* begin, const uint8_t* last) {
+        p = begin;
+        end = last;
+        buffer = 0;
+        bits = 0;
+        marker = -1;
+        noMore = false;
+    }
+
+    void fill() {
+        while (bits <= 24) {
+            uint32_t b = 0;
+            if (!noMore) {
+                if (p >= end) {
+                    noMore = true;
+                } else {
+                    b = *p++;
+                    if (b == 0xFF) {
+                        uint32_t c = p < end ? *p++ : 0xD9;
+                        while (c == 0xFF && p < end) {
+                            c = *p++;
+                        }
+                        if (c != 0) {
+                            marker = (int)c;
+                            noMore = true;
+                            b = 0;
+                        }
+                    }
+                }
+            }
+            buffer |= b << (24 - bits);
+            bits += 8;
+        }
+    }
+
+    // n: 1..16
+    inline int getBits(int n) {
+        if (bits < n) {
+            fill();
+        }
+        uint32_t v = buffer >> (32 - n);
+        buffer <<= n;
+        bits -= n;
+        return (int)v;
+    }
+
+    inline int getBit() {
+        return getBits(1);
+    }
+
+    // 读取 n bit 并按 JPEG 规则扩展符号
+    inline int receiveExtend(int n) {
+        if (n == 0) {
+            return 0;
+        }
+        int v = getBits(n);
+        return v < (1 << (n - 1)) ? v - (1 << n) + 1 : v;
+    }
+
+    inline int decode(const JpegHuffman& h) {
+        if (bits < 16) {
+            fill();
+        }
+        int c = h.fast[buffer >> (32 - kFastBits)];
+        if (c < 255) {
+            int s = h.size[c];
+            buffer <<= s;
+            bits -= s;
+            return h.values[c];
+        }
+        uint32_t temp = buffer >> 16;
+        int k = kFastBits + 1;
+        while (temp >= h.maxcode[k]) {
+            ++k;
+        }
+        if (k == 17) {
+            return -1;
+        }
+        c = (int)((buffer >> (32 - k)) & ((1u << k) - 1)) + h.delta[k];
+        if (c < 0 || c >= 256) {
+            return -1;
+        }
+        buffer <<= k;
+        bits -= k;
+        return h.values[c];
+    }
+};
+
+struct JpegComponent {
+    int id;
+    int h, v;
+    int tq;
+    int td, ta;
+    int dcPred;
+    int blocksW, blocksH;       // 按 MCU 对齐后的块数
+    int planeW, planeH;         // 分量平面尺寸（已乘以块输出尺寸）
+    size_t planeOffset;
+    size_t coefOffset;
+};
+
+struct JpegDecoder {
+    const uint8_t* data;
+    size_t size;
+    size_t pos;
+
+    uint16_t qt[4][64];         // 自然序量化表
+    JpegHuffman dc[4];
+    JpegHuffman ac[4];
+    JpegComponent comps[4];
+    int nc;
+    int width, height;
+    int hmax, vmax;
+    int mcusX, mcusY;
+    bool progressive;
+    bool frameSeen;
+    bool jfif;
+    int adobeTransform;         // -1 表示无 Adobe APP14
+    int restartInterval;
+    int eobRun;
+
+    int scanComps[4];
+    int ns;
+    int ss, se, ah, al;
+
+    int blockSize;              // 每个 8x8 块输出的像素边长：8/4/2/1
+    Scratch* scratch;
+    JpegBits bits;
+};
+
+// 反量化系数与 DC 预测值限制在 16 位（与 libjpeg 的 JCOEF 相同），合法码流不会超出；
+// 构造的码流也不会让 IDCT 的定点运算溢出
+static inline int clampCoef(int v) {
+    return v < -32768 ? -32768 : (v > 32767 ? 32767 : v);
+}
+
+// 8x8 整数 IDCT，与 Go image/jpeg 相同的定点实现（Go 的 int 为 64 位，这里同样用 int64_t 计算）
+static const int kW1 = 2841;
+static const int kW2 = 2676;
+static const int kW3 = 2408;
+static const int kW5 = 1609;
+static const int kW6 = 1108;
+static const int kW7 = 565;
+static const int kW1pW7 = kW1 + kW7;
+static const int kW1mW7 = kW1 - kW7;
+static const int kW2pW6 = kW2 + kW6;
+static const int kW2mW6 = kW2 - kW6;
+static const int kW3pW5 = kW3 + kW5;
+static const int kW3mW5 = kW3 - kW5;
+static const int kR2 = 181;
+
+static void idct8x8(int* s, uint8_t* dst, int stride) {
+    for (int y = 0; y < 8; ++y) {
+        int* r = s + y * 8;
+        if ((r[1] | r[2] | r[3] | r[4] | r[5] | r[6] | r[7]) == 0) {
+            int dc = r[0] * 8;
+            for (int i = 0; i < 8; ++i) {
+                r[i] = dc;
+            }
+            continue;
+        }
+        int64_t x0 = (int64_t)r[0] * 2048 + 128;
+        int64_t x1 = (int64_t)r[4] * 2048;
+        int64_t x2 = r[6];
+        int64_t x3 = r[2];
+        int64_t x4 = r[1];
+        int64_t x5 = r[7];
+        int64_t x6 = r[5];
+        int64_t x7 = r[3];
+
+        int64_t x8 = kW7 * (x4 + x5);
+        x4 = x8 + kW1mW7 * x4;
+        x5 = x8 - kW1pW7 * x5;
+        x8 = kW3 * (x6 + x7);
+        x6 = x8 - kW3mW5 * x6;
+        x7 = x8 - kW3pW5 * x7;
+
+        x8 = x0 + x1;
+        x0 -= x1;
+        x1 = kW6 * (x3 + x2);
+        x2 = x1 - kW2pW6 * x2;
+        x3 = x1 + kW2mW6 * x3;
+        x1 = x4 + x6;
+        x4 -= x6;
+        x6 = x5 + x7;
+        x5 -= x7;
+
+        x7 = x8 + x3;
+        x8 -= x3;
+        x3 = x0 + x2;
+        x0 -= x2;
+        x2 = (kR2 * (x4 + x5) + 128) >> 8;
+        x4 = (kR2 * (x4 - x5) + 128) >> 8;
+
+        r[0] = (int)((x7 + x1) >> 8);
+        r[1] = (int)((x3 + x2) >> 8);
+        r[2] = (int)((x0 + x4) >> 8);
+        r[3] = (int)((x8 + x6) >> 8);
+        r[4] = (int)((x8 - x6) >> 8);
+        r[5] = (int)((x0 - x4) >> 8);
+        r[6] = (int)((x3 - x2) >> 8);
+        r[7] = (int)((x7 - x1) >> 8);
+    }
+
+    for (int x = 0; x < 8; ++x) {
+        int* c = s + x;
+        int64_t y0 = (int64_t)c[8 * 0] * 256 + 8192;
+        int64_t y1 = (int64_t)c[8 * 4] * 256;
+        int64_t y2 = c[8 * 6];
+        int64_t y3 = c[8 * 2];
+        int64_t y4 = c[8 * 1];
+        int64_t y5 = c[8 * 7];
+        int64_t y6 = c[8 * 5];
+        int64_t y7 = c[8 * 3];
+
+        int64_t y8 = kW7 * (y4 + y5) + 4;
+        y4 = (y8 + kW1mW7 * y4) >> 3;
+        y5 = (y8 - kW1pW7 * y5) >> 3;
+        y8 = kW3 * (y6 + y7) + 4;
+        y6 = (y8 - kW3mW5 * y6) >> 3;
+        y7 = (y8 - kW3pW5 * y7) >> 3;
+
+        y8 = y0 + y1;
+        y0 -= y1;
+        y1 = kW6 * (y3 + y2) + 4;
+        y2 = (y1 - kW2pW6 * y2) >> 3;
+        y3 = (y1 + kW2mW6 * y3) >> 3;
+        y1 = y4 + y6;
+        y4 -= y6;
+        y6 = y5 + y7;
+        y5 -= y7;
+
+        y7 = y8 + y3;
+        y8 -= y3;
+        y3 = y0 + y2;
+        y0 -= y2;
+        y2 = (kR2 * (y4 + y5) + 128) >> 8;
+        y4 = (kR2 * (y4 - y5) + 128) >> 8;
+
+        dst[0 * stride + x] = clampToByte((int)(((y7 + y1) >> 14) + 128));
+        dst[1 * stride + x] = clampToByte((int)(((y3 + y2) >> 14) + 128));
+        dst[2 * stride + x] = clampToByte((int)(((y0 + y4) >> 14) + 128));
+        dst[3 * stride + x] = clampToByte((int)(((y8 + y6) >> 14) + 128));
+        dst[4 * stride + x] = clampToByte((int)(((y8 - y6) >> 14) + 128));
+        dst[5 * stride + x] = clampToByte((int)(((y0 - y4) >> 14) + 128));
+        dst[6 * stride + x] = clampToByte((int)(((y3 - y2) >> 14) + 128));
+        dst[7 * stride + x] = clampToByte((int)(((y7 - y1) >> 14) + 128));
+    }
+}
+
+// NxN 降采样 IDCT 的基函数表：kReduced[N][x][u] = C(u)/2 * cos((2x+1)uπ/2N)
+struct ReducedIdctTable {
+    float t4[4][4];
+    float t2[2][2];
+    ReducedIdctTable() {
+        const double pi = 3.14159265358979323846;
+        for (int x = 0; x < 4; ++x) {
+            for (int u = 0; u < 4; ++u) {
+                double cu = u == 0 ? sqrt(0.5) : 1.0;
+                t4[x][u] = (float)(cu * 0.5 * cos((2 * x + 1) * u * pi / 8.0));
+            }
+        }
+        for (int x = 0; x < 2; ++x) {
+            for (int u = 0; u < 2; ++u) {
+                double cu = u == 0 ? sqrt(0.5) : 1.0;
+                t2[x][u] = (float)(cu * 0.5 * cos((2 * x + 1) * u * pi / 4.0));
+            }
+        }
+    }
+};
+static const ReducedIdctTable gReducedIdct;
+
+template <int N>
+static void idctReduced(const int* s, const float (*t)[N], uint8_t* dst, int stride) {
+    // 先按行（u 方向）变换低频 N 行，再按列（v 方向）
+    float tmp[N][N];
+    for (int v = 0; v < N; ++v) {
+        const int* r = s + v * 8;
+        for (int x = 0; x < N; ++x) {
+            float sum = 0.0f;
+            for (int u = 0; u < N; ++u) {
+                sum += t[x][u] * (float)r[u];
+            }
+            tmp[v][x] = sum;
+        }
+    }
+    for (int y = 0; y < N; ++y) {
+        for (int x = 0; x < N; ++x) {
+            float sum = 0.0f;
+            for (int v = 0; v < N; ++v) {
+                sum += t[y][v] * tmp[v][x];
+            }
+            dst[y * stride + x] = clampToByte((int)floorf(sum + 128.5f));
+        }
+    }
+}
+
+// 把反量化后的系数块写入分量平面
+static void idctBlock(int* coef, int blockSize, uint8_t* dst, int stride) {
+    switch (blockSize) {
+        case 8:
+            idct8x8(coef, dst, stride);
+            break;
+        case 4:
+            idctReduced<4>(coef, gReducedIdct.t4, dst, stride);
+            break;
+        case 2:
+            idctReduced<2>(coef, gReducedIdct.t2, dst, stride);
+            break;
+        default:
+            dst[0] = clampToByte(((coef[0] + 4) >> 3) + 128);
+            break;
+    }
+}
+
+static uint8_t* planeBlock(JpegDecoder* j, const JpegComponent& c, int bx, int by) {
+    return j->scratch->planes.data() + c.planeOffset + (size_t)by * j->blockSize * c.planeW + (size_t)bx * j->blockSize;
+}
+
+static int16_t* coefBlock(JpegDecoder* j, const JpegComponent& c, int bx, int by) {
+    return j->scratch->coefficients.data() + c.coefOffset + ((size_t)by * c.blocksW + bx) * 64;
+}
+
+// baseline：解码一个块并立即反量化 + IDCT
+static bool decodeBlockBaseline(JpegDecoder* j, JpegComponent& c, int bx, int by) {
+    JpegBits& br = j->bits;
+    int coef[64];
+    memset(coef, 0, sizeof(coef));
+    const uint16_t* q = j->qt[c.tq];
+
+    int t = br.decode(j->dc[c.td]);
+    if (t < 0 || t > 15) {
+        return false;
+    }
+    c.dcPred = clampCoef(c.dcPred + br.receiveExtend(t));
+    coef[0] = clampCoef(c.dcPred * q[0]);
+
+    const JpegHuffman& hac = j->ac[c.ta];
+    int k = 1;
+    while (k < 64) {
+        int rs = br.decode(hac);
+        if (rs < 0) {
+            return false;
+        }
+        int s = rs & 15;
+        int r = rs >> 4;
+        if (s == 0) {
+            if (rs != 0xF0) {
+                break;
+            }
+            k += 16;
+        } else {
+            k += r;
+            if (k > 63) {
+                return false;
+            }
+            int zz = kDeZigZag[k++];
+            coef[zz] = clampCoef(br.receiveExtend(s) * q[zz]);
+        }
+    }
+    idctBlock(coef, j->blockSize, planeBlock(j, c, bx, by), c.planeW);
+    return true;
+}
+
+// progressive：DC 首次扫描 / 细化扫描
+static bool decodeBlockDC(JpegDecoder* j, JpegComponent& c, int16_t* data) {
+    JpegBits& br = j->bits;
+    if (j->ah == 0) {
+        int t = br.decode(j->dc[c.td]);
+        if (t < 0 || t > 15) {
+            return false;
+        }
+        c.dcPred = clampCoef(c.dcPred + br.receiveExtend(t));
+        data[0] = (int16_t)(c.dcPred * (1 << j->al));
+    } else if (br.getBit()) {
+        data[0] = (int16_t)(data[0] | (1 << j->al));
+    }
+    return true;
+}
+
+// progressive：AC 首次扫描 / 细化扫描
+static bool decodeBlockAC(JpegDecoder* j, JpegComponent& c, int16_t* data) {
+    JpegBits& br = j->bits;
+    const JpegHuffman& hac = j->ac[c.ta];
+    if (j->ah == 0) {
+        if (j->eobRun > 0) {
+            --j->eobRun;
+            return true;
+        }
+        int k = j->ss;
+        while (k <= j->se) {
+            int rs = br.decode(hac);
+            if (rs < 0) {
+                return false;
+            }
+            int s = rs & 15;
+            int r = rs >> 4;
+            if (s == 0) {
+                if (r < 15) {
+                    j->eobRun = (1 << r) - 1;
+                    if (r) {
+                        j->eobRun += br.getBits(r);
+                    }
+                    break;
+                }
+                k += 16;
+            } else {
+                k += r;
+                if (k > 63) {
+                    return false;
+                }
+                data[kDeZigZag[k++]] = (int16_t)(br.receiveExtend(s) * (1 << j->al));
+            }
+        }
+        return true;
+    }
+
+    // 细化扫描
+    const int16_t bit = (int16_t)(1 << j->al);
+    int k = j->ss;
+    if (j->eobRun > 0) {
+        --j->eobRun;
+        for (; k <= j->se; ++k) {
+            int16_t* p = data + kDeZigZag[k];
+            if (*p != 0 && br.getBit() && (*p & bit) == 0) {
+                *p = (int16_t)(*p > 0 ? *p + bit : *p - bit);
+            }
+        }
+        return true;
+    }
+    while (k <= j->se) {
+        int rs = br.decode(hac);
+        if (rs < 0) {
+            return false;
+        }
+        int s = rs & 15;
+        int r = rs >> 4;
+        int value = 0;
+        if (s == 0) {
+            if (r < 15) {
+                j->eobRun = (1 << r) - 1;
+                if (r) {
+                    j->eobRun += br.getBits(r);
+                }
+                r = 64;     // 本块剩余系数只做细化
+            }
+        } else {
+            if (s != 1) {
+                return false;
+            }
+            value = br.getBit() ? bit : -bit;
+        }
+        while (k <= j->se) {
+            int16_t* p = data + kDeZigZag[k++];
+            if (*p != 0) {
+                if (br.getBit() && (*p & bit) == 0) {
+                    *p = (int16_t)(*p > 0 ? *p + bit : *p - bit);
+                }
+            } else {
+                if (r == 0) {
+                    *p = (int16_t)value;
+                    break;
+                }
+                --r;
+            }
+        }
+    }
+    return true;
+}
+
+static bool decodeBlock(JpegDecoder* j, JpegComponent& c, int bx, int by) {
+    if (!j->progressive) {
+        return decodeBlockBaseline(j, c, bx, by);
+    }
+    int16_t* data = coefBlock(j, c, bx, by);
+    return j->ss == 0 ? decodeBlockDC(j, c, data) : decodeBlockAC(j, c, data);
+}
+
+static void resetEntropy(JpegDecoder* j) {
+    for (int i = 0; i < j->nc; ++i) {
+        j->comps[i].dcPred = 0;
+    }
+    j->eobRun = 0;
+}
+
+// 处理 MCU 之间的 restart marker；返回 false 表示扫描应提前结束（数据截断时尽量保留已解码内容）
+static bool handleRestart(JpegDecoder* j, int* todo) {
+    if (j->restartInterval == 0 || --(*todo) > 0) {
+        return true;
+    }
+    JpegBits& br = j->bits;
+    if (br.bits < 24) {
+        br.fill();
+    }
+    if (br.marker < 0xD0 || br.marker > 0xD7) {
+        return false;
+    }
+    br.reset(br.p, br.end);
+    resetEntropy(j);
+    *todo = j->restartInterval;
+    return true;
+}
+
+static MNN_ErrorCode decodeScan(JpegDecoder* j) {
+    j->bits.reset(j->data + j->pos, j->data + j->size);
+    resetEntropy(j);
+    int todo = j->restartInterval;
+
+    if (j->ns == 1) {
+        // 非交错扫描：按分量自身的块网格遍历，每块即一个 MCU
+        JpegComponent& c = j->comps[j->scanComps[0]];
+        int compW = (j->width * c.h + j->hmax - 1) / j->hmax;
+        int compH = (j->height * c.v + j->vmax - 1) / j->vmax;
+        int bw = (compW + 7) / 8;
+        int bh = (compH + 7) / 8;
+        for (int by = 0; by < bh; ++by) {
+            for (int bx = 0; bx < bw; ++bx) {
+                if (!decodeBlock(j, c, bx, by)) {
+                    return MNN_INPUT_DATA_ERROR;
+                }
+                if (!handleRestart(j, &todo)) {
+                    return MNN_NO_ERROR;
+                }
+            }
+        }
+    } else {
+        for (int my = 0; my < j->mcusY; ++my) {
+            for (int mx = 0; mx < j->mcusX; ++mx) {
+                for (int i = 0; i < j->ns; ++i) {
+                    JpegComponent& c = j->comps[j->scanComps[i]];
+                    for (int y = 0; y < c.v; ++y) {
+                        for (int x = 0; x < c.h; ++x) {
+                            if (!decodeBlock(j, c, mx * c.h + x, my * c.v + y)) {
+                                return MNN_INPUT_DATA_ERROR;
+                            }
+                        }
+                    }
+                }
+                if (!handleRestart(j, &todo)) {
+                    return MNN_NO_ERROR;
+                }
+            }
+        }
+    }
+    return MNN_NO_ERROR;
+}
+
+// 扫描结束后定位下一个 marker：位读取器已消费的 marker 直接复用，否则向后搜索
+static int nextMarkerAfterScan(JpegDecoder* j) {
+    JpegBits& br = j->bits;
+    j->pos = (size_t)(br.p - j->data);
+    if (br.marker >= 0) {
+        return br.marker;
+    }
+    while (j->pos + 1 < j->size) {
+        if (j->data[j->pos] == 0xFF) {
+            uint8_t m = j->data[j->pos + 1];
+            if (m != 0 && m != 0xFF && (m < 0xD0 || m > 0xD7)) {
+                j->pos += 2;
+                return m;
+            }
+        }
+        ++j->pos;
+    }
+    j->pos = j->size;
+    return -1;
+}
+
+static int readMarker(JpegDecoder* j) {
+    while (j->pos < j->size) {
+        if (j->data[j->pos] != 0xFF) {
+            ++j->pos;
+            continue;
+        }
+        while (j->pos < j->size && j->data[j->pos] == 0xFF) {
+            ++j->pos;
+        }
+        if (j->pos >= j->size) {
+            break;
+        }
+        int m = j->data[j->pos++];
+        if (m != 0) {
+            return m;
+        }
+    }
+    return -1;
+}
+
+static MNN_ErrorCode parseSOF(JpegDecoder* j, const uint8_t* p, int len, int marker) {
+    if (len < 6) {
+        return MNN_INPUT_DATA_ERROR;
+    }
+    if (p[0] != 8) {
+        // 12 bit 精度
+        return MNN_NOT_SUPPORT;
+    }
+    j->height = readU16BE(p + 1);
+    j->width  = readU16BE(p + 3);
+    j->nc     = p[5];
+    j->progressive = marker == 0xC2;
+    if (j->height == 0) {
+        // DNL 定义的高度
+        return MNN_NOT_SUPPORT;
+    }
+    if (j->width == 0 || (int64_t)j->width * j->height > kMaxPixels) {
+        return MNN_INPUT_DATA_ERROR;
+    }
+    if (j->nc != 1 && j->nc != 3) {
+        // CMYK / YCCK
+        return MNN_NOT_SUPPORT;
+    }
+    if (len < 6 + 3 * j->nc) {
+        return MNN_INPUT_DATA_ERROR;
+    }
+    j->hmax = 1;
+    j->vmax = 1;
+    for (int i = 0; i < j->nc; ++i) {
+        JpegComponent& c = j->comps[i];
+        c.id = p[6 + i * 3];
+        c.h  = p[7 + i * 3] >> 4;
+        c.v  = p[7 + i * 3] & 15;
+        c.tq = p[8 + i * 3] & 3;
+        if (c.h < 1 || c.h > 4 || c.v < 1 || c.v > 4) {
+            return MNN_INPUT_DATA_ERROR;
+        }
+        j->hmax = std::max(j->hmax, c.h);
+        j->vmax = std::max(j->vmax, c.v);
+    }
+    if (j->nc == 1) {
+        // 单分量图像只有非交错扫描，采样因子无意义
+        j->comps[0].h = j->comps[0].v = 1;
+        j->hmax = j->vmax = 1;
+    }
+    for (int i = 0; i < j->nc; ++i) {
+        if (j->hmax % j->comps[i].h != 0 || j->vmax % j->comps[i].v != 0) {
+            return MNN_NOT_SUPPORT;
+        }
+    }
+    j->frameSeen = true;
+    return MNN_NO_ERROR;
+}
+
+// 按帧参数分配分量平面与（progressive 时的）系数缓冲
+static void allocateFrame(JpegDecoder* j) {
+    j->mcusX = (j->width + 8 * j->hmax - 1) / (8 * j->hmax);
+    j->mcusY = (j->height + 8 * j->vmax - 1) / (8 * j->vmax);
+    size_t planeTotal = 0;
+    size_t coefTotal = 0;
+    for (int i = 0; i < j->nc; ++i) {
+        JpegComponent& c = j->comps[i];
+        c.blocksW = j->mcusX * c.h;
+        c.blocksH = j->mcusY * c.v;
+        c.planeW = c.blocksW * j->blockSize;
+        c.planeH = c.blocksH * j->blockSize;
+        c.planeOffset = planeTotal;
+        c.coefOffset = coefTotal;
+        planeTotal += (size_t)c.planeW * c.planeH;
+        if (j->progressive) {
+            coefTotal += (size_t)c.blocksW * c.blocksH * 64;
+        }
+    }
+    j->scratch->planes.resize(planeTotal);
+    if (j->progressive) {
+        j->scratch->coefficients.assign(coefTotal, 0);
+    }
+}
+
+static MNN_ErrorCode parseSOS(JpegDecoder* j, const uint8_t* p, int len) {
+    if (len < 1) {
+        return MNN_INPUT_DATA_ERROR;
+    }
+    j->ns = p[0];
+    if (j->ns < 1 || j->ns > j->nc || len < 4 + 2 * j->ns) {
+        return MNN_INPUT_DATA_ERROR;
+    }
+    for (int i = 0; i < j->ns; ++i) {
+        int id = p[1 + i * 2];
+        int tables = p[2 + i * 2];
+        int index = -1;
+        for (int k = 0; k < j->nc; ++k) {
+            if (j->comps[k].id == id) {
+                index = k;
+                break;
+            }
+        }
+        if (index < 0) {
+            return MNN_INPUT_DATA_ERROR;
+        }
+        j->scanComps[i] = index;
+        j->comps[index].td = (tables >> 4) & 3;
+        j->comps[index].ta = tables & 3;
+    }
+    const uint8_t* q = p + 1 + 2 * j->ns;
+    j->ss = q[0];
+    j->se = q[1];
+    j->ah = q[2] >> 4;
+    j->al = q[2] & 15;
+    if (j->progressive) {
+        if (j->ss > 63 || j->se > 63 || j->ss > j->se || j->ah > 13 || j->al > 13) {
+            return MNN_INPUT_DATA_ERROR;
+        }
+        if (j->ss != 0 && j->ns != 1) {
+            return MNN_INPUT_DATA_ERROR;
+        }
+    } else {
+        j->ss = 0;
+        j->se = 63;
+        j->ah = j->al = 0;
+    }
+    // 检查扫描用到的哈夫曼表均已定义
+    for (int i = 0; i < j->ns; ++i) {
+        const JpegComponent& c = j->comps[j->scanComps[i]];
+        bool needDC = !j->progressive || (j->ss == 0 && j->ah == 0);
+        bool needAC = !j->progressive || j->ss != 0;
+        if ((needDC && !j->dc[c.td].valid) || (needAC && !j->ac[c.ta].valid)) {
+            return MNN_INPUT_DATA_ERROR;
+        }
+    }
+    return MNN_NO_ERROR;
+}
+
+static MNN_ErrorCode parseDQT(JpegDecoder* j, const uint8_t* p, int len) {
+    while (len > 0) {
+        int pq = p[0] >> 4;
+        int tq = p[0] & 15;
+        int need = 1 + 64 * (pq ? 2 : 1);
+        if (tq > 3 || len < need) {
+            return MNN_INPUT_DATA_ERROR;
+        }
+        for (int i = 0; i < 64; ++i) {
+            j->qt[tq][kDeZigZag[i]] = (uint16_t)(pq ? readU16BE(p + 1 + i * 2) : p[1 + i]);
+        }
+        p += need;
+        len -= need;
+    }
+    return MNN_NO_ERROR;
+}
+
+static MNN_ErrorCode parseDHT(JpegDecoder* j, const uint8_t* p, int len) {
+    while (len > 0) {
+        if (len < 17) {
+            return MNN_INPUT_DATA_ERROR;
+        }
+        int tc = p[0] >> 4;
+        int th = p[0] & 15;
+        if (tc > 1 || th > 3) {
+            return MNN_INPUT_DATA_ERROR;
+        }
+        int total = 0;
+        for (int i = 0; i < 16; ++i) {
+            total += p[1 + i];
+        }
+        if (total > 256 || len < 17 + total) {
+            return MNN_INPUT_DATA_ERROR;
+        }
+        JpegHuffman* h = tc == 0 ? &j->dc[th] : &j->ac[th];
+        if (!buildHuffman(h, p + 1)) {
+            return MNN_INPUT_DATA_ERROR;
+        }
+        memcpy(h->values, p + 17, total);
+        p += 17 + total;
+        len -= 17 + total;
+    }
+    return MNN_NO_ERROR;
+}
+
+static void parseAPP(JpegDecoder* j, const uint8_t* p, int len, int marker) {
+    if (marker == 0xE0 && len >= 5 && memcmp(p, "JFIF\0", 5) == 0) {
+        j->jfif = true;
+    } else if (marker == 0xEE && len >= 12 && memcmp(p, "Adobe", 5) == 0) {
+        j->adobeTransform = p[11];
+    }
+}
+
+// 单分量 -> GRAY；三分量按 JFIF/Adobe 约定 YCbCr 或 RGB -> RGB，色度使用最近邻上采样
+static void colorConvert(JpegDecoder* j, int outW, int outH, Image* image) {
+    Scratch* s = j->scratch;
+    const uint8_t* planes = s->planes.data();
+    if (j->nc == 1) {
+        const JpegComponent& c = j->comps[0];
+        s->pixels.resize((size_t)outW * outH);
+        for (int y = 0; y < outH; ++y) {
+            memcpy(s->pixels.data() + (size_t)y * outW, planes + c.planeOffset + (size_t)y * c.planeW, outW);
+        }
+        image->format = PIXEL_GRAY;
+        image->stride = outW;
+    } else {
+        bool isRGB = false;
+        if (j->adobeTransform == 0) {
+            isRGB = true;
+        } else if (!j->jfif && j->adobeTransform < 0 &&
+                   j->comps[0].id == 'R' && j->comps[1].id == 'G' && j->comps[2].id == 'B') {
+            isRGB = true;
+        }
+        const JpegComponent& c0 = j->comps[0];
+        const JpegComponent& c1 = j->comps[1];
+        const JpegComponent& c2 = j->comps[2];
+        const int fx0 = j->hmax / c0.h, fy0 = j->vmax / c0.v;
+        const int fx1 = j->hmax / c1.h, fy1 = j->vmax / c1.v;
+        const int fx2 = j->hmax / c2.h, fy2 = j->vmax / c2.v;
+        s->pixels.resize((size_t)outW * outH * 3);
+        for (int y = 0; y < outH; ++y) {
+            const uint8_t* r0 = planes + c0.planeOffset + (size_t)(y / fy0) * c0.planeW;
+            const uint8_t* r1 = planes + c1.planeOffset + (size_t)(y / fy1) * c1.planeW;
+            const uint8_t* r2 = planes + c2.planeOffset + (size_t)(y / fy2) * c2.planeW;
+            uint8_t* dst = s->pixels.data() + (size_t)y * outW * 3;
+            int x0 = 0, x1 = 0, x2 = 0;
+            int n0 = 0, n1 = 0, n2 = 0;
+            for (int x = 0; x < outW; ++x) {
+                int a = r0[x0];
+                int b = r1[x1];
+                int c = r2[x2];
+                if (isRGB) {
+                    dst[0] = (uint8_t)a;
+                    dst[1] = (uint8_t)b;
+                    dst[2] = (uint8_t)c;
+                } else {
+                    // JFIF YCbCr -> RGB，16 bit 定点（与 Go image/color 一致）
+                    int yy = a * 0x10101;
+                    int cb = b - 128;
+                    int cr = c - 128;
+                    int r = yy + 91881 * cr;
+                    int g = yy - 22554 * cb - 46802 * cr;
+                    int bl = yy + 116130 * cb;
+                    dst[0] = ((uint32_t)r & 0xff000000u) == 0 ? (uint8_t)(r >> 16) : (uint8_t)~(r >> 31);
+                    dst[1] = ((uint32_t)g & 0xff000000u) == 0 ? (uint8_t)(g >> 16) : (uint8_t)~(g >> 31);
+                    dst[2] = ((uint32_t)bl & 0xff000000u) == 0 ? (uint8_t)(bl >> 16) : (uint8_t)~(bl >> 31);
+                }
+                dst += 3;
+                if (++n0 == fx0) { n0 = 0; ++x0; }
+                if (++n1 == fx1) { n1 = 0; ++x1; }
+                if (++n2 == fx2) { n2 = 0; ++x2; }
+            }
+        }
+        image->format = PIXEL_RGB;
+        image->stride = outW * 3;
+    }
+    image->pixels = s->pixels.data();
+    image->width = outW;
+    image->height = outH;
+}
+
+// progressive 全部扫描结束后统一反量化 + IDCT
+static void finishProgressive(JpegDecoder* j) {
+    int coef[64];
+    for (int i = 0; i < j->nc; ++i) {
+        JpegComponent& c = j->comps[i];
+        const uint16_t* q = j->qt[c.tq];
+        for (int by = 0; by < c.blocksH; ++by) {
+            for (int bx = 0; bx < c.blocksW; ++bx) {
+                const int16_t* data = coefBlock(j, c, bx, by);
+                for (int k = 0; k < 64; ++k) {
+                    coef[k] = clampCoef(data[k] * q[k]);
+                }
+                idctBlock(coef, j->blockSize, planeBlock(j, c, bx, by), c.planeW);
+            }
+        }
+    }
+}
+
+static MNN_ErrorCode decodeJpeg(const uint8_t* data, size_t size, int scaleDenom, Scratch* scratch, Image* image, Info* infoOnly) {
+    // 解码器状态包含 8 张哈夫曼表，放在堆上以免占用过多栈空间
+    std::unique_ptr<JpegDecoder> holder(new JpegDecoder());
+    JpegDecoder* j = holder.get();
+    j->data = data;
+    j->size = size;
+    j->pos = 2;
+    j->adobeTransform = -1;
+    j->blockSize = 8 / scaleDenom;
+    j->scratch = scratch;
+
+    bool frameAllocated = false;
+    bool sawScan = false;
+    int marker = readMarker(j);
+    while (marker >= 0) {
+        if (marker == 0xD9) {
+            break;
+        }
+        if (marker == 0x01 || (marker >= 0xD0 && marker <= 0xD7)) {
+            marker = readMarker(j);
+            continue;
+        }
+        if (j->pos + 2 > size) {
+            return MNN_INPUT_DATA_ERROR;
+        }
+        int len = readU16BE(data + j->pos) - 2;
+        if (len < 0 || j->pos + 2 + (size_t)len > size) {
+            return MNN_INPUT_DATA_ERROR;
+        }
+        const uint8_t* p = data + j->pos + 2;
+        j->pos += 2 + len;
+
+        MNN_ErrorCode code = MNN_NO_ERROR;
+        switch (marker) {
+            case 0xC0:
+            case 0xC1:
+            case 0xC2:
+                if (j->frameSeen) {
+                    return MNN_INPUT_DATA_ERROR;
+                }
+                code = parseSOF(j, p, len, marker);
+                if (code == MNN_NO_ERROR && infoOnly != nullptr) {
+                    infoOnly->codec = CODEC_JPEG;
+                    infoOnly->width = j->width;
+                    infoOnly->height = j->height;
+                    infoOnly->channels = j->nc;
+                    return MNN_NO_ERROR;
+                }
+                break;
+            case 0xC3: case 0xC5: case 0xC6: case 0xC7:
+            case 0xC9: case 0xCA: case 0xCB:
+            case 0xCD: case 0xCE: case 0xCF:
+                // 无损 / 分层 / 算术编码
+                return MNN_NOT_SUPPORT;
+            case 0xC4:
+                code = parseDHT(j, p, len);
+                break;
+            case 0xDB:
+                code = parseDQT(j, p, len);
+                break;
+            case 0xDD:
+                if (len < 2) {
+                    return MNN_INPUT_DATA_ERROR;
+                }
+                j->restartInterval = readU16BE(p);
+                break;
+            case 0xDA:
+                if (!j->frameSeen) {
+                    return MNN_INPUT_DATA_ERROR;
+                }
+                code = parseSOS(j, p, len);
+                if (code != MNN_NO_ERROR) {
+                    return code;
+                }
+                if (!frameAllocated) {
+                    allocateFrame(j);
+                    frameAllocated = true;
+                }
+                code = decodeScan(j);
+                if (code != MNN_NO_ERROR) {
+                    return code;
+                }
+                sawScan = true;
+                marker = nextMarkerAfterScan(j);
+                continue;
+            default:
+                if (marker >= 0xE0 && marker <= 0xEF) {
+                    parseAPP(j, p, len, marker);
+                }
+                break;
+        }
+        if (code != MNN_NO_ERROR) {
+            return code;
+        }
+        marker = readMarker(j);
+    }
+
+    if (infoOnly != nullptr || !sawScan) {
+        return MNN_INPUT_DATA_ERROR;
+    }
+    if (j->progressive) {
+        finishProgressive(j);
+    }
+    int outW = (j->width + scaleDenom - 1) / scaleDenom;
+    int outH = (j->height + scaleDenom - 1) / scaleDenom;
+    colorConvert(j, outW, outH, image);
+    return MNN_NO_ERROR;
+}
+
+// ============================================================================
+//                                   PNG
+// ============================================================================
+
+static const int kZFastBits = 9;
+
+struct ZHuffman {
+    uint16_t fast[1 << kZFastBits];  // (码长 << 9) | 符号，0 表示需要慢速路径
+    uint16_t firstcode[16];
+    int maxcode[17];
+    uint16_t firstsymbol[16];
+    uint8_t size[288];
+    uint16_t value[288];
+};
+
+static inline int bitReverse16(int v) {
+    v = ((v & 0xAAAA) >> 1) | ((v & 0x5555) << 1);
+    v = ((v & 0xCCCC) >> 2) | ((v & 0x3333) << 2);
+    v = ((v & 0xF0F0) >> 4) | ((v & 0x0F0F) << 4);
+    v = ((v & 0xFF00) >> 8) | ((v & 0x00FF) << 8);
+    return v;
+}
+
+static inline int bitReverse(int v, int bits) {
+    return bitReverse16(v) >> (16 - bits);
+}
+
+static bool buildZHuffman(ZHuffman* z, const uint8_t* lengths, int num) {
+    int sizes[17];
+    int nextCode[16];
+    memset(sizes, 0, sizeof(sizes));
+    memset(z->fast, 0, sizeof(z->fast));
+    for (int i = 0; i < num; ++i) {
+        ++sizes[lengths[i]];
+    }
+    sizes[0] = 0;
+    for (int i = 1; i < 16; ++i) {
+        if (sizes[i] > (1 << i)) {
+            return false;
+        }
+    }
+    int code = 0;
+    int k = 0;
+    for (int i = 1; i < 16; ++i) {
+        nextCode[i] = code;
+        z->firstcode[i] = (uint16_t)code;
+        z->firstsymbol[i] = (uint16_t)k;
+        code += sizes[i];
+        if (sizes[i] && code - 1 >= (1 << i)) {
+            return false;
+        }
+        z->maxcode[i] = code << (16 - i);
+        code <<= 1;
+        k += sizes[i];
+    }
+    z->maxcode[16] = 0x10000;
+    for (int i = 0; i < num; ++i) {
+        int s = lengths[i];
+        if (s == 0) {
+            continue;
+        }
+        int c = nextCode[s] - z->firstcode[s] + z->firstsymbol[s];
+        uint16_t fastValue = (uint16_t)((s << 9) | i);
+        z->size[c] = (uint8_t)s;
+        z->value[c] = (uint16_t)i;
+        if (s <= kZFastBits) {
+            int r = bitReverse(nextCode[s], s);
+            while (r < (1 << kZFastBits)) {
+                z->fast[r] = fastValue;
+                r += 1 << s;
+            }
+        }
+        ++nextCode[s];
+    }
+    return true;
+}
+
+static const int kLengthBase[31] = {
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+    35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258, 0, 0};
+static const int kLengthExtra[31] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+    3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0, 0, 0};
+static const int kDistBase[32] = {
+    1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+    257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577, 0, 0};
+static const int kDistExtra[32] = {
+    0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+    7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13, 0, 0};
+
+// zlib 流解压到预先确定大小的输出缓冲
+struct Inflater {
+    const uint8_t* p;
+    const uint8_t* end;
+    uint64_t buffer;
+    int bits;
+    int overrun;        // 超出输入末尾补 0 的字节数
+    uint8_t* out;
+    size_t outSize;
+    size_t outPos;
+    ZHuffman lit;
+    ZHuffman dist;
+
+    void fill() {
+        while (bits <= 56) {
+            uint64_t b = 0;
+            if (p < end) {
+                b = *p++;
+            } else {
+                ++overrun;
+            }
+            buffer |= b << bits;
+            bits += 8;
+        }
+    }
+
+    inline int getBits(int n) {
+        if (bits < n) {
+            fill();
+        }
+        int v = (int)(buffer & ((1ull << n) - 1));
+        buffer >>= n;
+        bits -= n;
+        return v;
+    }
+
+    inline int decode(const ZHuffman& z) {
+        if (bits < 16) {
+            fill();
+        }
+        int b = z.fast[buffer & ((1 << kZFastBits) - 1)];
+        if (b) {
+            int s = b >> 9;
+            buffer >>= s;
+            bits -= s;
+            return b & 511;
+        }
+        int k = bitReverse16((int)(buffer & 0xFFFF));
+        int s = kZFastBits + 1;
+        while (k >= z.maxcode[s]) {
+            ++s;
+        }
+        if (s >= 16) {
+            return -1;
+        }
+        b = (k >> (16 - s)) - z.firstcode[s] + z.firstsymbol[s];
+        if (b < 0 || b >= 288 || z.size[b] != s) {
+            return -1;
+        }
+        buffer >>= s;
+        bits -= s;
+        return z.value[b];
+    }
+
+    bool stored() {
+        // 丢弃到字节边界，再从位缓冲中取回已预读的字节
+        getBits(bits & 7);
+        uint8_t header[4];
+        for (int i = 0; i < 4; ++i) {
+            header[i] = (uint8_t)getBits(8);
+        }
+        int len  = header[0] | (header[1] << 8);
+        int nlen = header[2] | (header[3] << 8);
+        if (len != (nlen ^ 0xFFFF) || outPos + len > outSize) {
+            return false;
+        }
+        while (len > 0 && bits > 0) {
+            out[outPos++] = (uint8_t)getBits(8);
+            --len;
+        }
+        if ((size_t)(end - p) < (size_t)len) {
+            return false;
+        }
+        memcpy(out + outPos, p, len);
+        p += len;
+        outPos += len;
+        return true;
+    }
+
+    bool dynamicTables() {
+        static const uint8_t order[19] = {16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+        int hlit  = getBits(5) + 257;
+        int hdist = getBits(5) + 1;
+        int hclen = getBits(4) + 4;
+        uint8_t codeLengths[19];
+        memset(codeLengths, 0, sizeof(codeLengths));
+        for (int i = 0; i < hclen; ++i) {
+            codeLengths[order[i]] = (uint8_t)getBits(3);
+        }
+        ZHuffman lengthCodes;
+        if (!buildZHuffman(&lengthCodes, codeLengths, 19)) {
+            return false;
+        }
+        uint8_t lengths[286 + 32];
+        int n = 0;
+        while (n < hlit + hdist) {
+            int c = decode(lengthCodes);
+            if (c < 0 || c > 18) {
+                return false;
+            }
+            if (c < 16) {
+                lengths[n++] = (uint8_t)c;
+                continue;
+            }
+            int fillValue = 0;
+            int repeat;
+            if (c == 16) {
+                if (n == 0) {
+                    return false;
+                }
+                repeat = getBits(2) + 3;
+                fillValue = lengths[n - 1];
+            } else if (c == 17) {
+                repeat = getBits(3) + 3;
+            } else {
+                repeat = getBits(7) + 11;
+            }
+            if (n + repeat > hlit + hdist) {
+                return false;
+            }
+            memset(lengths + n, fillValue, repeat);
+            n += repeat;
+        }
+        return buildZHuffman(&lit, lengths, hlit) && buildZHuffman(&dist, lengths + hlit, hdist);
+    }
+
+    void fixedTables() {
+        uint8_t lengths[288 + 32];
+        memset(lengths, 8, 144);
+        memset(lengths + 144, 9, 112);
+        memset(lengths + 256, 7, 24);
+        memset(lengths + 280, 8, 8);
+        memset(lengths + 288, 5, 32);
+        buildZHuffman(&lit, lengths, 288);
+        buildZHuffman(&dist, lengths + 288, 32);
+    }
+
+    bool compressed() {
+        for (;;) {
+            int sym = decode(lit);
+            if (sym < 256) {
+                if (sym < 0 || outPos >= outSize) {
+                    return false;
+                }
+                out[outPos++] = (uint8_t)sym;
+                continue;
+            }
+            if (sym == 256) {
+                return overrun <= 8;
+            }
+            sym -= 257;
+            if (sym >= 29) {
+                return false;
+            }
+            int len = kLengthBase[sym] + (kLengthExtra[sym] ? getBits(kLengthExtra[sym]) : 0);
+            int d = decode(dist);
+            if (d < 0 || d >= 30) {
+                return false;
+            }
+            size_t distance = (size_t)kDistBase[d] + (kDistExtra[d] ? getBits(kDistExtra[d]) : 0);
+            if (distance > outPos || outPos + len > outSize) {
+                return false;
+            }
+            uint8_t* dst = out + outPos;
+            const uint8_t* src = dst - distance;
+            if (distance == 1) {
+                memset(dst, *src, len);
+            } else {
+                for (int i = 0; i < len; ++i) {
+                    dst[i] = src[i];
+                }
+            }
+            outPos += len;
+        }
+    }
+
+    bool run(const uint8_t* data, size_t size, uint8_t* dst, size_t dstSize) {
+        if (size < 2) {
+            return false;
+        }
+        int cmf = data[0];
+        int flg = data[1];
+        if ((cmf & 15) != 8 || ((cmf << 8) | flg) % 31 != 0 || (flg & 0x20)) {
+            return false;
+        }
+        p = data + 2;
+        end = data + size;
+        buffer = 0;
+        bits = 0;
+        overrun = 0;
+        out = dst;
+        outSize = dstSize;
+        outPos = 0;
+        int last = 0;
+        do {
+            last = getBits(1);
+            int type = getBits(2);
+            bool ok;
+            if (type == 0) {
+                ok = stored();
+            } else if (type == 1) {
+                fixedTables();
+                ok = compressed();
+            } else if (type == 2) {
+                ok = dynamicTables() && compressed();
+            } else {
+                ok = false;
+            }
+            if (!ok) {
+                return false;
+            }
+        } while (!last && outPos < outSize);
+        return outPos == outSize;
+    }
+};
+
+struct PngHeader {
+    int width;
+    int height;
+    int depth;
+    int colorType;
+    int interlace;
+    int samples;        // 每像素采样数
+};
+
+static int pngSamples(int colorType) {
+    switch (colorType) {
+        case 0: return 1;
+        case 2: return 3;
+        case 3: return 1;
+        case 4: return 2;
+        case 6: return 4;
+        default: return 0;
+    }
+}
+
+static MNN_ErrorCode parsePngHeader(const uint8_t* data, size_t size, PngHeader* h) {
+    if (size < 8 + 8 + 13 || readU32BE(data + 8) != 13 || memcmp(data + 12, "IHDR", 4) != 0) {
+        return MNN_INPUT_DATA_ERROR;
+    }
+    const uint8_t* p = data + 16;
+    uint32_t w = readU32BE(p);
+    uint32_t hh = readU32BE(p + 4);
+    h->depth = p[8];
+    h->colorType = p[9];
+    h->interlace = p[12];
+    h->samples = pngSamples(h->colorType);
+    if (w == 0 || hh == 0 || w > (1u << 24) || hh > (1u << 24) || (int64_t)w * hh > kMaxPixels) {
+        return MNN_INPUT_DATA_ERROR;
+    }
+    h->width = (int)w;
+    h->height = (int)hh;
+    if (h->samples == 0 || p[10] != 0 || p[11] != 0 || h->interlace > 1) {
+        return MNN_INPUT_DATA_ERROR;
+    }
+    bool depthOk;
+    switch (h->colorType) {
+        case 0: depthOk = h->depth == 1 || h->depth == 2 || h->depth == 4 || h->depth == 8 || h->depth == 16; break;
+        case 3: depthOk = h->depth == 1 || h->depth == 2 || h->depth == 4 || h->depth == 8; break;
+        default: depthOk = h->depth == 8 || h->depth == 16; break;
+    }
+    return depthOk ? MNN_NO_ERROR : MNN_INPUT_DATA_ERROR;
+}
+
+static inline size_t pngRowBytes(const PngHeader& h, int width) {
+    return ((size_t)width * h.samples * h.depth + 7) / 8;
+}
+
+static inline int paeth(int a, int b, int c) {
+    int p = a + b - c;
+    int pa = abs(p - a);
+    int pb = abs(p - b);
+    int pc = abs(p - c);
+    if (pa <= pb && pa <= pc) {
+        return a;
+    }
+    return pb <= pc ? b : c;
+}
+
+// 原地反滤波一个子图像（非隔行时即整图），rows 指向第一行的滤波类型字节
+static bool unfilter(uint8_t* rows, int height, size_t rowBytes, int bpp) {
+    const size_t lineSize = rowBytes + 1;
+    for (int y = 0; y < height; ++y) {
+        uint8_t* line = rows + y * lineSize;
+        uint8_t* cur = line + 1;
+        const uint8_t* prev = y > 0 ? line - lineSize + 1 : nullptr;
+        switch (line[0]) {
+            case 0:
+                break;
+            case 1:
+                for (size_t i = bpp; i < rowBytes; ++i) {
+                    cur[i] = (uint8_t)(cur[i] + cur[i - bpp]);
+                }
+                break;
+            case 2:
+                if (prev) {
+                    for (size_t i = 0; i < rowBytes; ++i) {
+                        cur[i] = (uint8_t)(cur[i] + prev[i]);
+                    }
+                }
+                break;
+            case 3:
+                for (size_t i = 0; i < rowBytes; ++i) {
+                    int left = i >= (size_t)bpp ? cur[i - bpp] : 0;
+                    int up = prev ? prev[i] : 0;
+                    cur[i] = (uint8_t)(cur[i] + ((left + up) >> 1));
+                }
+                break;
+            case 4:
+                for (size_t i = 0; i < rowBytes; ++i) {
+                    int left = i >= (size_t)bpp ? cur[i - bpp] : 0;
+                    int up = prev ? prev[i] : 0;
+                    int upLeft = (prev && i >= (size_t)bpp) ? prev[i - bpp] : 0;
+                    cur[i] = (uint8_t)(cur[i] + paeth(left, up, upLeft));
+                }
+                break;
+            default:
+                return false;
+        }
+    }
+    return true;
+}
+
+struct PngPalette {
+    uint8_t rgba[256][4];
+    int size;
+    bool hasAlpha;
+};
+
+// 把一行反滤波后的数据展开为 8 bit 输出像素；dstStep 为相邻输出像素的字节间隔
+static void expandRow(const uint8_t* src, int count, const PngHeader& h, const PngPalette& palette,
+                      int outChannels, uint8_t* dst, size_t dstStep) {
+    if (h.depth < 8) {
+        const int scale = h.colorType == 0 ? 255 / ((1 << h.depth) - 1) : 1;
+        const int mask = (1 << h.depth) - 1;
+        for (int x = 0; x < count; ++x, dst += dstStep) {
+            int bitPos = x * h.depth;
+            int v = (src[bitPos >> 3] >> (8 - h.depth - (bitPos & 7))) & mask;
+            if (h.colorType == 0) {
+                dst[0] = (uint8_t)(v * scale);
+            } else {
+                memcpy(dst, palette.rgba[v], outChannels);
+            }
+        }
+        return;
+    }
+    const int step = h.depth == 16 ? 2 : 1;   // 16 bit 取高字节
+    switch (h.colorType) {
+        case 3:
+            for (int x = 0; x < count; ++x, dst += dstStep) {
+                memcpy(dst, palette.rgba[src[x]], outChannels);
+            }
+            break;
+        case 4:
+            for (int x = 0; x < count; ++x, dst += dstStep, src += 2 * step) {
+                dst[0] = dst[1] = dst[2] = src[0];
+                dst[3] = src[step];
+            }
+            break;
+        default:
+            if (step == 1 && dstStep == (size_t)outChannels) {
+                memcpy(dst, src, (size_t)count * outChannels);
+                break;
+            }
+            for (int x = 0; x < count; ++x, dst += dstStep) {
+                for (int c = 0; c < outChannels; ++c, src += step) {
+                    dst[c] = src[0];
+                }
+            }
+            break;
+    }
+}
+
+static MNN_ErrorCode decodePng(const uint8_t* data, size_t size, Scratch* scratch, Image* image, Info* infoOnly) {
+    PngHeader h;
+    MNN_ErrorCode code = parsePngHeader(data, size, &h);
+    if (code != MNN_NO_ERROR) {
+        return code;
+    }
+    if (infoOnly != nullptr) {
+        infoOnly->codec = CODEC_PNG;
+        infoOnly->width = h.width;
+        infoOnly->height = h.height;
+        infoOnly->channels = h.samples;
+        return MNN_NO_ERROR;
+    }
+
+    PngPalette palette;
+    memset(&palette, 0, sizeof(palette));
+    std::vector<uint8_t>& idat = scratch->compressed;
+    idat.clear();
+    size_t pos = 8;
+    bool ended = false;
+    while (pos + 12 <= size && !ended) {
+        uint32_t len = readU32BE(data + pos);
+        const uint8_t* type = data + pos + 4;
+        const uint8_t* body = data + pos + 8;
+        if (len > size - pos - 12) {
+            return MNN_INPUT_DATA_ERROR;
+        }
+        if (memcmp(type, "IDAT", 4) == 0) {
+            idat.insert(idat.end(), body, body + len);
+        } else if (memcmp(type, "PLTE", 4) == 0) {
+            if (len % 3 != 0 || len / 3 > 256) {
+                return MNN_INPUT_DATA_ERROR;
+            }
+            palette.size = (int)(len / 3);
+            for (int i = 0; i < palette.size; ++i) {
+                palette.rgba[i][0] = body[i * 3 + 0];
+                palette.rgba[i][1] = body[i * 3 + 1];
+                palette.rgba[i][2] = body[i * 3 + 2];
+                palette.rgba[i][3] = 255;
+            }
+        } else if (memcmp(type, "tRNS", 4) == 0 && h.colorType == 3) {
+            for (uint32_t i = 0; i < len && i < 256; ++i) {
+                palette.rgba[i][3] = body[i];
+            }
+            palette.hasAlpha = true;
+        } else if (memcmp(type, "IEND", 4) == 0) {
+            ended = true;
+        }
+        pos += 12 + len;
+    }
+    if (idat.empty() || (h.colorType == 3 && palette.size == 0)) {
+        return MNN_INPUT_DATA_ERROR;
+    }
+
+    // Adam7 各遍的起点与步长；非隔行时只有一遍
+    static const int kStartX[7] = {0, 4, 0, 2, 0, 1, 0};
+    static const int kStartY[7] = {0, 0, 4, 0, 2, 0, 1};
+    static const int kStepX[7]  = {8, 8, 4, 4, 2, 2, 1};
+    static const int kStepY[7]  = {8, 8, 8, 4, 4, 2, 2};
+    const int passes = h.interlace ? 7 : 1;
+    int passW[7], passH[7];
+    size_t rawSize = 0;
+    for (int i = 0; i < passes; ++i) {
+        if (h.interlace) {
+            passW[i] = (h.width - kStartX[i] + kStepX[i] - 1) / kStepX[i];
+            passH[i] = (h.height - kStartY[i] + kStepY[i] - 1) / kStepY[i];
+            if (passW[i] <= 0 || passH[i] <= 0) {
+                passW[i] = passH[i] = 0;
+            }
+        } else {
+            passW[i] = h.width;
+            passH[i] = h.height;
+        }
+        if (passW[i] > 0) {
+            rawSize += (pngRowBytes(h, passW[i]) + 1) * passH[i];
+        }
+    }
+    scratch->inflated.resize(rawSize);
+    std::unique_ptr<Inflater> inflater(new Inflater());
+    if (!inflater->run(idat.data(), idat.size(), scratch->inflated.data(), rawSize)) {
+        return MNN_INPUT_DATA_ERROR;
+    }
+
+    int outChannels;
+    PixelFormat format;
+    switch (h.colorType) {
+        case 0:
+            outChannels = 1;
+            format = PIXEL_GRAY;
+            break;
+        case 2:
+            outChannels = 3;
+            format = PIXEL_RGB;
+            break;
+        case 3:
+            outChannels = palette.hasAlpha ? 4 : 3;
+            format = palette.hasAlpha ? PIXEL_RGBA : PIXEL_RGB;
+            break;
+        default:
+            outChannels = 4;
+            format = PIXEL_RGBA;
+            break;
+    }
+    const size_t outStride = (size_t)h.width * outChannels;
+    scratch->pixels.resize(outStride * h.height);
+    const int bpp = std::max(1, h.samples * h.depth / 8);
+
+    uint8_t* raw = scratch->inflated.data();
+    for (int i = 0; i < passes; ++i) {
+        if (passW[i] == 0) {
+            continue;
+        }
+        const size_t rowBytes = pngRowBytes(h, passW[i]);
+        if (!unfilter(raw, passH[i], rowBytes, bpp)) {
+            return MNN_INPUT_DATA_ERROR;
+        }
+        const int sx = h.interlace ? kStartX[i] : 0;
+        const int sy = h.interlace ? kStartY[i] : 0;
+        const int dx = h.interlace ? kStepX[i] : 1;
+        const int dy = h.interlace ? kStepY[i] : 1;
+        for (int y = 0; y < passH[i]; ++y) {
+            uint8_t* dst = scratch->pixels.data() + (size_t)(sy + y * dy) * outStride + (size_t)sx * outChannels;
+            expandRow(raw + y * (rowBytes + 1) + 1, passW[i], h, palette, outChannels, dst, (size_t)dx * outChannels);
+        }
+        raw += (rowBytes + 1) * passH[i];
+    }
+
+    image->pixels = scratch->pixels.data();
+    image->width = h.width;
+    image->height = h.height;
+    image->stride = (int)outStride;
+    image->format = format;
+    return MNN_NO_ERROR;
+}
+
+// ============================================================================
+//                                  入口
+// ============================================================================
+
+MNN_ErrorCode readInfo(const uint8_t* data, size_t size, Info* info) {
+    if (info == nullptr) {
+        return MNN_INVALID_VALUE;
+    }
+    switch (detect(data, size)) {
+        case CODEC_JPEG: {
+            Scratch unused;
+            return decodeJpeg(data, size, 1, &unused, nullptr, info);
+        }
+        case CODEC_PNG:
+            return decodePng(data, size, nullptr, nullptr, info);
+        default:
+            return MNN_NOT_SUPPORT;
+    }
+}
+
+MNN_ErrorCode decode(const uint8_t* data, size_t size, int scaleDenom, Scratch* scratch, Image* image) {
+    if (scratch == nullptr || image == nullptr) {
+        return MNN_INVALID_VALUE;
+    }
+    if (scaleDenom != 1 && scaleDenom != 2 && scaleDenom != 4 && scaleDenom != 8) {
+        return MNN_INVALID_VALUE;
+    }
+    switch (detect(data, size)) {
+        case CODEC_JPEG:
+            return decodeJpeg(data, size, scaleDenom, scratch, image, nullptr);
+        case CODEC_PNG:
+            return decodePng(data, size, scratch, image, nullptr);
+        default:
+            return MNN_NOT_SUPPORT;
+    }
+}
+
+} // namespace ImageCodec
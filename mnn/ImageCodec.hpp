@@ -0,0 +1,67 @@
+//
+//  ImageCodec.hpp
+//  MNN
+//
+//  内置的 JPEG/PNG 解码器（仅供 ImageDecoder_c.cpp 使用，无第三方依赖，离线可编译）
+//  - JPEG: baseline / extended / progressive huffman，灰度与 YCbCr，支持 DCT 域 1/2、1/4、1/8 降采样
+//  - PNG : 全部颜色类型与位深，支持 Adam7 隔行
+//
+
+#ifndef MNN_ImageCodec_hpp
+#define MNN_ImageCodec_hpp
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+#include "ErrorCode_c.h"
+
+namespace ImageCodec {
+
+enum Codec {
+    CODEC_UNKNOWN = 0,
+    CODEC_JPEG    = 1,
+    CODEC_PNG     = 2
+};
+
+// 解码输出的像素格式（交错存放）
+enum PixelFormat {
+    PIXEL_GRAY = 1,
+    PIXEL_RGB  = 3,
+    PIXEL_RGBA = 4
+};
+
+struct Info {
+    Codec codec = CODEC_UNKNOWN;
+    int width = 0;
+    int height = 0;
+    int channels = 0;       // 文件中的原始通道数
+};
+
+struct Image {
+    const uint8_t* pixels = nullptr;    // 指向 Scratch::pixels，下次解码前有效
+    int width = 0;
+    int height = 0;
+    int stride = 0;
+    PixelFormat format = PIXEL_RGB;
+};
+
+// 可复用的解码缓冲：跨调用保留容量，稳态下解码不再分配内存
+struct Scratch {
+    std::vector<uint8_t> pixels;        // 最终交错像素
+    std::vector<uint8_t> planes;        // JPEG 分量平面
+    std::vector<int16_t> coefficients;  // progressive JPEG 的 DCT 系数
+    std::vector<uint8_t> compressed;    // PNG 拼接后的 IDAT 数据
+    std::vector<uint8_t> inflated;      // PNG 解压后的带滤波扫描线
+};
+
+Codec detect(const uint8_t* data, size_t size);
+
+// 只解析头部，获取尺寸与通道数
+MNN_ErrorCode readInfo(const uint8_t* data, size_t size, Info* info);
+
+// 解码图像；scaleDenom 仅对 JPEG 生效（1/2/4/8），输出尺寸为 ceil(width / scaleDenom)
+MNN_ErrorCode decode(const uint8_t* data, size_t size, int scaleDenom, Scratch* scratch, Image* image);
+
+} // namespace ImageCodec
+
+#endif /* MNN_ImageCodec_hpp */
@@ -0,0 +1,179 @@
+//
+//  ImageDecoder_c.cpp
+//  MNN
+//
+
+#include <ImageDecoder_c.h>
+#include <string.h>
+#include <math.h>
+#include "ImageCodec.hpp"
+
+struct MNN_ImageDecoder {
+    ImageCodec::Scratch scratch;
+    // 按 (config, sourceFormat, dest) 缓存的 ImageProcess，配置不变时跨调用复用
+    struct MNN_ImageProcess* process = nullptr;
+    struct MNN_ImageProcess_Config processConfig;
+    const struct MNN_Tensor* processDest = nullptr;
+};
+
+// -------------------------- 内部工具 --------------------------
+static enum MNN_ImageFormat toImageFormat(ImageCodec::PixelFormat format) {
+    switch (format) {
+        case ImageCodec::PIXEL_GRAY:
+            return MNN_GRAY;
+        case ImageCodec::PIXEL_RGBA:
+            return MNN_RGBA;
+        default:
+            return MNN_RGB;
+    }
+}
+
+static void toImageInfo(const ImageCodec::Info& src, MNN_ImageInfo* dst) {
+    dst->codec = static_cast<MNN_ImageCodec>(src.codec);
+    dst->width = src.width;
+    dst->height = src.height;
+    dst->channels = src.channels;
+}
+
+// 选择最大的 DCT 降采样倍数，使 ceil(width / d) >= needW 且 ceil(height / d) >= needH
+static int chooseScaleDenom(const ImageCodec::Info& info, int needW, int needH) {
+    if (info.codec != ImageCodec::CODEC_JPEG) {
+        return 1;
+    }
+    for (int d = 8; d > 1; d >>= 1) {
+        if ((info.width + d - 1) / d >= needW && (info.height + d - 1) / d >= needH) {
+            return d;
+        }
+    }
+    return 1;
+}
+
+static MNN_Rect makeRect(float w, float h) {
+    MNN_Rect rect;
+    rect.left = 0.0f;
+    rect.top = 0.0f;
+    rect.right = w;
+    rect.bottom = h;
+    return rect;
+}
+
+static struct MNN_ImageProcess* acquireProcess(MNN_ImageDecoder* decoder, const struct MNN_ImageProcess_Config& config,
+                                               const struct MNN_Tensor* dest) {
+    if (decoder->process != nullptr && decoder->processDest == dest &&
+        memcmp(&decoder->processConfig, &config, sizeof(config)) == 0) {
+        return decoder->process;
+    }
+    MNN_ImageProcess_destroy(decoder->process);
+    decoder->process = MNN_ImageProcess_create(&config, dest);
+    decoder->processConfig = config;
+    decoder->processDest = dest;
+    return decoder->process;
+}
+
+// -------------------------- 接口实现 --------------------------
+MNN_ErrorCode MNN_ImageDecoder_getInfo(const uint8_t* data, size_t size, MNN_ImageInfo* info) {
+    if (data == nullptr || info == nullptr) {
+        return MNN_INVALID_VALUE;
+    }
+    ImageCodec::Info header;
+    MNN_ErrorCode code = ImageCodec::readInfo(data, size, &header);
+    if (code == MNN_NO_ERROR) {
+        toImageInfo(header, info);
+    }
+    return code;
+}
+
+struct MNN_ImageDecoder* MNN_ImageDecoder_create() {
+    return new MNN_ImageDecoder();
+}
+
+void MNN_ImageDecoder_destroy(struct MNN_ImageDecoder* decoder) {
+    if (decoder == nullptr) {
+        return;
+    }
+    MNN_ImageProcess_destroy(decoder->process);
+    delete decoder;
+}
+
+MNN_ErrorCode MNN_ImageDecoder_decode(struct MNN_ImageDecoder* decoder, const uint8_t* data, size_t size,
+                                      int minWidth, int minHeight, MNN_DecodedImage* image) {
+    if (decoder == nullptr || data == nullptr || image == nullptr) {
+        return MNN_INVALID_VALUE;
+    }
+    ImageCodec::Info info;
+    MNN_ErrorCode code = ImageCodec::readInfo(data, size, &info);
+    if (code != MNN_NO_ERROR) {
+        return code;
+    }
+    int denom = (minWidth > 0 || minHeight > 0) ? chooseScaleDenom(info, minWidth, minHeight) : 1;
+    ImageCodec::Image decoded;
+    code = ImageCodec::decode(data, size, denom, &decoder->scratch, &decoded);
+    if (code != MNN_NO_ERROR) {
+        return code;
+    }
+    image->pixels = decoded.pixels;
+    image->width = decoded.width;
+    image->height = decoded.height;
+    image->stride = decoded.stride;
+    image->format = toImageFormat(decoded.format);
+    image->scaleDenom = denom;
+    return MNN_NO_ERROR;
+}
+
+MNN_ErrorCode MNN_ImageDecoder_decodeConvert(struct MNN_ImageDecoder* decoder, const uint8_t* data, size_t size,
+                                             const struct MNN_ImageProcess_Config* config, MNN_Matrix_ScaleToFit fit,
+                                             struct MNN_Tensor* dest, MNN_ImageDecodeResult* result) {
+    if (decoder == nullptr || data == nullptr || config == nullptr || dest == nullptr) {
+        return MNN_INVALID_VALUE;
+    }
+    const int dstW = MNN_Tensor_Width(dest);
+    const int dstH = MNN_Tensor_Height(dest);
+    if (dstW <= 0 || dstH <= 0) {
+        return MNN_INVALID_VALUE;
+    }
+    ImageCodec::Info info;
+    MNN_ErrorCode code = ImageCodec::readInfo(data, size, &info);
+    if (code != MNN_NO_ERROR) {
+        return code;
+    }
+
+    // 原图在目标张量中实际占据的尺寸，决定需要解码的最小分辨率
+    const MNN_Rect dstRect = makeRect((float)dstW, (float)dstH);
+    MNN_Matrix9 fitted = MNN_Matrix9_MakeRectToRect(makeRect((float)info.width, (float)info.height), dstRect, fit);
+    const int needW = (int)ceilf(info.width * fitted.m[0]);
+    const int needH = (int)ceilf(info.height * fitted.m[4]);
+    const int denom = chooseScaleDenom(info, needW, needH);
+
+    ImageCodec::Image decoded;
+    code = ImageCodec::decode(data, size, denom, &decoder->scratch, &decoded);
+    if (code != MNN_NO_ERROR) {
+        return code;
+    }
+
+    // ImageProcess 需要 目标 -> 解码图 的映射
+    MNN_Matrix9 decodedToDest = MNN_Matrix9_MakeRectToRect(makeRect((float)decoded.width, (float)decoded.height), dstRect, fit);
+    MNN_Matrix9 destToDecoded;
+    if (!MNN_Matrix9_Invert(decodedToDest, &destToDecoded)) {
+        return MNN_INVALID_VALUE;
+    }
+
+    struct MNN_ImageProcess_Config processConfig = *config;
+    processConfig.sourceFormat = toImageFormat(decoded.format);
+    struct MNN_ImageProcess* process = acquireProcess(decoder, processConfig, dest);
+    if (process == nullptr) {
+        return MNN_NOT_SUPPORT;
+    }
+    MNN_ImageProcess_setMatrix9(process, destToDecoded);
+    code = MNN_ImageProcess_convert(process, decoded.pixels, decoded.width, decoded.height, decoded.stride, dest);
+    if (code != MNN_NO_ERROR || result == nullptr) {
+        return code;
+    }
+
+    toImageInfo(info, &result->info);
+    result->decodedWidth = decoded.width;
+    result->decodedHeight = decoded.height;
+    result->scaleDenom = denom;
+    MNN_Matrix9 decodedToSource = MNN_Matrix9_MakeScale((float)info.width / decoded.width, (float)info.height / decoded.height);
+    result->transform = MNN_Matrix9_Concat(decodedToSource, destToDecoded);
+    return MNN_NO_ERROR;
+}
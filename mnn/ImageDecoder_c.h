@@ -0,0 +1,87 @@
+//
+//  ImageDecoder_c.h
+//  MNN
+//
+//  JPEG/PNG 解码 + ImageProcess 预处理的融合接口：
+//  按目标张量尺寸选择 JPEG DCT 域降采样倍数，只解码所需分辨率，再由 ImageProcess 一次完成缩放/格式转换/归一化
+//
+
+#ifndef MNN_ImageDecoder_c_h
+#define MNN_ImageDecoder_c_h
+
+#include <stddef.h>
+#include <stdint.h>
+#include <ErrorCode_c.h>
+#include <Tensor_c.h>
+#include <Matrix_c.h>
+#include <ImageProcess_c.h>
+
+// 导出宏：Windows下导出，其他平台兼容
+#ifdef MNN_C_EXPORTS
+    // 仅当编译 libmnn.dll 时定义 MNN_C_EXPORTS，此时用 dllexport
+    #define MNN_C_API __declspec(dllexport)
+#else
+    #define MNN_C_API
+#endif
+
+typedef enum {
+    MNN_IMAGE_CODEC_UNKNOWN = 0,
+    MNN_IMAGE_CODEC_JPEG    = 1,
+    MNN_IMAGE_CODEC_PNG     = 2
+} MNN_ImageCodec;
+
+// 图像头部信息
+typedef struct MNN_ImageInfo {
+    MNN_ImageCodec codec;
+    int width;
+    int height;
+    int channels;       // 文件中的原始通道数
+} MNN_ImageInfo;
+
+// 解码结果，pixels 指向解码器内部缓冲，在同一解码器的下一次调用前有效
+typedef struct MNN_DecodedImage {
+    const uint8_t* pixels;
+    int width;
+    int height;
+    int stride;
+    enum MNN_ImageFormat format;    // MNN_GRAY / MNN_RGB / MNN_RGBA
+    int scaleDenom;                 // JPEG DCT 域降采样倍数：1/2/4/8
+} MNN_DecodedImage;
+
+// decodeConvert 的输出
+typedef struct MNN_ImageDecodeResult {
+    MNN_ImageInfo info;             // 原始图像信息
+    int decodedWidth;               // 实际解码尺寸（DCT 降采样后）
+    int decodedHeight;
+    int scaleDenom;
+    MNN_Matrix9 transform;          // 目标张量坐标 -> 原始图像坐标，用于把检测结果映射回原图
+} MNN_ImageDecodeResult;
+
+// 解码器句柄：持有可复用的解码缓冲与按配置缓存的 ImageProcess，非线程安全，每个线程各用一个
+struct MNN_ImageDecoder;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 只解析头部
+MNN_C_API MNN_ErrorCode MNN_ImageDecoder_getInfo(const uint8_t* data, size_t size, MNN_ImageInfo* info);
+
+MNN_C_API struct MNN_ImageDecoder* MNN_ImageDecoder_create();
+MNN_C_API void MNN_ImageDecoder_destroy(struct MNN_ImageDecoder* decoder);
+
+// 解码到内部缓冲；JPEG 选择最大的降采样倍数，使解码尺寸不小于 minWidth x minHeight（传 0 表示全尺寸）
+MNN_C_API MNN_ErrorCode MNN_ImageDecoder_decode(struct MNN_ImageDecoder* decoder, const uint8_t* data, size_t size,
+                                                int minWidth, int minHeight, MNN_DecodedImage* image);
+
+// 解码并转换到目标张量：config->sourceFormat 被忽略（由解码结果决定），fit 决定拉伸(kFill)或等比缩放；
+// 等比缩放时留白区域由 config->wrap 决定，通常应使用 MNN_ZERO。result 可为 NULL
+MNN_C_API MNN_ErrorCode MNN_ImageDecoder_decodeConvert(struct MNN_ImageDecoder* decoder, const uint8_t* data, size_t size,
+                                                       const struct MNN_ImageProcess_Config* config, MNN_Matrix_ScaleToFit fit,
+                                                       struct MNN_Tensor* dest, MNN_ImageDecodeResult* result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MNN_ImageDecoder_c_h */
@@ -10,6 +10,22 @@
 #include "MNN/ImageProcess.hpp"
 #include "MNN/Tensor.hpp"
 #include "MNN/Matrix.h"
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define MNN_IMAGEPROCESS_USE_SSE
+#if defined(__F16C__)
+#include <immintrin.h>
+#define MNN_IMAGEPROCESS_USE_F16C
+#endif
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#define MNN_IMAGEPROCESS_USE_NEON
+#endif
 
 using namespace MNN;
 using namespace MNN::CV;
@@ -87,6 +103,16 @@ void MNN_ImageProcess_setMatrix(struct MNN_ImageProcess* imageProcess, const str
     cppProcess->setMatrix(*cppMatrix);
 }
 
+void MNN_ImageProcess_setMatrix9(struct MNN_ImageProcess* imageProcess, MNN_Matrix9 matrix) {
+    if (imageProcess == nullptr) {
+        return;
+    }
+    ImageProcess* cppProcess = reinterpret_cast<ImageProcess*>(imageProcess);
+    Matrix cppMatrix;
+    cppMatrix.set9(matrix.m);
+    cppProcess->setMatrix(cppMatrix);
+}
+
 // Conversion methods
 MNN_ErrorCode MNN_ImageProcess_convert(const struct MNN_ImageProcess* imageProcess, const uint8_t* source, int iw, int ih, int stride, struct MNN_Tensor* dest) {
     //const ImageProcess* cppProcess = reinterpret_cast<const ImageProcess*>(imageProcess);
@@ -108,6 +134,202 @@ MNN_ErrorCode MNN_ImageProcess_convert_v2(const struct MNN_ImageProcess* imagePr
     return static_cast<MNN_ErrorCode>(cppError);
 }
 
+// Low-precision output helpers
+// Row tiles are sized so the fp32 staging buffer stays cache resident
+static const int kQuantTileFloats = 16 * 1024;
+
+// IEEE half conversion with round to nearest even (handles subnormals, overflow to inf and NaN)
+static inline uint16_t floatToHalf(float value) {
+    const uint32_t f32Infinity = 255u << 23;
+    const uint32_t f16Max = (127u + 16u) << 23;
+    const uint32_t denormMagic = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+    uint32_t f;
+    memcpy(&f, &value, sizeof(f));
+    const uint32_t sign = f & 0x80000000u;
+    f ^= sign;
+    uint16_t half;
+    if (f >= f16Max) {
+        half = f > f32Infinity ? 0x7e00 : 0x7c00;
+    } else if (f < (113u << 23)) {
+        float magic;
+        float v;
+        memcpy(&magic, &denormMagic, sizeof(magic));
+        memcpy(&v, &f, sizeof(v));
+        v += magic;
+        memcpy(&f, &v, sizeof(f));
+        half = (uint16_t)(f - denormMagic);
+    } else {
+        const uint32_t mantissaOdd = (f >> 13) & 1;
+        f += (uint32_t)(15 - 127) * (1u << 23) + 0xfff;
+        f += mantissaOdd;
+        half = (uint16_t)(f >> 13);
+    }
+    return (uint16_t)(half | (sign >> 16));
+}
+
+static void floatToHalfRow(const float* src, uint16_t* dst, int count) {
+    int i = 0;
+#if defined(MNN_IMAGEPROCESS_USE_F16C)
+    for (; i + 8 <= count; i += 8) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),
+                         _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT));
+    }
+#elif defined(MNN_IMAGEPROCESS_USE_NEON)
+    for (; i + 4 <= count; i += 4) {
+        vst1_u16(dst + i, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(src + i))));
+    }
+#endif
+    for (; i < count; ++i) {
+        dst[i] = floatToHalf(src[i]);
+    }
+}
+
+// q = clamp(round(v * invScale) + zeroPoint, lo, hi); the product is clamped first so huge values saturate instead of wrapping
+template <typename T, int Lo, int Hi>
+static inline T quantizeScalar(float v, float invScale, int zeroPoint) {
+    float scaled = std::min(std::max(v * invScale, -65536.0f), 65536.0f);
+    int q = (int)lrintf(scaled) + zeroPoint;
+    return (T)std::min(std::max(q, Lo), Hi);
+}
+
+static void quantizeRowInt8(const float* src, int8_t* dst, int count, float invScale, int zeroPoint) {
+    int i = 0;
+#if defined(MNN_IMAGEPROCESS_USE_SSE)
+    const __m128 inv = _mm_set1_ps(invScale);
+    const __m128 lo = _mm_set1_ps(-65536.0f);
+    const __m128 hi = _mm_set1_ps(65536.0f);
+    const __m128i zp = _mm_set1_epi32(zeroPoint);
+    for (; i + 16 <= count; i += 16) {
+        __m128i q[4];
+        for (int k = 0; k < 4; ++k) {
+            __m128 v = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(src + i + 4 * k), inv), lo), hi);
+            q[k] = _mm_add_epi32(_mm_cvtps_epi32(v), zp);
+        }
+        __m128i packed = _mm_packs_epi16(_mm_packs_epi32(q[0], q[1]), _mm_packs_epi32(q[2], q[3]));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), packed);
+    }
+#elif defined(MNN_IMAGEPROCESS_USE_NEON)
+    const float32x4_t inv = vdupq_n_f32(invScale);
+    const float32x4_t lo = vdupq_n_f32(-65536.0f);
+    const float32x4_t hi = vdupq_n_f32(65536.0f);
+    const int32x4_t zp = vdupq_n_s32(zeroPoint);
+    for (; i + 8 <= count; i += 8) {
+        float32x4_t v0 = vminq_f32(vmaxq_f32(vmulq_f32(vld1q_f32(src + i), inv), lo), hi);
+        float32x4_t v1 = vminq_f32(vmaxq_f32(vmulq_f32(vld1q_f32(src + i + 4), inv), lo), hi);
+        int32x4_t q0 = vaddq_s32(vcvtnq_s32_f32(v0), zp);
+        int32x4_t q1 = vaddq_s32(vcvtnq_s32_f32(v1), zp);
+        vst1_s8(dst + i, vqmovn_s16(vcombine_s16(vqmovn_s32(q0), vqmovn_s32(q1))));
+    }
+#endif
+    for (; i < count; ++i) {
+        dst[i] = quantizeScalar<int8_t, -128, 127>(src[i], invScale, zeroPoint);
+    }
+}
+
+static void quantizeRowUint8(const float* src, uint8_t* dst, int count, float invScale, int zeroPoint) {
+    int i = 0;
+#if defined(MNN_IMAGEPROCESS_USE_SSE)
+    const __m128 inv = _mm_set1_ps(invScale);
+    const __m128 lo = _mm_set1_ps(-65536.0f);
+    const __m128 hi = _mm_set1_ps(65536.0f);
+    const __m128i zp = _mm_set1_epi32(zeroPoint);
+    for (; i + 16 <= count; i += 16) {
+        __m128i q[4];
+        for (int k = 0; k < 4; ++k) {
+            __m128 v = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(src + i + 4 * k), inv), lo), hi);
+            q[k] = _mm_add_epi32(_mm_cvtps_epi32(v), zp);
+        }
+        __m128i packed = _mm_packus_epi16(_mm_packs_epi32(q[0], q[1]), _mm_packs_epi32(q[2], q[3]));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), packed);
+    }
+#elif defined(MNN_IMAGEPROCESS_USE_NEON)
+    const float32x4_t inv = vdupq_n_f32(invScale);
+    const float32x4_t lo = vdupq_n_f32(-65536.0f);
+    const float32x4_t hi = vdupq_n_f32(65536.0f);
+    const int32x4_t zp = vdupq_n_s32(zeroPoint);
+    for (; i + 8 <= count; i += 8) {
+        float32x4_t v0 = vminq_f32(vmaxq_f32(vmulq_f32(vld1q_f32(src + i), inv), lo), hi);
+        float32x4_t v1 = vminq_f32(vmaxq_f32(vmulq_f32(vld1q_f32(src + i + 4), inv), lo), hi);
+        int32x4_t q0 = vaddq_s32(vcvtnq_s32_f32(v0), zp);
+        int32x4_t q1 = vaddq_s32(vcvtnq_s32_f32(v1), zp);
+        vst1_u8(dst + i, vqmovun_s16(vcombine_s16(vqmovn_s32(q0), vqmovn_s32(q1))));
+    }
+#endif
+    for (; i < count; ++i) {
+        dst[i] = quantizeScalar<uint8_t, 0, 255>(src[i], invScale, zeroPoint);
+    }
+}
+
+MNN_ErrorCode MNN_ImageProcess_convertQuant(struct MNN_ImageProcess* imageProcess, const uint8_t* source, int iw, int ih, int stride,
+                                           void* dest, int ow, int oh, int outputBpp, int outputStride, halide_type_t type,
+                                           float scale, int zeroPoint) {
+    if (imageProcess == nullptr || source == nullptr || dest == nullptr || ow <= 0 || oh <= 0 || outputBpp <= 0) {
+        return MNN_INVALID_VALUE;
+    }
+    enum { OUT_HALF, OUT_INT8, OUT_UINT8 } kind;
+    if (type.code == halide_type_float && type.bits == 16) {
+        kind = OUT_HALF;
+    } else if (type.code == halide_type_int && type.bits == 8) {
+        kind = OUT_INT8;
+    } else if (type.code == halide_type_uint && type.bits == 8 && scale > 0.0f) {
+        kind = OUT_UINT8;
+    } else if ((type.code == halide_type_float && type.bits == 32) || (type.code == halide_type_uint && type.bits == 8)) {
+        return MNN_ImageProcess_convert_v2(imageProcess, source, iw, ih, stride, dest, ow, oh, outputBpp, outputStride, type);
+    } else {
+        return MNN_NOT_SUPPORT;
+    }
+    if (kind != OUT_HALF && !(scale > 0.0f)) {
+        return MNN_INVALID_VALUE;
+    }
+
+    ImageProcess* cppProcess = reinterpret_cast<ImageProcess*>(imageProcess);
+    const int rowElements = ow * outputBpp;
+    if (outputStride == 0) {
+        outputStride = rowElements;
+    }
+    const size_t elementBytes = kind == OUT_HALF ? 2 : 1;
+    const int tileRows = std::min(oh, std::max(1, kQuantTileFloats / rowElements));
+    thread_local std::vector<float> tile;
+    tile.resize((size_t)tileRows * rowElements);
+
+    halide_type_t floatType;
+    floatType.code = halide_type_float;
+    floatType.bits = 32;
+    floatType.lanes = 1;
+    const float invScale = kind == OUT_HALF ? 1.0f : 1.0f / scale;
+
+    // Each tile is produced by shifting the transform down by y0 rows, so sampling is identical to a full-frame convert
+    const Matrix base = cppProcess->matrix();
+    ErrorCode cppError = NO_ERROR;
+    for (int y0 = 0; y0 < oh && cppError == NO_ERROR; y0 += tileRows) {
+        const int rows = std::min(tileRows, oh - y0);
+        Matrix tileMatrix = base;
+        tileMatrix.preTranslate(0.0f, (float)y0);
+        cppProcess->setMatrix(tileMatrix);
+        cppError = cppProcess->convert(source, iw, ih, stride, tile.data(), ow, rows, outputBpp, rowElements, floatType);
+        if (cppError != NO_ERROR) {
+            break;
+        }
+        for (int r = 0; r < rows; ++r) {
+            const float* src = tile.data() + (size_t)r * rowElements;
+            uint8_t* dst = static_cast<uint8_t*>(dest) + (size_t)(y0 + r) * outputStride * elementBytes;
+            switch (kind) {
+                case OUT_HALF:
+                    floatToHalfRow(src, reinterpret_cast<uint16_t*>(dst), rowElements);
+                    break;
+                case OUT_INT8:
+                    quantizeRowInt8(src, reinterpret_cast<int8_t*>(dst), rowElements, invScale, zeroPoint);
+                    break;
+                default:
+                    quantizeRowUint8(src, dst, rowElements, invScale, zeroPoint);
+                    break;
+            }
+        }
+    }
+    cppProcess->setMatrix(base);
+    return static_cast<MNN_ErrorCode>(cppError);
+}
+
 // Tensor creation
 struct MNN_Tensor* MNN_ImageProcess_createImageTensor(halide_type_t type, int w, int h, int bpp, void* p) {
     Tensor* cppTensor = ImageProcess::createImageTensor(type, w, h, bpp, p);
@@ -103,11 +103,25 @@ MNN_C_API void MNN_ImageProcess_destroy(struct MNN_ImageProcess* imageProcess);
 // Note: Since Matrix is a separate class, we'll expose limited functionality here
 // as the user hasn't asked to convert Matrix.hpp yet
 MNN_C_API void MNN_ImageProcess_setMatrix(struct MNN_ImageProcess* imageProcess, const struct MNN_Matrix* matrix);
+// Set the transform from a value-type matrix (dest coordinates -> source coordinates), no heap allocation
+MNN_C_API void MNN_ImageProcess_setMatrix9(struct MNN_ImageProcess* imageProcess, MNN_Matrix9 matrix);
 
 // Conversion methods
 MNN_C_API MNN_ErrorCode MNN_ImageProcess_convert(const struct MNN_ImageProcess* imageProcess, const uint8_t* source, int iw, int ih, int stride, struct MNN_Tensor* dest);
 MNN_C_API MNN_ErrorCode MNN_ImageProcess_convert_v2(const struct MNN_ImageProcess* imageProcess, const uint8_t* source, int iw, int ih, int stride,
                                          void* dest, int ow, int oh, int outputBpp, int outputStride, struct halide_type_t type);
+// Convert straight to a low-precision destination in the same pass as resize and normalization:
+//   float16 : IEEE half, round to nearest even (scale / zeroPoint ignored)
+//   int8    : q = clamp(round(v / scale) + zeroPoint, -128, 127)
+//   uint8   : q = clamp(round(v / scale) + zeroPoint, 0, 255); with scale <= 0 the raw uint8 path of convert_v2 is used
+//   float32 : same as convert_v2
+// The image is processed in cache-sized row tiles, so no full-size fp32 intermediate is written.
+// outputBpp must be given explicitly; outputStride is in elements (0 means ow * outputBpp).
+// Each tile temporarily shifts the process matrix, so the call is not thread-safe: one process must not be
+// used by convertQuant and any other call at the same time. The matrix is restored before returning.
+MNN_C_API MNN_ErrorCode MNN_ImageProcess_convertQuant(struct MNN_ImageProcess* imageProcess, const uint8_t* source, int iw, int ih, int stride,
+                                           void* dest, int ow, int oh, int outputBpp, int outputStride, struct halide_type_t type,
+                                           float scale, int zeroPoint);
 
 // Tensor creation
 MNN_C_API struct MNN_Tensor* MNN_ImageProcess_createImageTensor(struct halide_type_t type, int w, int h, int bpp, void* p);
@@ -9,6 +9,11 @@
 #include "Interpreter_c.h"
 #include "MNN/Interpreter.hpp"
 #include "MNN/MNNForwardType.h"
+#include "Metrics.hpp"
+#include "Recorder.hpp"
+#include "RuntimeRegistry.hpp"
+#include <atomic>
+#include <chrono>
 #include <vector>
 #include <cstring>
 
@@ -100,11 +105,38 @@ struct MNN_Interpreter* MNN_Interpreter_createFromBuffer(const void* buffer, siz
     return reinterpret_cast<struct MNN_Interpreter*>(Interpreter::createFromBuffer(buffer, size));
 }
 
+/**
+ * @brief create net from the model buffer of another net.
+ * @param net    given Interpreter.
+ * @return created net if success, NULL otherwise.
+ */
+struct MNN_Interpreter* MNN_Interpreter_createReplica(const struct MNN_Interpreter* net) {
+    if (net == nullptr) {
+        return nullptr;
+    }
+    auto cppBuffer = reinterpret_cast<const Interpreter*>(net)->getModelBuffer();
+    if (cppBuffer.first == nullptr || cppBuffer.second == 0) {
+        return nullptr;
+    }
+    return reinterpret_cast<struct MNN_Interpreter*>(Interpreter::createFromBuffer(cppBuffer.first, cppBuffer.second));
+}
+
 /**
  * @brief destroy Interpreter
  * @param net    given Interpreter to release.
  */
 void MNN_Interpreter_destroy(struct MNN_Interpreter* net) {
+    if (Recorder::active()) {
+        Recorder::forget(net);
+    }
+    Metrics::forgetInterpreter(net);
+    if (RuntimeRegistry::active()) {
+        // 共享运行时上的 Session 随 Interpreter 一起释放，释放后退还线程预算
+        auto claimed = RuntimeRegistry::claim(net, nullptr);
+        Interpreter::destroy(reinterpret_cast<Interpreter*>(net));
+        RuntimeRegistry::drop(claimed);
+        return;
+    }
     Interpreter::destroy(reinterpret_cast<Interpreter*>(net));
 }
 
@@ -188,14 +220,24 @@ void MNN_Interpreter_setSessionHintArray(struct MNN_Interpreter* net, enum MNN_H
 struct MNN_Session* MNN_Interpreter_createSession(struct MNN_Interpreter* net, const struct MNN_ScheduleConfig* config) {
     auto cppNet = reinterpret_cast<Interpreter*>(net);
     auto cppConfig = convertToCppScheduleConfig(config);
-    return reinterpret_cast<struct MNN_Session*>(cppNet->createSession(cppConfig));
+    uint64_t begin = Metrics::enabled() ? Metrics::nowNs() : 0;
+    auto session = reinterpret_cast<struct MNN_Session*>(cppNet->createSession(cppConfig));
+    if (begin != 0) {
+        Metrics::record(net, session, MNN_METRIC_OP_CREATE_SESSION, Metrics::nowNs() - begin);
+    }
+    return session;
 }
 
 MNN_Session* MNN_Interpreter_createSessionWithRuntime(MNN_Interpreter* net, const MNN_ScheduleConfig* config, const MNN_RuntimeInfo* runtime) {
     auto cppNet = reinterpret_cast<Interpreter*>(net);
     auto cppConfig = convertToCppScheduleConfig(config);
     auto cppRuntime = *reinterpret_cast<const RuntimeInfo*>(runtime);
-    return reinterpret_cast<struct MNN_Session*>(cppNet->createSession(cppConfig, cppRuntime));
+    uint64_t begin = Metrics::enabled() ? Metrics::nowNs() : 0;
+    auto session = reinterpret_cast<struct MNN_Session*>(cppNet->createSession(cppConfig, cppRuntime));
+    if (begin != 0) {
+        Metrics::record(net, session, MNN_METRIC_OP_CREATE_SESSION, Metrics::nowNs() - begin);
+    }
+    return session;
 }
 
 MNN_Session* MNN_Interpreter_createMultiPathSession(MNN_Interpreter* net, const MNN_ScheduleConfig* configs, int configsCount) {
@@ -236,6 +278,13 @@ MNN_Session* MNN_Interpreter_createMultiPathSessionWithRuntime(MNN_Interpreter*
 MNN_BOOL MNN_Interpreter_releaseSession(struct MNN_Interpreter* net, struct MNN_Session* session) {
     auto cppNet = reinterpret_cast<Interpreter*>(net);
     auto cppSession = reinterpret_cast<Session*>(session);
+    Metrics::forgetSession(session);
+    if (RuntimeRegistry::active()) {
+        auto claimed = RuntimeRegistry::claim(net, session);
+        MNN_BOOL released = cppNet->releaseSession(cppSession);
+        RuntimeRegistry::drop(claimed);
+        return released;
+    }
     return cppNet->releaseSession(cppSession);
 }
 
@@ -248,6 +297,7 @@ MNN_BOOL MNN_Interpreter_releaseSession(struct MNN_Interpreter* net, struct MNN_
 void MNN_Interpreter_resizeSession(struct MNN_Interpreter* net, struct MNN_Session* session) {
     auto cppNet = reinterpret_cast<Interpreter*>(net);
     auto cppSession = reinterpret_cast<Session*>(session);
+    Metrics::ScopedTimer timer(net, session, MNN_METRIC_OP_RESIZE);
     cppNet->resizeSession(cppSession);
 }
 
@@ -261,6 +311,7 @@ void MNN_Interpreter_resizeSession(struct MNN_Interpreter* net, struct MNN_Sessi
 void MNN_Interpreter_resizeSessionEx(struct MNN_Interpreter* net, struct MNN_Session* session, int needRelloc) {
     auto cppNet = reinterpret_cast<Interpreter*>(net);
     auto cppSession = reinterpret_cast<Session*>(session);
+    Metrics::ScopedTimer timer(net, session, MNN_METRIC_OP_RESIZE);
     cppNet->resizeSession(cppSession, needRelloc);
 }
 
@@ -319,7 +370,15 @@ MNN_ErrorCode MNN_Interpreter_updateSessionToModel(struct MNN_Interpreter* net,
 MNN_ErrorCode MNN_Interpreter_runSession(const struct MNN_Interpreter* net, struct MNN_Session* session) {
     auto cppNet = reinterpret_cast<const Interpreter*>(net);
     auto cppSession = reinterpret_cast<Session*>(session);
-    return static_cast<MNN_ErrorCode>(cppNet->runSession(cppSession));
+    Metrics::ScopedTimer timer(net, session, MNN_METRIC_OP_RUN);
+    Recorder::Capture* capture = Recorder::active() ? Recorder::begin(net, session) : nullptr;
+    if (capture == nullptr) {
+        return static_cast<MNN_ErrorCode>(cppNet->runSession(cppSession));
+    }
+    uint64_t begin = Metrics::nowNs();
+    auto code = static_cast<MNN_ErrorCode>(cppNet->runSession(cppSession));
+    Recorder::end(capture, Metrics::nowNs() - begin, code);
+    return code;
 }
 
 /**
@@ -332,6 +391,9 @@ MNN_ErrorCode MNN_Interpreter_runSession(const struct MNN_Interpreter* net, stru
 struct MNN_Tensor* MNN_Interpreter_getSessionInput(struct MNN_Interpreter* net, const struct MNN_Session* session, const char* name) {
     auto cppNet = reinterpret_cast<Interpreter*>(net);
     auto cppSession = reinterpret_cast<const Session*>(session);
+    if (Metrics::enabled()) {
+        Metrics::setCurrent(net, session);
+    }
     return reinterpret_cast<struct MNN_Tensor*>(cppNet->getSessionInput(cppSession, name));
 }
 
@@ -345,6 +407,9 @@ struct MNN_Tensor* MNN_Interpreter_getSessionInput(struct MNN_Interpreter* net,
 struct MNN_Tensor* MNN_Interpreter_getSessionOutput(struct MNN_Interpreter* net, const struct MNN_Session* session, const char* name) {
     auto cppNet = reinterpret_cast<Interpreter*>(net);
     auto cppSession = reinterpret_cast<const Session*>(session);
+    if (Metrics::enabled()) {
+        Metrics::setCurrent(net, session);
+    }
     return reinterpret_cast<struct MNN_Tensor*>(cppNet->getSessionOutput(cppSession, name));
 }
 
@@ -440,7 +505,11 @@ static int wrapTensorCallback(const std::vector<MNN::Tensor*>& cppTensors, const
     int result = 0;
     if (ctx->callback) {
         // 调用C的回调函数
+        uint64_t begin = Metrics::enabled() ? Metrics::nowNs() : 0;
         result = ctx->callback(cTensors, cppTensors.size(), opName.c_str(), ctx->userData);
+        if (begin != 0) {
+            Metrics::recordCurrent(MNN_METRIC_OP_CALLBACK, Metrics::nowNs() - begin);
+        }
     }
 
     // 3. 释放临时数组
@@ -467,6 +536,9 @@ MNN_ErrorCode MNN_Interpreter_runSessionWithCallBack(const MNN_Interpreter* inte
     };
 
     // 调用MNN的C++接口（sync转换为bool）
+    // current 先于 timer 构造，timer 记录（并重设 current）之后才清除
+    Metrics::ScopedCurrent current(interpreter, session);
+    Metrics::ScopedTimer timer(interpreter, session, MNN_METRIC_OP_RUN);
     return static_cast<MNN_ErrorCode>(cppNet->runSessionWithCallBack(cppSession, beforeCallback, afterCallback, sync != 0));
 }
 
@@ -488,7 +560,11 @@ static int wrapTensorCallbackWithInfo(const std::vector<Tensor*>& cpp_tensors,
     int result = 0;
     if (ctx->callback) {
         // 调用C的回调函数
+        uint64_t begin = Metrics::enabled() ? Metrics::nowNs() : 0;
         result = ctx->callback(c_tensors, tensor_count, c_info, ctx->userData);
+        if (begin != 0) {
+            Metrics::recordCurrent(MNN_METRIC_OP_CALLBACK, Metrics::nowNs() - begin);
+        }
     }
 
     // 4. 释放临时数组
@@ -515,12 +591,87 @@ MNN_ErrorCode MNN_Interpreter_runSessionWithCallBackInfo(const MNN_Interpreter*
     };
 
     // 调用MNN C++接口
+    // current 先于 timer 构造，timer 记录（并重设 current）之后才清除
+    Metrics::ScopedCurrent current(interpreter, session);
+    Metrics::ScopedTimer timer(interpreter, session, MNN_METRIC_OP_RUN);
     ErrorCode cpp_err = cpp_interpreter->runSessionWithCallBackInfo(cpp_session, cpp_before, cpp_after, sync != 0);
     
     // 转换C++错误码到C错误码
     return static_cast<MNN_ErrorCode>(cpp_err);
 }
 
+struct MNN_CancelToken {
+    std::atomic<bool> cancelled;
+};
+
+MNN_CancelToken* MNN_CancelToken_create(void) {
+    auto token = new MNN_CancelToken();
+    token->cancelled.store(false);
+    return token;
+}
+
+void MNN_CancelToken_destroy(MNN_CancelToken* token) {
+    delete token;
+}
+
+void MNN_CancelToken_cancel(MNN_CancelToken* token) {
+    if (token != nullptr) {
+        token->cancelled.store(true, std::memory_order_relaxed);
+    }
+}
+
+MNN_BOOL MNN_CancelToken_isCancelled(const MNN_CancelToken* token) {
+    return token != nullptr && token->cancelled.load(std::memory_order_relaxed);
+}
+
+void MNN_CancelToken_reset(MNN_CancelToken* token) {
+    if (token != nullptr) {
+        token->cancelled.store(false, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief run session with a deadline and / or cancellation token.
+ * 检查放在 C++ 回调里，不经过 C 函数指针也不回到 Go：
+ * before 返回 false 跳过后续算子，after 返回 false 立即结束本次运行
+ */
+MNN_ErrorCode MNN_Interpreter_runSessionWithDeadline(const MNN_Interpreter* net, MNN_Session* session,
+                                                     uint64_t timeoutUs, const MNN_CancelToken* token) {
+    if (timeoutUs == 0 && token == nullptr) {
+        return MNN_Interpreter_runSession(net, session);
+    }
+    auto cppNet = reinterpret_cast<const Interpreter*>(net);
+    auto cppSession = reinterpret_cast<const Session*>(session);
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(timeoutUs);
+    MNN_ErrorCode stopped = MNN_NO_ERROR;
+    auto proceed = [&]() -> bool {
+        if (stopped != MNN_NO_ERROR) {
+            return false;
+        }
+        if (token != nullptr && token->cancelled.load(std::memory_order_relaxed)) {
+            stopped = MNN_CANCELLED;
+        } else if (timeoutUs > 0 && std::chrono::steady_clock::now() >= deadline) {
+            stopped = MNN_DEADLINE_EXCEEDED;
+        }
+        return stopped == MNN_NO_ERROR;
+    };
+    if (!proceed()) {
+        return stopped;
+    }
+    TensorCallBack before = [&](const std::vector<Tensor*>&, const std::string&) -> bool {
+        return proceed();
+    };
+    TensorCallBack after = [&](const std::vector<Tensor*>&, const std::string&) -> bool {
+        return proceed();
+    };
+    Metrics::ScopedTimer timer(net, session, MNN_METRIC_OP_RUN);
+    ErrorCode code = cppNet->runSessionWithCallBack(cppSession, before, after, true);
+    if (stopped != MNN_NO_ERROR) {
+        return stopped;
+    }
+    return static_cast<MNN_ErrorCode>(code);
+}
+
 // 转换std::map<std::string, Tensor*>到MNNNamedTensorList
 static MNN_NamedTensorList convertMapToTensorList(const std::map<std::string, Tensor*>& tensorMap) {
     MNN_NamedTensorList list;
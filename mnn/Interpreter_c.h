@@ -290,6 +290,13 @@ struct MNN_CallbackWithInfoContext {
 MNN_C_API const char* MNN_getVersion();
 MNN_C_API struct MNN_Interpreter* MNN_Interpreter_createFromFile(const char* file);
 MNN_C_API struct MNN_Interpreter* MNN_Interpreter_createFromBuffer(const void* buffer, size_t size);
+/**
+ * @brief create an independent interpreter from net's model buffer. MNN serializes session creation,
+ * resize and runSession per interpreter, so sessions that must run in parallel need separate interpreters.
+ * Session modes, hints, cache and external files set on net are not copied.
+ * @return NULL when net's model was released (releaseModel) or cannot be loaded again.
+ */
+MNN_C_API struct MNN_Interpreter* MNN_Interpreter_createReplica(const struct MNN_Interpreter* net);
 MNN_C_API void MNN_Interpreter_destroy(struct MNN_Interpreter* net);
 MNN_C_API void MNN_Interpreter_setSessionMode(struct MNN_Interpreter* net, enum MNN_SessionMode mode);
 MNN_C_API void MNN_Interpreter_setCacheFile(struct MNN_Interpreter* net, const char* cacheFile, size_t keySize);
@@ -346,6 +353,23 @@ MNN_C_API MNN_ErrorCode MNN_Interpreter_runSessionWithCallBackInfo(const MNN_Int
                                                         MNN_TensorCallBackWithInfo before, MNN_TensorCallBackWithInfo after,
                                                         MNN_BOOL sync, void* userData);
 
+/** 协作式取消：令牌可在任意线程上取消，运行中的 Session 在下一个算子边界处停止 */
+typedef struct MNN_CancelToken MNN_CancelToken;
+MNN_C_API MNN_CancelToken* MNN_CancelToken_create(void);
+MNN_C_API void MNN_CancelToken_destroy(MNN_CancelToken* token);
+MNN_C_API void MNN_CancelToken_cancel(MNN_CancelToken* token);
+MNN_C_API MNN_BOOL MNN_CancelToken_isCancelled(const MNN_CancelToken* token);
+MNN_C_API void MNN_CancelToken_reset(MNN_CancelToken* token);
+/**
+ * @brief run session, checking the deadline and token natively around every op.
+ * @param timeoutUs relative deadline in microseconds, 0 for none.
+ * @param token optional cancellation token.
+ * @return MNN_DEADLINE_EXCEEDED or MNN_CANCELLED when stopped early, the outputs are then undefined;
+ *         otherwise the result of running.
+ */
+MNN_C_API MNN_ErrorCode MNN_Interpreter_runSessionWithDeadline(const MNN_Interpreter* net, MNN_Session* session,
+                                                               uint64_t timeoutUs, const MNN_CancelToken* token);
+
 // 张量名称-指针对（用于传递std::map的内容）
 typedef struct {
     const char* name;
@@ -2,6 +2,16 @@
 #include "MNN/Matrix.h"
 #include <MNN/Rect.h>
 #include <cstdlib>
+#include <cstring>
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define MNN_MATRIX_USE_SSE
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define MNN_MATRIX_USE_NEON
+#endif
 
 using namespace MNN::CV;
 
@@ -313,40 +323,208 @@ void MNN_Matrix_setAffine(MNN_Matrix* matrix, const float affine[6]) {
     reinterpret_cast<Matrix*>(matrix)->setAffine(affine);
 }
 
-/*void MNN_Matrix_mapPoints(const MNN_Matrix* matrix, MNN_Point dst[], const MNN_Point src[], int count) {
-    Point* c_src = new Point[count];
-    Point* c_dst = new Point[count];
-    for (int i = 0; i < count; i++) {
-        c_src[i].fX = src[i].x;
-        c_src[i].fY = src[i].y;
+// -------------------------- 批量点映射 --------------------------
+// MNN.dll 未导出 Matrix::mapPoints 依赖的 gMapXYProcs（见下方说明），这里按类型掩码自行实现映射内核。
+// 点以 {x, y} 交错存放的 float 数组处理（MNN_Point 与 float[2] 内存布局一致），每次处理 2 个点（4 个 float）。
+
+// 直接从 fMat 计算类型掩码，不依赖 Matrix 的缓存与未导出符号
+static uint32_t computeMapTypeMask(const float m[9]) {
+    if (m[kMPersp0] != 0 || m[kMPersp1] != 0 || m[kMPersp2] != 1) {
+        return kPerspective_Mask | kAffine_Mask | kScale_Mask | kTranslate_Mask;
     }
-    reinterpret_cast<const Matrix*>(matrix)->mapPoints(c_dst, c_src, count);
-    for (int i = 0; i < count; i++) {
-        dst[i].x = c_dst[i].fX;
-        dst[i].y = c_dst[i].fY;
+    uint32_t mask = kIdentity_Mask;
+    if (m[kMTransX] != 0 || m[kMTransY] != 0) {
+        mask |= kTranslate_Mask;
     }
-    delete[] c_src;
-    delete[] c_dst;
+    if (m[kMSkewX] != 0 || m[kMSkewY] != 0) {
+        mask |= kAffine_Mask | kScale_Mask;
+    } else if (m[kMScaleX] != 1 || m[kMScaleY] != 1) {
+        mask |= kScale_Mask;
+    }
+    return mask;
 }
 
-void MNN_Matrix_mapPointsInPlace(const MNN_Matrix* matrix, MNN_Point pts[], int count) {
-    Point* c_pts = new Point[count];
-    for (int i = 0; i < count; i++) {
-        c_pts[i].fX = pts[i].x;
-        c_pts[i].fY = pts[i].y;
+// 平移：x + tx, y + ty
+static void mapPointsTranslate(const float m[9], float* dst, const float* src, int count) {
+    const float tx = m[kMTransX], ty = m[kMTransY];
+    int i = 0;
+#if defined(MNN_MATRIX_USE_SSE)
+    const __m128 t = _mm_setr_ps(tx, ty, tx, ty);
+    for (; i + 2 <= count; i += 2) {
+        _mm_storeu_ps(dst + 2 * i, _mm_add_ps(_mm_loadu_ps(src + 2 * i), t));
     }
-    reinterpret_cast<const Matrix*>(matrix)->mapPoints(c_pts, count);
-    for (int i = 0; i < count; i++) {
-        pts[i].x = c_pts[i].fX;
-        pts[i].y = c_pts[i].fY;
+#elif defined(MNN_MATRIX_USE_NEON)
+    const float tv[4] = {tx, ty, tx, ty};
+    const float32x4_t t = vld1q_f32(tv);
+    for (; i + 2 <= count; i += 2) {
+        vst1q_f32(dst + 2 * i, vaddq_f32(vld1q_f32(src + 2 * i), t));
+    }
+#endif
+    for (; i < count; i++) {
+        dst[2 * i]     = src[2 * i] + tx;
+        dst[2 * i + 1] = src[2 * i + 1] + ty;
+    }
+}
+
+// 缩放+平移：x * sx + tx, y * sy + ty
+static void mapPointsScaleTranslate(const float m[9], float* dst, const float* src, int count) {
+    const float sx = m[kMScaleX], sy = m[kMScaleY];
+    const float tx = m[kMTransX], ty = m[kMTransY];
+    int i = 0;
+#if defined(MNN_MATRIX_USE_SSE)
+    const __m128 s = _mm_setr_ps(sx, sy, sx, sy);
+    const __m128 t = _mm_setr_ps(tx, ty, tx, ty);
+    for (; i + 2 <= count; i += 2) {
+        _mm_storeu_ps(dst + 2 * i, _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(src + 2 * i), s), t));
+    }
+#elif defined(MNN_MATRIX_USE_NEON)
+    const float sv[4] = {sx, sy, sx, sy};
+    const float tv[4] = {tx, ty, tx, ty};
+    const float32x4_t s = vld1q_f32(sv);
+    const float32x4_t t = vld1q_f32(tv);
+    for (; i + 2 <= count; i += 2) {
+        vst1q_f32(dst + 2 * i, vmlaq_f32(t, vld1q_f32(src + 2 * i), s));
+    }
+#endif
+    for (; i < count; i++) {
+        dst[2 * i]     = src[2 * i] * sx + tx;
+        dst[2 * i + 1] = src[2 * i + 1] * sy + ty;
+    }
+}
+
+// 仿射：x' = sx * x + kx * y + tx, y' = ky * x + sy * y + ty
+// 向量化时将 [x0, y0, x1, y1] 交换为 [y0, x0, y1, x1]，与 [kx, ky, kx, ky] 相乘即得斜切项
+static void mapPointsAffine(const float m[9], float* dst, const float* src, int count) {
+    const float sx = m[kMScaleX], kx = m[kMSkewX], tx = m[kMTransX];
+    const float ky = m[kMSkewY], sy = m[kMScaleY], ty = m[kMTransY];
+    int i = 0;
+#if defined(MNN_MATRIX_USE_SSE)
+    const __m128 s = _mm_setr_ps(sx, sy, sx, sy);
+    const __m128 k = _mm_setr_ps(kx, ky, kx, ky);
+    const __m128 t = _mm_setr_ps(tx, ty, tx, ty);
+    for (; i + 2 <= count; i += 2) {
+        __m128 p = _mm_loadu_ps(src + 2 * i);
+        __m128 q = _mm_shuffle_ps(p, p, _MM_SHUFFLE(2, 3, 0, 1));
+        _mm_storeu_ps(dst + 2 * i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(p, s), _mm_mul_ps(q, k)), t));
+    }
+#elif defined(MNN_MATRIX_USE_NEON)
+    const float sv[4] = {sx, sy, sx, sy};
+    const float kv[4] = {kx, ky, kx, ky};
+    const float tv[4] = {tx, ty, tx, ty};
+    const float32x4_t s = vld1q_f32(sv);
+    const float32x4_t k = vld1q_f32(kv);
+    const float32x4_t t = vld1q_f32(tv);
+    for (; i + 2 <= count; i += 2) {
+        float32x4_t p = vld1q_f32(src + 2 * i);
+        float32x4_t q = vrev64q_f32(p);
+        vst1q_f32(dst + 2 * i, vmlaq_f32(vmlaq_f32(t, p, s), q, k));
+    }
+#endif
+    for (; i < count; i++) {
+        const float x = src[2 * i], y = src[2 * i + 1];
+        dst[2 * i]     = sx * x + kx * y + tx;
+        dst[2 * i + 1] = ky * x + sy * y + ty;
     }
-    delete[] c_pts;
+}
+
+// 透视：在仿射结果上除以 w = p0 * x + p1 * y + p2，w 为 0 时结果置 0（与原 C++ 实现一致）
+static void mapPointsPerspective(const float m[9], float* dst, const float* src, int count) {
+    const float sx = m[kMScaleX], kx = m[kMSkewX], tx = m[kMTransX];
+    const float ky = m[kMSkewY], sy = m[kMScaleY], ty = m[kMTransY];
+    const float p0 = m[kMPersp0], p1 = m[kMPersp1], p2 = m[kMPersp2];
+    int i = 0;
+#if defined(MNN_MATRIX_USE_SSE)
+    const __m128 s = _mm_setr_ps(sx, sy, sx, sy);
+    const __m128 k = _mm_setr_ps(kx, ky, kx, ky);
+    const __m128 t = _mm_setr_ps(tx, ty, tx, ty);
+    const __m128 pp = _mm_setr_ps(p0, p1, p0, p1);
+    const __m128 pz = _mm_set1_ps(p2);
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 zero = _mm_setzero_ps();
+    for (; i + 2 <= count; i += 2) {
+        __m128 p = _mm_loadu_ps(src + 2 * i);
+        __m128 q = _mm_shuffle_ps(p, p, _MM_SHUFFLE(2, 3, 0, 1));
+        __m128 xy = _mm_add_ps(_mm_add_ps(_mm_mul_ps(p, s), _mm_mul_ps(q, k)), t);
+        // [p0*x0, p1*y0, p0*x1, p1*y1] 与其交换结果相加，得到 [w0, w0, w1, w1]
+        __m128 w = _mm_mul_ps(p, pp);
+        w = _mm_add_ps(_mm_add_ps(w, _mm_shuffle_ps(w, w, _MM_SHUFFLE(2, 3, 0, 1))), pz);
+        __m128 inv = _mm_and_ps(_mm_div_ps(one, w), _mm_cmpneq_ps(w, zero));
+        _mm_storeu_ps(dst + 2 * i, _mm_mul_ps(xy, inv));
+    }
+#elif defined(MNN_MATRIX_USE_NEON)
+    const float sv[4] = {sx, sy, sx, sy};
+    const float kv[4] = {kx, ky, kx, ky};
+    const float tv[4] = {tx, ty, tx, ty};
+    const float pv[4] = {p0, p1, p0, p1};
+    const float32x4_t s = vld1q_f32(sv);
+    const float32x4_t k = vld1q_f32(kv);
+    const float32x4_t t = vld1q_f32(tv);
+    const float32x4_t pp = vld1q_f32(pv);
+    const float32x4_t pz = vdupq_n_f32(p2);
+    const float32x4_t zero = vdupq_n_f32(0.0f);
+    for (; i + 2 <= count; i += 2) {
+        float32x4_t p = vld1q_f32(src + 2 * i);
+        float32x4_t xy = vmlaq_f32(vmlaq_f32(t, p, s), vrev64q_f32(p), k);
+        float32x4_t w = vmulq_f32(p, pp);
+        w = vaddq_f32(vaddq_f32(w, vrev64q_f32(w)), pz);
+        // 与 SSE 分支保持一致使用精确除法，避免 vrecpe 的精度损失
+        float wv[4];
+        vst1q_f32(wv, w);
+        const float iv[4] = {1.0f / wv[0], 1.0f / wv[1], 1.0f / wv[2], 1.0f / wv[3]};
+        uint32x4_t nz = vmvnq_u32(vceqq_f32(w, zero));
+        float32x4_t inv = vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(vld1q_f32(iv)), nz));
+        vst1q_f32(dst + 2 * i, vmulq_f32(xy, inv));
+    }
+#endif
+    for (; i < count; i++) {
+        const float x = src[2 * i], y = src[2 * i + 1];
+        float w = p0 * x + p1 * y + p2;
+        if (w != 0) {
+            w = 1.0f / w;
+        }
+        dst[2 * i]     = (sx * x + kx * y + tx) * w;
+        dst[2 * i + 1] = (ky * x + sy * y + ty) * w;
+    }
+}
+
+// 按类型掩码分派，dst 与 src 可以相同（原地映射）
+static void mapPointsFloat(const float m[9], float* dst, const float* src, int count) {
+    if (count <= 0) {
+        return;
+    }
+    const uint32_t mask = computeMapTypeMask(m);
+    if (mask & kPerspective_Mask) {
+        mapPointsPerspective(m, dst, src, count);
+    } else if (mask & kAffine_Mask) {
+        mapPointsAffine(m, dst, src, count);
+    } else if (mask & kScale_Mask) {
+        mapPointsScaleTranslate(m, dst, src, count);
+    } else if (mask & kTranslate_Mask) {
+        mapPointsTranslate(m, dst, src, count);
+    } else if (dst != src) {
+        ::memmove(dst, src, sizeof(float) * 2 * count);
+    }
+}
+
+void MNN_Matrix_mapPoints(const MNN_Matrix* matrix, MNN_Point dst[], const MNN_Point src[], int count) {
+    mapPointsFloat(matrix->fMat, reinterpret_cast<float*>(dst), reinterpret_cast<const float*>(src), count);
+}
+
+void MNN_Matrix_mapPointsInPlace(const MNN_Matrix* matrix, MNN_Point pts[], int count) {
+    float* p = reinterpret_cast<float*>(pts);
+    mapPointsFloat(matrix->fMat, p, p, count);
+}
+
+void MNN_Matrix_mapPointsFloat(const MNN_Matrix* matrix, float* dst, const float* src, int count) {
+    mapPointsFloat(matrix->fMat, dst, src, count);
 }
 
 MNN_Point MNN_Matrix_mapXY(const MNN_Matrix* matrix, float x, float y) {
-    Point p = reinterpret_cast<const Matrix*>(matrix)->mapXY(x, y);
-    return {p.fX, p.fY};
-}*/
+    const float src[2] = {x, y};
+    MNN_Point p;
+    mapPointsFloat(matrix->fMat, reinterpret_cast<float*>(&p), src, 1);
+    return p;
+}
 
 //MNN::CV::Matrix 类中的 gMapXYProcs 是一个【私有静态成员变量】，MNN 官方编译 MNN.dll 时，这个私有静态变量没有被导出到 DLL 的符号表中 **，且是 private 私有访问权限，外部无法访问；同时 mapXY() 函数的实现强依赖这个私有静态数组，导致链接器找不到它的实现，直接报 LNK2019 错误
 //mapXY 是 MNN.dll 的导出公有函数，理论上外部调用它时，只需要调用这个导出函数即可，完全不应该感知到、也不应该依赖 Matrix 类的私有成员 gMapXYProcs —— 你的这个认知是绝对正确的，这也是 C++ 编译 DLL 的标准工程规范！
@@ -437,4 +615,173 @@ MNN_Matrix* MNN_Matrix_Concat(const MNN_Matrix* a, const MNN_Matrix* b) {
 
 void MNN_Matrix_dirtyMatrixTypeCache(MNN_Matrix* matrix) {
     reinterpret_cast<Matrix*>(matrix)->dirtyMatrixTypeCache();
-}
\ No newline at end of file
+}
+
+// -------------------------- 值类型矩阵（无堆分配） --------------------------
+// 与 SK_ScalarNearlyZero^3 一致的行列式阈值
+static const double kMatrix9NearlyZeroDet = (1.0 / 4096) * (1.0 / 4096) * (1.0 / 4096);
+
+static inline MNN_Matrix9 makeMatrix9(float sx, float kx, float tx, float ky, float sy, float ty, float p0, float p1, float p2) {
+    MNN_Matrix9 r = {{sx, kx, tx, ky, sy, ty, p0, p1, p2}};
+    return r;
+}
+
+MNN_Matrix9 MNN_Matrix9_Identity() {
+    return makeMatrix9(1, 0, 0, 0, 1, 0, 0, 0, 1);
+}
+
+MNN_Matrix9 MNN_Matrix9_MakeScale(float sx, float sy) {
+    return makeMatrix9(sx, 0, 0, 0, sy, 0, 0, 0, 1);
+}
+
+MNN_Matrix9 MNN_Matrix9_MakeTrans(float dx, float dy) {
+    return makeMatrix9(1, 0, dx, 0, 1, dy, 0, 0, 1);
+}
+
+MNN_Matrix9 MNN_Matrix9_MakeScaleTranslate(float sx, float sy, float tx, float ty) {
+    return makeMatrix9(sx, 0, tx, 0, sy, ty, 0, 0, 1);
+}
+
+MNN_Matrix9 MNN_Matrix9_MakeRectToRect(MNN_Rect src, MNN_Rect dst, MNN_Matrix_ScaleToFit stf) {
+    const float srcW = src.right - src.left;
+    const float srcH = src.bottom - src.top;
+    if (!(srcW > 0) || !(srcH > 0)) {
+        return MNN_Matrix9_Identity();
+    }
+    const float dstW = dst.right - dst.left;
+    const float dstH = dst.bottom - dst.top;
+    float sx = dstW / srcW;
+    float sy = dstH / srcH;
+    float tx = dst.left;
+    float ty = dst.top;
+    if (stf != kFill_ScaleToFit) {
+        // 等比缩放，沿较长的一边按 stf 对齐
+        float diff;
+        if (sx > sy) {
+            sx = sy;
+            diff = dstW - srcW * sy;
+            if (stf == kCenter_ScaleToFit) {
+                diff *= 0.5f;
+            }
+            tx += (stf == kStart_ScaleToFit) ? 0 : diff;
+        } else {
+            sy = sx;
+            diff = dstH - srcH * sx;
+            if (stf == kCenter_ScaleToFit) {
+                diff *= 0.5f;
+            }
+            ty += (stf == kStart_ScaleToFit) ? 0 : diff;
+        }
+    }
+    return makeMatrix9(sx, 0, tx - src.left * sx, 0, sy, ty - src.top * sy, 0, 0, 1);
+}
+
+MNN_Matrix9 MNN_Matrix9_Concat(MNN_Matrix9 a, MNN_Matrix9 b) {
+    const float* A = a.m;
+    const float* B = b.m;
+    if (computeMapTypeMask(A) & kPerspective_Mask || computeMapTypeMask(B) & kPerspective_Mask) {
+        MNN_Matrix9 r;
+        for (int row = 0; row < 3; row++) {
+            for (int col = 0; col < 3; col++) {
+                r.m[row * 3 + col] = A[row * 3 + 0] * B[col] + A[row * 3 + 1] * B[3 + col] + A[row * 3 + 2] * B[6 + col];
+            }
+        }
+        return r;
+    }
+    // 两者均为仿射矩阵时最后一行恒为 [0, 0, 1]
+    return makeMatrix9(A[kMScaleX] * B[kMScaleX] + A[kMSkewX] * B[kMSkewY],
+                       A[kMScaleX] * B[kMSkewX] + A[kMSkewX] * B[kMScaleY],
+                       A[kMScaleX] * B[kMTransX] + A[kMSkewX] * B[kMTransY] + A[kMTransX],
+                       A[kMSkewY] * B[kMScaleX] + A[kMScaleY] * B[kMSkewY],
+                       A[kMSkewY] * B[kMSkewX] + A[kMScaleY] * B[kMScaleY],
+                       A[kMSkewY] * B[kMTransX] + A[kMScaleY] * B[kMTransY] + A[kMTransY],
+                       0, 0, 1);
+}
+
+bool MNN_Matrix9_Invert(MNN_Matrix9 matrix, MNN_Matrix9* inverse) {
+    const float* m = matrix.m;
+    const uint32_t mask = computeMapTypeMask(m);
+    if (!(mask & (kAffine_Mask | kPerspective_Mask))) {
+        // 缩放+平移的快速路径
+        if (m[kMScaleX] == 0 || m[kMScaleY] == 0) {
+            return false;
+        }
+        const float invX = 1.0f / m[kMScaleX];
+        const float invY = 1.0f / m[kMScaleY];
+        if (inverse) {
+            *inverse = makeMatrix9(invX, 0, -m[kMTransX] * invX, 0, invY, -m[kMTransY] * invY, 0, 0, 1);
+        }
+        return true;
+    }
+    // 通用 3x3 求逆（伴随矩阵 / 行列式），使用 double 累加减小误差
+    const double a = m[0], b = m[1], c = m[2];
+    const double d = m[3], e = m[4], f = m[5];
+    const double g = m[6], h = m[7], i = m[8];
+    const double c00 = e * i - f * h;
+    const double c01 = f * g - d * i;
+    const double c02 = d * h - e * g;
+    const double det = a * c00 + b * c01 + c * c02;
+    if (det > -kMatrix9NearlyZeroDet && det < kMatrix9NearlyZeroDet) {
+        return false;
+    }
+    if (inverse) {
+        const double invDet = 1.0 / det;
+        *inverse = makeMatrix9((float)(c00 * invDet), (float)((c * h - b * i) * invDet), (float)((b * f - c * e) * invDet),
+                               (float)(c01 * invDet), (float)((a * i - c * g) * invDet), (float)((c * d - a * f) * invDet),
+                               (float)(c02 * invDet), (float)((b * g - a * h) * invDet), (float)((a * e - b * d) * invDet));
+        if (!(mask & kPerspective_Mask)) {
+            inverse->m[kMPersp0] = 0;
+            inverse->m[kMPersp1] = 0;
+            inverse->m[kMPersp2] = 1;
+        }
+    }
+    return true;
+}
+
+MNN_Matrix_TypeMask MNN_Matrix9_getType(MNN_Matrix9 matrix) {
+    return (MNN_Matrix_TypeMask)computeMapTypeMask(matrix.m);
+}
+
+MNN_Point MNN_Matrix9_MapXY(MNN_Matrix9 matrix, float x, float y) {
+    const float src[2] = {x, y};
+    MNN_Point p;
+    mapPointsFloat(matrix.m, reinterpret_cast<float*>(&p), src, 1);
+    return p;
+}
+
+MNN_Rect MNN_Matrix9_MapRect(MNN_Matrix9 matrix, MNN_Rect src) {
+    const float corners[8] = {src.left, src.top, src.right, src.top, src.right, src.bottom, src.left, src.bottom};
+    float mapped[8];
+    mapPointsFloat(matrix.m, mapped, corners, 4);
+    MNN_Rect r = {mapped[0], mapped[1], mapped[0], mapped[1]};
+    for (int i = 1; i < 4; i++) {
+        r.left   = std::min(r.left, mapped[2 * i]);
+        r.right  = std::max(r.right, mapped[2 * i]);
+        r.top    = std::min(r.top, mapped[2 * i + 1]);
+        r.bottom = std::max(r.bottom, mapped[2 * i + 1]);
+    }
+    return r;
+}
+
+void MNN_Matrix9_MapPoints(const MNN_Matrix9* matrix, float* dst, const float* src, int count) {
+    mapPointsFloat(matrix->m, dst, src, count);
+}
+
+MNN_Letterbox MNN_Matrix9_Letterbox(int srcW, int srcH, int dstW, int dstH) {
+    MNN_Letterbox box;
+    if (srcW <= 0 || srcH <= 0 || dstW <= 0 || dstH <= 0) {
+        box.forward = MNN_Matrix9_Identity();
+        box.inverse = MNN_Matrix9_Identity();
+        box.scale = 1.0f;
+        box.padX = 0;
+        box.padY = 0;
+        return box;
+    }
+    const float scale = std::min((float)dstW / srcW, (float)dstH / srcH);
+    box.scale = scale;
+    box.padX = (dstW - srcW * scale) * 0.5f;
+    box.padY = (dstH - srcH * scale) * 0.5f;
+    box.forward = MNN_Matrix9_MakeScaleTranslate(scale, scale, box.padX, box.padY);
+    box.inverse = MNN_Matrix9_MakeScaleTranslate(1.0f / scale, 1.0f / scale, -box.padX / scale, -box.padY / scale);
+    return box;
+}
@@ -72,6 +72,20 @@ typedef struct MNN_Matrix //MNN_Matrix;
     uint32_t fTypeMask;     // 类型掩码（缓存）
 } MNN_Matrix;
 
+// 值类型矩阵：只有 9 个元素（行优先，索引同 kMScaleX...kMPersp2），按值传递，不涉及堆分配
+typedef struct MNN_Matrix9 {
+    float m[9];
+} MNN_Matrix9;
+
+// 等比缩放+居中填充（letterbox）变换
+typedef struct MNN_Letterbox {
+    MNN_Matrix9 forward;    // 源图像坐标 -> 模型输入坐标（用于把源图上的点/框映射到输入）
+    MNN_Matrix9 inverse;    // 模型输入坐标 -> 源图像坐标（ImageProcess 所需的矩阵，也用于把检测结果映射回源图）
+    float scale;            // 源图到输入的等比缩放系数
+    float padX;             // 输入图左侧填充宽度
+    float padY;             // 输入图顶部填充高度
+} MNN_Letterbox;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -161,9 +175,12 @@ MNN_C_API void MNN_Matrix_SetAffineIdentity(float affine[6]);
 MNN_C_API bool MNN_Matrix_asAffine(const MNN_Matrix* matrix, float affine[6]);
 MNN_C_API void MNN_Matrix_setAffine(MNN_Matrix* matrix, const float affine[6]);
 
-//MNN_C_API void MNN_Matrix_mapPoints(const MNN_Matrix* matrix, MNN_Point dst[], const MNN_Point src[], int count);
-//MNN_C_API void MNN_Matrix_mapPointsInPlace(const MNN_Matrix* matrix, MNN_Point pts[], int count);
-//MNN_C_API struct MNN_Point MNN_Matrix_mapXY(const MNN_Matrix* matrix, float x, float y);
+// 批量点映射：按类型掩码（平移/缩放平移/仿射/透视）分派到向量化内核，dst 与 src 可以相同
+MNN_C_API void MNN_Matrix_mapPoints(const MNN_Matrix* matrix, MNN_Point dst[], const MNN_Point src[], int count);
+MNN_C_API void MNN_Matrix_mapPointsInPlace(const MNN_Matrix* matrix, MNN_Point pts[], int count);
+// 扁平 float 数组版本：src/dst 按 {x0, y0, x1, y1, ...} 存放，count 为点数
+MNN_C_API void MNN_Matrix_mapPointsFloat(const MNN_Matrix* matrix, float* dst, const float* src, int count);
+MNN_C_API struct MNN_Point MNN_Matrix_mapXY(const MNN_Matrix* matrix, float x, float y);
 MNN_C_API bool MNN_Matrix_mapRect(const MNN_Matrix* matrix, MNN_Rect* dst, const MNN_Rect* src);
 MNN_C_API bool MNN_Matrix_mapRectInPlace(const MNN_Matrix* matrix, MNN_Rect* rect);
 MNN_C_API void MNN_Matrix_mapRectScaleTranslate(const MNN_Matrix* matrix, MNN_Rect* dst, const MNN_Rect* src);
@@ -185,6 +202,23 @@ MNN_C_API bool MNN_Matrix_notEquals(const MNN_Matrix* a, const MNN_Matrix* b);
 MNN_C_API MNN_Matrix* MNN_Matrix_Concat(const MNN_Matrix* a, const MNN_Matrix* b);
 MNN_C_API void MNN_Matrix_dirtyMatrixTypeCache(MNN_Matrix* matrix);
 
+// -------------------------- 值类型矩阵（无堆分配） --------------------------
+MNN_C_API MNN_Matrix9 MNN_Matrix9_Identity();
+MNN_C_API MNN_Matrix9 MNN_Matrix9_MakeScale(float sx, float sy);
+MNN_C_API MNN_Matrix9 MNN_Matrix9_MakeTrans(float dx, float dy);
+MNN_C_API MNN_Matrix9 MNN_Matrix9_MakeScaleTranslate(float sx, float sy, float tx, float ty);
+MNN_C_API MNN_Matrix9 MNN_Matrix9_MakeRectToRect(MNN_Rect src, MNN_Rect dst, MNN_Matrix_ScaleToFit stf);
+// 返回 a * b（先应用 b，再应用 a），与 MNN_Matrix_setConcat 语义一致
+MNN_C_API MNN_Matrix9 MNN_Matrix9_Concat(MNN_Matrix9 a, MNN_Matrix9 b);
+MNN_C_API bool MNN_Matrix9_Invert(MNN_Matrix9 matrix, MNN_Matrix9* inverse);
+MNN_C_API MNN_Matrix_TypeMask MNN_Matrix9_getType(MNN_Matrix9 matrix);
+MNN_C_API MNN_Point MNN_Matrix9_MapXY(MNN_Matrix9 matrix, float x, float y);
+// 映射矩形的四个顶点并取包围盒
+MNN_C_API MNN_Rect MNN_Matrix9_MapRect(MNN_Matrix9 matrix, MNN_Rect src);
+MNN_C_API void MNN_Matrix9_MapPoints(const MNN_Matrix9* matrix, float* dst, const float* src, int count);
+// 计算把 srcW x srcH 图像等比缩放并居中放入 dstW x dstH 输入的正/逆变换
+MNN_C_API MNN_Letterbox MNN_Matrix9_Letterbox(int srcW, int srcH, int dstW, int dstH);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,391 @@
+//
+//  MemoryGovernor_c.cpp
+//  MNN
+//
+
+#include "MemoryGovernor_c.h"
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+#include "ScheduleConfigCopy.hpp"
+
+struct MNN_MemoryGovernor;
+
+struct MNN_GovernedSession {
+    MNN_MemoryGovernor* governor = nullptr;
+    MNN_Interpreter* net = nullptr;
+    // 同一 net 的 createSession / releaseSession / setSessionMode 不能并发，由该锁串行
+    std::shared_ptr<std::mutex> netLock;
+    ScheduleConfigCopy config;
+    MNN_Session* session = nullptr;     // 被释放时为 nullptr
+    bool busy = false;                  // 正在 governor 锁外重建、回收或释放
+    int pins = 0;
+    float footprintMB = 0.0f;
+    uint64_t lastUsed = 0;
+    bool collected = false;             // 上次使用后已做过 MEMORY_COLLECT
+    // 释放前记录的输入形状，重建后恢复
+    std::vector<std::pair<std::string, std::vector<int>>> inputShapes;
+};
+
+struct MNN_MemoryGovernor {
+    std::mutex lock;
+    std::condition_variable created;    // busy 结束或最后一个固定解除时通知
+    std::set<MNN_GovernedSession*> sessions;
+    std::map<MNN_Interpreter*, std::shared_ptr<std::mutex>> netLocks;
+    float budgetMB = 0.0f;
+    bool collectFirst = false;
+    float usedMB = 0.0f;
+    float releasingMB = 0.0f;           // 已选中、正在锁外释放的 Session 占用
+    uint64_t tick = 0;
+    uint64_t evictions = 0;
+    uint64_t recreates = 0;
+    uint64_t collects = 0;
+};
+
+// -------------------------- 内部工具 --------------------------
+static float measure(MNN_Interpreter* net, MNN_Session* session) {
+    float memory = 0.0f;
+    if (!MNN_Interpreter_getSessionInfo(net, session, MNN_SESSION_INFO_CODE_MEMORY, &memory)) {
+        return 0.0f;
+    }
+    return memory;
+}
+
+static void saveInputShapes(MNN_GovernedSession* entry) {
+    entry->inputShapes.clear();
+    MNN_NamedTensorList inputs = MNN_Interpreter_GetSessionInputAll(entry->net, entry->session);
+    for (int i = 0; i < inputs.count; ++i) {
+        int size = 0;
+        int* shape = MNN_Tensor_Shape(inputs.tensors[i].tensor, &size);
+        if (shape == nullptr) {
+            continue;
+        }
+        entry->inputShapes.push_back(std::make_pair(std::string(inputs.tensors[i].name), std::vector<int>(shape, shape + size)));
+        MNN_Tensor_FreeShape(shape);
+    }
+    MNN_NamedTensorList_Free(inputs);
+}
+
+static MNN_Session* recreate(MNN_GovernedSession* entry) {
+    MNN_Session* session = MNN_Interpreter_createSession(entry->net, entry->config.get());
+    if (session == nullptr || entry->inputShapes.empty()) {
+        return session;
+    }
+    bool changed = false;
+    for (auto& item : entry->inputShapes) {
+        MNN_Tensor* input = MNN_Interpreter_getSessionInput(entry->net, session, item.first.c_str());
+        if (input == nullptr) {
+            continue;
+        }
+        int size = 0;
+        int* shape = MNN_Tensor_Shape(input, &size);
+        bool same = shape != nullptr && std::vector<int>(shape, shape + size) == item.second;
+        MNN_Tensor_FreeShape(shape);
+        if (!same) {
+            MNN_Interpreter_resizeTensor(entry->net, input, item.second.data(), (int)item.second.size());
+            changed = true;
+        }
+    }
+    if (changed) {
+        MNN_Interpreter_resizeSession(entry->net, session);
+    }
+    return session;
+}
+
+// 调用方持有 governor->lock
+static std::shared_ptr<std::mutex> netLockLocked(MNN_MemoryGovernor* governor, MNN_Interpreter* net) {
+    auto& netLock = governor->netLocks[net];
+    if (netLock == nullptr) {
+        netLock.reset(new std::mutex());
+    }
+    return netLock;
+}
+
+// 调用方持有 governor->lock；entry 已移出 sessions
+static void forgetNetLocked(MNN_MemoryGovernor* governor, MNN_GovernedSession* entry) {
+    auto iter = governor->netLocks.find(entry->net);
+    entry->netLock.reset();
+    if (iter != governor->netLocks.end() && iter->second.use_count() == 1) {
+        governor->netLocks.erase(iter);
+    }
+}
+
+// 调用方持有 governor->lock
+static MNN_GovernedSession* leastRecentlyUsedIdle(MNN_MemoryGovernor* governor, bool collectable) {
+    MNN_GovernedSession* chosen = nullptr;
+    for (auto entry : governor->sessions) {
+        if (entry->session == nullptr || entry->pins > 0 || entry->busy) {
+            continue;
+        }
+        if (collectable && entry->collected) {
+            continue;
+        }
+        if (chosen == nullptr || entry->lastUsed < chosen->lastUsed) {
+            chosen = entry;
+        }
+    }
+    return chosen;
+}
+
+// 调用方通过 guard 持有 governor->lock。governor 锁内只挑选受害者并标记 busy，MNN 调用在锁外、
+// 只持该 net 的锁进行，之后重新加锁记账并唤醒等待者；其他线程同时挑选时不会选中 busy 的 Session
+static bool enforceLocked(MNN_MemoryGovernor* governor, std::unique_lock<std::mutex>& guard) {
+    if (governor->collectFirst) {
+        while (governor->usedMB - governor->releasingMB > governor->budgetMB) {
+            MNN_GovernedSession* entry = leastRecentlyUsedIdle(governor, true);
+            if (entry == nullptr) {
+                break;
+            }
+            entry->busy = true;
+            guard.unlock();
+            float footprint = 0.0f;
+            {
+                // 模式作用于 net 上所有 Session，回收完立即恢复默认的 MEMORY_CACHE，之后的 resize 不再回收
+                std::lock_guard<std::mutex> netGuard(*entry->netLock);
+                MNN_Interpreter_setSessionMode(entry->net, MNN_SESSION_MODE_MEMORY_COLLECT);
+                MNN_Interpreter_resizeSessionEx(entry->net, entry->session, 1);
+                MNN_Interpreter_setSessionMode(entry->net, MNN_SESSION_MODE_MEMORY_CACHE);
+                footprint = measure(entry->net, entry->session);
+            }
+            guard.lock();
+            governor->usedMB += footprint - entry->footprintMB;
+            entry->footprintMB = footprint;
+            entry->collected = true;
+            entry->busy = false;
+            governor->collects += 1;
+            governor->created.notify_all();
+        }
+    }
+    while (governor->usedMB - governor->releasingMB > governor->budgetMB) {
+        MNN_GovernedSession* entry = leastRecentlyUsedIdle(governor, false);
+        if (entry == nullptr) {
+            return false;
+        }
+        // 释放中的占用先计入 releasingMB，并发的 enforce 不会为同一份超额再释放别的 Session
+        const float footprint = entry->footprintMB;
+        entry->busy = true;
+        governor->releasingMB += footprint;
+        guard.unlock();
+        {
+            std::lock_guard<std::mutex> netGuard(*entry->netLock);
+            saveInputShapes(entry);
+            MNN_Interpreter_releaseSession(entry->net, entry->session);
+        }
+        guard.lock();
+        entry->session = nullptr;
+        governor->releasingMB -= footprint;
+        governor->usedMB -= footprint;
+        entry->footprintMB = 0.0f;
+        entry->busy = false;
+        governor->evictions += 1;
+        governor->created.notify_all();
+    }
+    return true;
+}
+
+// -------------------------- 管理器 --------------------------
+struct MNN_MemoryGovernor* MNN_MemoryGovernor_create(const MNN_MemoryGovernorConfig* config) {
+    if (config == nullptr) {
+        return nullptr;
+    }
+    auto governor = new MNN_MemoryGovernor();
+    governor->budgetMB = config->budgetMB;
+    governor->collectFirst = config->collectFirst != 0;
+    return governor;
+}
+
+void MNN_MemoryGovernor_destroy(struct MNN_MemoryGovernor* governor) {
+    if (governor == nullptr) {
+        return;
+    }
+    for (auto entry : governor->sessions) {
+        if (entry->session != nullptr) {
+            MNN_Interpreter_releaseSession(entry->net, entry->session);
+        }
+        delete entry;
+    }
+    delete governor;
+}
+
+void MNN_MemoryGovernor_setBudget(struct MNN_MemoryGovernor* governor, float budgetMB) {
+    if (governor == nullptr) {
+        return;
+    }
+    std::unique_lock<std::mutex> guard(governor->lock);
+    governor->budgetMB = budgetMB;
+    enforceLocked(governor, guard);
+}
+
+void MNN_MemoryGovernor_getStats(struct MNN_MemoryGovernor* governor, MNN_MemoryGovernorStats* stats) {
+    if (governor == nullptr || stats == nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> guard(governor->lock);
+    stats->budgetMB = governor->budgetMB;
+    stats->usedMB = governor->usedMB;
+    stats->sessions = (int)governor->sessions.size();
+    stats->resident = 0;
+    for (auto entry : governor->sessions) {
+        if (entry->session != nullptr) {
+            stats->resident += 1;
+        }
+    }
+    stats->evictions = governor->evictions;
+    stats->recreates = governor->recreates;
+    stats->collects = governor->collects;
+}
+
+MNN_ErrorCode MNN_MemoryGovernor_enforce(struct MNN_MemoryGovernor* governor) {
+    if (governor == nullptr) {
+        return MNN_INVALID_VALUE;
+    }
+    std::unique_lock<std::mutex> guard(governor->lock);
+    return enforceLocked(governor, guard) ? MNN_NO_ERROR : MNN_RESOURCE_EXHAUSTED;
+}
+
+struct MNN_GovernedSession* MNN_MemoryGovernor_register(struct MNN_MemoryGovernor* governor, struct MNN_Interpreter* net,
+                                                        const struct MNN_ScheduleConfig* config) {
+    if (governor == nullptr || net == nullptr || config == nullptr) {
+        return nullptr;
+    }
+    auto entry = new MNN_GovernedSession();
+    entry->governor = governor;
+    entry->net = net;
+    entry->config.assign(*config);
+    std::unique_lock<std::mutex> guard(governor->lock);
+    entry->netLock = netLockLocked(governor, net);
+    guard.unlock();
+    {
+        std::lock_guard<std::mutex> netGuard(*entry->netLock);
+        entry->session = MNN_Interpreter_createSession(net, entry->config.get());
+    }
+    if (entry->session != nullptr) {
+        entry->footprintMB = measure(net, entry->session);
+    }
+    guard.lock();
+    if (entry->session == nullptr) {
+        forgetNetLocked(governor, entry);
+        delete entry;
+        return nullptr;
+    }
+    entry->lastUsed = ++governor->tick;
+    governor->sessions.insert(entry);
+    governor->usedMB += entry->footprintMB;
+    enforceLocked(governor, guard);
+    return entry;
+}
+
+void MNN_GovernedSession_unregister(struct MNN_GovernedSession* entry) {
+    if (entry == nullptr) {
+        return;
+    }
+    MNN_MemoryGovernor* governor = entry->governor;
+    std::unique_lock<std::mutex> guard(governor->lock);
+    // 仍被 acquire 固定的 Session 可能正在运行，等最后一次 release 后再释放
+    governor->created.wait(guard, [entry]() { return !entry->busy && entry->pins == 0; });
+    governor->sessions.erase(entry);
+    governor->usedMB -= entry->footprintMB;
+    if (entry->session != nullptr) {
+        // 已移出 sessions，别的线程不会再选中它，释放只需持该 net 的锁
+        guard.unlock();
+        {
+            std::lock_guard<std::mutex> netGuard(*entry->netLock);
+            MNN_Interpreter_releaseSession(entry->net, entry->session);
+        }
+        guard.lock();
+    }
+    forgetNetLocked(governor, entry);
+    delete entry;
+}
+
+// -------------------------- 受管 Session --------------------------
+struct MNN_Session* MNN_GovernedSession_acquire(struct MNN_GovernedSession* entry, MNN_ErrorCode* error) {
+    if (entry == nullptr) {
+        if (error != nullptr) {
+            *error = MNN_INVALID_VALUE;
+        }
+        return nullptr;
+    }
+    MNN_MemoryGovernor* governor = entry->governor;
+    std::unique_lock<std::mutex> guard(governor->lock);
+    governor->created.wait(guard, [entry]() { return !entry->busy; });
+    if (entry->session == nullptr) {
+        // 重建可能耗时数十毫秒，在 governor 锁外进行，只与同一 net 上的创建、释放互斥
+        entry->busy = true;
+        guard.unlock();
+        MNN_Session* session = nullptr;
+        {
+            std::lock_guard<std::mutex> netGuard(*entry->netLock);
+            session = recreate(entry);
+        }
+        float footprint = session != nullptr ? measure(entry->net, session) : 0.0f;
+        guard.lock();
+        entry->busy = false;
+        governor->created.notify_all();
+        if (session == nullptr) {
+            if (error != nullptr) {
+                *error = MNN_OUT_OF_MEMORY;
+            }
+            return nullptr;
+        }
+        entry->session = session;
+        entry->footprintMB = footprint;
+        governor->usedMB += footprint;
+        governor->recreates += 1;
+    }
+    entry->pins += 1;
+    entry->collected = false;
+    entry->lastUsed = ++governor->tick;
+    MNN_Session* pinned = entry->session;
+    // 已固定当前 Session，为它腾出空间只会释放其他空闲 Session；enforce 会暂时解锁，返回前先取出指针
+    enforceLocked(governor, guard);
+    if (error != nullptr) {
+        *error = MNN_NO_ERROR;
+    }
+    return pinned;
+}
+
+void MNN_GovernedSession_release(struct MNN_GovernedSession* entry) {
+    if (entry == nullptr) {
+        return;
+    }
+    MNN_MemoryGovernor* governor = entry->governor;
+    std::unique_lock<std::mutex> guard(governor->lock);
+    if (entry->pins <= 0 || entry->session == nullptr) {
+        return;
+    }
+    // 解除固定前 Session 不会被回收或释放，可以在锁外测量
+    MNN_Session* session = entry->session;
+    guard.unlock();
+    float footprint = measure(entry->net, session);
+    guard.lock();
+    entry->pins -= 1;
+    if (entry->pins == 0) {
+        governor->created.notify_all();
+    }
+    entry->lastUsed = ++governor->tick;
+    governor->usedMB += footprint - entry->footprintMB;
+    entry->footprintMB = footprint;
+    enforceLocked(governor, guard);
+}
+
+float MNN_GovernedSession_footprintMB(struct MNN_GovernedSession* entry) {
+    if (entry == nullptr) {
+        return 0.0f;
+    }
+    std::lock_guard<std::mutex> guard(entry->governor->lock);
+    return entry->footprintMB;
+}
+
+MNN_BOOL MNN_GovernedSession_resident(struct MNN_GovernedSession* entry) {
+    if (entry == nullptr) {
+        return 0;
+    }
+    std::lock_guard<std::mutex> guard(entry->governor->lock);
+    return entry->session != nullptr ? 1 : 0;
+}
@@ -0,0 +1,90 @@
+//
+//  MemoryGovernor_c.h
+//  MNN
+//
+//  进程级内存预算管理：
+//  用 MNN_SESSION_INFO_CODE_MEMORY 统计每个受管 Session 的占用，超出预算时按 LRU 处理空闲 Session：
+//  可选先以 MNN_SESSION_MODE_MEMORY_COLLECT 重新 resize 回收静态内存，仍超预算则释放 Session；
+//  被释放的 Session 在下次 acquire 时按原配置和输入形状透明重建
+//
+
+#ifndef MNN_MemoryGovernor_c_h
+#define MNN_MemoryGovernor_c_h
+
+#include <stdint.h>
+#include "Interpreter_c.h"
+
+// 导出宏：Windows下导出，其他平台兼容
+#ifdef MNN_C_EXPORTS
+    // 仅当编译 libmnn.dll 时定义 MNN_C_EXPORTS，此时用 dllexport
+    #define MNN_C_API __declspec(dllexport)
+#else
+    #define MNN_C_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct MNN_MemoryGovernorConfig {
+    float budgetMB;             // 所有受管 Session 的占用上限（MB）
+    MNN_BOOL collectFirst;      // 释放前先尝试 MEMORY_COLLECT 模式的 resize
+} MNN_MemoryGovernorConfig;
+
+typedef struct MNN_MemoryGovernorStats {
+    float budgetMB;
+    float usedMB;               // 常驻 Session 的占用之和
+    int sessions;               // 受管 Session 数
+    int resident;               // 当前常驻数
+    uint64_t evictions;         // 释放次数
+    uint64_t recreates;         // 重建次数
+    uint64_t collects;          // MEMORY_COLLECT 回收次数
+} MNN_MemoryGovernorStats;
+
+struct MNN_MemoryGovernor;
+// 受管的 Session：由管理器持有，可能被释放后重建，使用前必须 acquire
+struct MNN_GovernedSession;
+
+MNN_C_API struct MNN_MemoryGovernor* MNN_MemoryGovernor_create(const MNN_MemoryGovernorConfig* config);
+/**
+ * @brief destroy the governor and release all sessions it still manages.
+ */
+MNN_C_API void MNN_MemoryGovernor_destroy(struct MNN_MemoryGovernor* governor);
+MNN_C_API void MNN_MemoryGovernor_setBudget(struct MNN_MemoryGovernor* governor, float budgetMB);
+MNN_C_API void MNN_MemoryGovernor_getStats(struct MNN_MemoryGovernor* governor, MNN_MemoryGovernorStats* stats);
+/**
+ * @brief evict idle sessions until the budget is met or nothing idle is left.
+ * @return MNN_RESOURCE_EXHAUSTED if still over budget.
+ */
+MNN_C_API MNN_ErrorCode MNN_MemoryGovernor_enforce(struct MNN_MemoryGovernor* governor);
+
+/**
+ * @brief create a session of net under the governor. The model buffer of net must stay loaded
+ * (do not call MNN_Interpreter_releaseModel) so the session can be recreated.
+ * The governor serializes its own createSession / releaseSession / setSessionMode calls per net;
+ * the MEMORY_COLLECT mode is only set around the collecting resize, then MEMORY_CACHE is restored.
+ * Do not create or release other sessions of net outside the governor while it manages one.
+ */
+MNN_C_API struct MNN_GovernedSession* MNN_MemoryGovernor_register(struct MNN_MemoryGovernor* governor, struct MNN_Interpreter* net,
+                                                                  const struct MNN_ScheduleConfig* config);
+/**
+ * @brief release the session and stop managing it, blocking until every acquire of it has been released.
+ */
+MNN_C_API void MNN_GovernedSession_unregister(struct MNN_GovernedSession* session);
+/**
+ * @brief pin the session in memory, recreating it (with its last input shapes) if it was evicted.
+ * The returned pointer is valid until the matching release.
+ */
+MNN_C_API struct MNN_Session* MNN_GovernedSession_acquire(struct MNN_GovernedSession* session, MNN_ErrorCode* error);
+/**
+ * @brief unpin; the footprint is measured again (it changes with resize) and the budget enforced.
+ */
+MNN_C_API void MNN_GovernedSession_release(struct MNN_GovernedSession* session);
+MNN_C_API float MNN_GovernedSession_footprintMB(struct MNN_GovernedSession* session);
+MNN_C_API MNN_BOOL MNN_GovernedSession_resident(struct MNN_GovernedSession* session);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MNN_MemoryGovernor_c_h */
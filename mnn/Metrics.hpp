@@ -0,0 +1,83 @@
+//
+//  Metrics.hpp
+//  MNN
+//
+//  Metrics_c 的内部埋点接口，供 Interpreter_c / Tensor_c 调用
+//
+
+#ifndef MNN_Metrics_hpp
+#define MNN_Metrics_hpp
+
+#include <stdint.h>
+#include <atomic>
+#include <chrono>
+#include "Metrics_c.h"
+
+namespace Metrics {
+
+extern std::atomic<bool> gEnabled;
+
+inline bool enabled() {
+    return gEnabled.load(std::memory_order_relaxed);
+}
+
+inline uint64_t nowNs() {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// 记录到 (net, session) 的统计，同时把它设为当前线程的当前 Session
+void record(const MNN_Interpreter* net, const MNN_Session* session, MNN_MetricOp op, uint64_t ns);
+// 张量拷贝不知道所属 Session，记到当前线程最近一次访问的 Session 上
+void recordCurrent(MNN_MetricOp op, uint64_t ns);
+void setCurrent(const MNN_Interpreter* net, const MNN_Session* session);
+// Session 释放时调用，使其序号可被复用
+void forgetSession(const MNN_Session* session);
+// Interpreter 销毁时调用，遗忘它仍未释放的全部 Session
+void forgetInterpreter(const MNN_Interpreter* net);
+
+// 作用域计时，构造时关闭指标则不计时
+class ScopedTimer {
+public:
+    ScopedTimer(const MNN_Interpreter* net, const MNN_Session* session, MNN_MetricOp op)
+        : mNet(net), mSession(session), mOp(op), mBegin(enabled() ? nowNs() : 0) {
+    }
+    ~ScopedTimer() {
+        if (mBegin != 0) {
+            record(mNet, mSession, mOp, nowNs() - mBegin);
+        }
+    }
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    const MNN_Interpreter* mNet;
+    const MNN_Session* mSession;
+    MNN_MetricOp mOp;
+    uint64_t mBegin;
+};
+
+// 把 (net, session) 设为当前线程的当前 Session，离开作用域时清除，
+// 运行返回后不留指向可能随后被销毁的 net 的指针
+class ScopedCurrent {
+public:
+    ScopedCurrent(const MNN_Interpreter* net, const MNN_Session* session) : mActive(enabled()) {
+        if (mActive) {
+            setCurrent(net, session);
+        }
+    }
+    ~ScopedCurrent() {
+        if (mActive) {
+            setCurrent(nullptr, nullptr);
+        }
+    }
+    ScopedCurrent(const ScopedCurrent&) = delete;
+    ScopedCurrent& operator=(const ScopedCurrent&) = delete;
+
+private:
+    bool mActive;
+};
+
+} // namespace Metrics
+
+#endif /* MNN_Metrics_hpp */
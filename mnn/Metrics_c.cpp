@@ -0,0 +1,382 @@
+//
+//  Metrics_c.cpp
+//  MNN
+//
+
+#include "Metrics.hpp"
+#include <stdio.h>
+#include <string.h>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Metrics {
+
+std::atomic<bool> gEnabled(false);
+
+namespace {
+
+// -------------------------- 直方图 --------------------------
+// 对数线性分桶（HDR 风格）：每个 2 的幂区间再分 8 个子桶，相对误差不超过 12.5%，覆盖 0ns ~ 2^48ns
+static const int kSubBits = 3;
+static const int kSubCount = 1 << kSubBits;
+static const int kMaxExponent = 47;
+static const int kBucketCount = (kMaxExponent - kSubBits + 1) * kSubCount + kSubCount;
+
+static int bucketOf(uint64_t ns) {
+    if (ns < (uint64_t)kSubCount) {
+        return (int)ns;
+    }
+    int exponent = 63 - __builtin_clzll(ns);
+    if (exponent > kMaxExponent) {
+        return kBucketCount - 1;
+    }
+    int sub = (int)((ns >> (exponent - kSubBits)) & (kSubCount - 1));
+    return (exponent - kSubBits + 1) * kSubCount + sub;
+}
+
+// 桶内最大值
+static uint64_t bucketUpper(int index) {
+    if (index < kSubCount) {
+        return (uint64_t)index;
+    }
+    int exponent = index / kSubCount + kSubBits - 1;
+    int sub = index % kSubCount;
+    return ((uint64_t)(kSubCount + sub + 1) << (exponent - kSubBits)) - 1;
+}
+
+struct Histogram {
+    std::atomic<uint64_t> count;
+    std::atomic<uint64_t> sumNs;
+    std::atomic<uint64_t> maxNs;
+    std::atomic<uint64_t> buckets[kBucketCount];
+
+    Histogram() {
+        reset();
+    }
+    void reset() {
+        count.store(0, std::memory_order_relaxed);
+        sumNs.store(0, std::memory_order_relaxed);
+        maxNs.store(0, std::memory_order_relaxed);
+        for (int i = 0; i < kBucketCount; ++i) {
+            buckets[i].store(0, std::memory_order_relaxed);
+        }
+    }
+    void add(uint64_t ns) {
+        buckets[bucketOf(ns)].fetch_add(1, std::memory_order_relaxed);
+        sumNs.fetch_add(ns, std::memory_order_relaxed);
+        count.fetch_add(1, std::memory_order_relaxed);
+        uint64_t previous = maxNs.load(std::memory_order_relaxed);
+        while (ns > previous && !maxNs.compare_exchange_weak(previous, ns, std::memory_order_relaxed)) {
+        }
+    }
+};
+
+struct SessionSeries {
+    const MNN_Interpreter* net = nullptr;   // 所属 Interpreter，销毁时据此遗忘它的全部 Session
+    std::string model;
+    std::string bizCode;
+    int index = 0;
+    // 每次绑定到新 Session 或被遗忘时递增，线程缓存据此只让这一个 Session 的缓存项失效
+    std::atomic<uint64_t> binding;
+    Histogram ops[MNN_METRIC_OP_COUNT];
+
+    SessionSeries() : binding(0) {
+    }
+};
+
+// 一个模型下的 Session 序号分配，释放的序号（及其统计）被后来的 Session 复用，基数有界
+struct ModelSeries {
+    std::vector<std::unique_ptr<SessionSeries>> slots;
+    std::vector<bool> used;
+};
+
+struct Registry {
+    std::mutex lock;
+    std::map<std::pair<std::string, std::string>, ModelSeries> models;
+    std::unordered_map<const MNN_Session*, SessionSeries*> sessions;
+};
+
+static Registry& registry() {
+    static Registry* instance = new Registry();
+    return *instance;
+}
+
+struct CachedSeries {
+    SessionSeries* series;
+    uint64_t binding;
+};
+
+// 线程缓存的上限，Session 频繁创建释放时清空重建，避免失效项堆积
+static const size_t kThreadCacheLimit = 64;
+
+struct ThreadCache {
+    const MNN_Interpreter* currentNet = nullptr;
+    const MNN_Session* currentSession = nullptr;
+    std::unordered_map<const MNN_Session*, CachedSeries> series;
+};
+
+static thread_local ThreadCache tCache;
+
+// 命中线程缓存且该 Session 的绑定未变时无锁返回；每个线程第一次访问某个 Session（或它被遗忘、地址被复用）时
+// 才在全局锁下查找或登记。create 为 false 时只查找已登记的 Session，不访问 net（它可能已被销毁）
+static SessionSeries* lookup(const MNN_Interpreter* net, const MNN_Session* session, bool create) {
+    auto cached = tCache.series.find(session);
+    if (cached != tCache.series.end() &&
+        cached->second.series->binding.load(std::memory_order_acquire) == cached->second.binding) {
+        return cached->second.series;
+    }
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> guard(reg.lock);
+    SessionSeries* series = nullptr;
+    auto iter = reg.sessions.find(session);
+    if (iter != reg.sessions.end()) {
+        series = iter->second;
+    } else if (!create) {
+        return nullptr;
+    } else {
+        const char* uuid = MNN_Interpreter_uuid(net);
+        const char* bizCode = MNN_Interpreter_bizCode(net);
+        ModelSeries& model = reg.models[std::make_pair(std::string(uuid != nullptr ? uuid : ""),
+                                                       std::string(bizCode != nullptr ? bizCode : ""))];
+        size_t index = 0;
+        while (index < model.used.size() && model.used[index]) {
+            ++index;
+        }
+        if (index == model.slots.size()) {
+            model.slots.emplace_back(new SessionSeries());
+            model.used.push_back(false);
+            model.slots[index]->model = uuid != nullptr ? uuid : "";
+            model.slots[index]->bizCode = bizCode != nullptr ? bizCode : "";
+            model.slots[index]->index = (int)index;
+        }
+        model.used[index] = true;
+        series = model.slots[index].get();
+        series->net = net;
+        series->binding.fetch_add(1, std::memory_order_release);
+        reg.sessions[session] = series;
+    }
+    if (cached == tCache.series.end() && tCache.series.size() >= kThreadCacheLimit) {
+        tCache.series.clear();
+    }
+    CachedSeries entry = {series, series->binding.load(std::memory_order_relaxed)};
+    tCache.series[session] = entry;
+    return series;
+}
+
+struct Quantiles {
+    double p50, p90, p99, p999;
+};
+
+static Quantiles quantilesOf(const Histogram& histogram, uint64_t count, uint64_t maxNs) {
+    const double qs[4] = {0.5, 0.9, 0.99, 0.999};
+    double values[4] = {0.0, 0.0, 0.0, 0.0};
+    int q = 0;
+    uint64_t seen = 0;
+    for (int i = 0; i < kBucketCount && q < 4; ++i) {
+        seen += histogram.buckets[i].load(std::memory_order_relaxed);
+        while (q < 4 && (double)seen >= qs[q] * (double)count) {
+            uint64_t upper = bucketUpper(i);
+            values[q] = (double)(upper < maxNs ? upper : maxNs);
+            ++q;
+        }
+    }
+    for (; q < 4; ++q) {
+        values[q] = (double)maxNs;
+    }
+    Quantiles result = {values[0], values[1], values[2], values[3]};
+    return result;
+}
+
+static const char* opName(int op) {
+    static const char* names[MNN_METRIC_OP_COUNT] = {"run", "resize", "copy_in", "copy_out", "callback", "create_session"};
+    return names[op];
+}
+
+static std::string escapeLabel(const std::string& value) {
+    std::string result;
+    for (char c : value) {
+        if (c == '\\' || c == '"') {
+            result.push_back('\\');
+            result.push_back(c);
+        } else if (c == '\n') {
+            result += "\\n";
+        } else {
+            result.push_back(c);
+        }
+    }
+    return result;
+}
+
+template <typename Visitor>
+static void forEachSeries(Visitor visit) {
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> guard(reg.lock);
+    for (auto& model : reg.models) {
+        for (auto& slot : model.second.slots) {
+            for (int op = 0; op < MNN_METRIC_OP_COUNT; ++op) {
+                const Histogram& histogram = slot->ops[op];
+                if (histogram.count.load(std::memory_order_relaxed) == 0) {
+                    continue;
+                }
+                visit(*slot, op, histogram);
+            }
+        }
+    }
+}
+
+} // namespace
+
+// -------------------------- 内部埋点 --------------------------
+void record(const MNN_Interpreter* net, const MNN_Session* session, MNN_MetricOp op, uint64_t ns) {
+    if (net == nullptr || session == nullptr) {
+        return;
+    }
+    setCurrent(net, session);
+    lookup(net, session, true)->ops[op].add(ns);
+}
+
+void recordCurrent(MNN_MetricOp op, uint64_t ns) {
+    if (tCache.currentSession == nullptr) {
+        return;
+    }
+    SessionSeries* series = lookup(tCache.currentNet, tCache.currentSession, false);
+    if (series != nullptr) {
+        series->ops[op].add(ns);
+    }
+}
+
+void setCurrent(const MNN_Interpreter* net, const MNN_Session* session) {
+    tCache.currentNet = net;
+    tCache.currentSession = session;
+    // 此时 net 仍有效，先登记，之后 recordCurrent 只查找不登记
+    if (net != nullptr && session != nullptr) {
+        lookup(net, session, true);
+    }
+}
+
+void forgetSession(const MNN_Session* session) {
+    Registry& reg = registry();
+    {
+        std::lock_guard<std::mutex> guard(reg.lock);
+        auto iter = reg.sessions.find(session);
+        if (iter == reg.sessions.end()) {
+            return;
+        }
+        SessionSeries* series = iter->second;
+        reg.models[std::make_pair(series->model, series->bizCode)].used[series->index] = false;
+        series->binding.fetch_add(1, std::memory_order_release);
+        reg.sessions.erase(iter);
+    }
+    if (tCache.currentSession == session) {
+        setCurrent(nullptr, nullptr);
+    }
+}
+
+void forgetInterpreter(const MNN_Interpreter* net) {
+    Registry& reg = registry();
+    {
+        std::lock_guard<std::mutex> guard(reg.lock);
+        for (auto iter = reg.sessions.begin(); iter != reg.sessions.end();) {
+            SessionSeries* series = iter->second;
+            if (series->net != net) {
+                ++iter;
+                continue;
+            }
+            reg.models[std::make_pair(series->model, series->bizCode)].used[series->index] = false;
+            series->net = nullptr;
+            series->binding.fetch_add(1, std::memory_order_release);
+            iter = reg.sessions.erase(iter);
+        }
+    }
+    if (tCache.currentNet == net) {
+        setCurrent(nullptr, nullptr);
+    }
+}
+
+} // namespace Metrics
+
+// -------------------------- 接口实现 --------------------------
+void MNN_Metrics_setEnabled(MNN_BOOL enabled) {
+    Metrics::gEnabled.store(enabled != 0, std::memory_order_relaxed);
+}
+
+MNN_BOOL MNN_Metrics_isEnabled() {
+    return Metrics::enabled() ? 1 : 0;
+}
+
+void MNN_Metrics_reset() {
+    Metrics::Registry& reg = Metrics::registry();
+    std::lock_guard<std::mutex> guard(reg.lock);
+    for (auto& model : reg.models) {
+        for (auto& slot : model.second.slots) {
+            for (int op = 0; op < MNN_METRIC_OP_COUNT; ++op) {
+                slot->ops[op].reset();
+            }
+        }
+    }
+}
+
+int MNN_Metrics_snapshot(MNN_MetricSeries* series, int capacity) {
+    int total = 0;
+    Metrics::forEachSeries([&](const Metrics::SessionSeries& slot, int op, const Metrics::Histogram& histogram) {
+        if (series != nullptr && total < capacity) {
+            MNN_MetricSeries& out = series[total];
+            memset(&out, 0, sizeof(out));
+            strncpy(out.model, slot.model.c_str(), MNN_METRIC_NAME_LENGTH - 1);
+            strncpy(out.bizCode, slot.bizCode.c_str(), MNN_METRIC_NAME_LENGTH - 1);
+            out.session = slot.index;
+            out.op = static_cast<MNN_MetricOp>(op);
+            uint64_t count = histogram.count.load(std::memory_order_relaxed);
+            uint64_t maxNs = histogram.maxNs.load(std::memory_order_relaxed);
+            Metrics::Quantiles q = Metrics::quantilesOf(histogram, count, maxNs);
+            out.count = count;
+            out.sumMs = histogram.sumNs.load(std::memory_order_relaxed) / 1e6;
+            out.p50Ms = q.p50 / 1e6;
+            out.p90Ms = q.p90 / 1e6;
+            out.p99Ms = q.p99 / 1e6;
+            out.p999Ms = q.p999 / 1e6;
+            out.maxMs = maxNs / 1e6;
+        }
+        ++total;
+    });
+    return total;
+}
+
+size_t MNN_Metrics_prometheus(char* buffer, size_t capacity) {
+    std::string text;
+    std::string maxText;
+    Metrics::forEachSeries([&](const Metrics::SessionSeries& slot, int op, const Metrics::Histogram& histogram) {
+        std::string labels = "model=\"" + Metrics::escapeLabel(slot.model) + "\",biz=\"" + Metrics::escapeLabel(slot.bizCode) +
+                             "\",session=\"" + std::to_string(slot.index) + "\",op=\"" + Metrics::opName(op) + "\"";
+        uint64_t count = histogram.count.load(std::memory_order_relaxed);
+        uint64_t maxNs = histogram.maxNs.load(std::memory_order_relaxed);
+        Metrics::Quantiles q = Metrics::quantilesOf(histogram, count, maxNs);
+        const double quantiles[4][2] = {{0.5, q.p50}, {0.9, q.p90}, {0.99, q.p99}, {0.999, q.p999}};
+        char value[64];
+        for (int i = 0; i < 4; ++i) {
+            snprintf(value, sizeof(value), ",quantile=\"%g\"} %.9g\n", quantiles[i][0], quantiles[i][1] / 1e9);
+            text += "mnn_operation_duration_seconds{" + labels + value;
+        }
+        snprintf(value, sizeof(value), "} %.9g\n", histogram.sumNs.load(std::memory_order_relaxed) / 1e9);
+        text += "mnn_operation_duration_seconds_sum{" + labels + value;
+        snprintf(value, sizeof(value), "} %llu\n", (unsigned long long)count);
+        text += "mnn_operation_duration_seconds_count{" + labels + value;
+        snprintf(value, sizeof(value), "} %.9g\n", maxNs / 1e9);
+        maxText += "mnn_operation_duration_max_seconds{" + labels + value;
+    });
+    std::string result = "# HELP mnn_operation_duration_seconds Duration of MNN operations per model and session.\n"
+                         "# TYPE mnn_operation_duration_seconds summary\n" + text +
+                         "# HELP mnn_operation_duration_max_seconds Longest observed MNN operation per model and session.\n"
+                         "# TYPE mnn_operation_duration_max_seconds gauge\n" + maxText;
+    if (buffer != nullptr && capacity > 0) {
+        size_t copied = result.size() < capacity ? result.size() : capacity - 1;
+        memcpy(buffer, result.data(), copied);
+        buffer[copied] = '\0';
+    }
+    return result.size();
+}
@@ -0,0 +1,79 @@
+//
+//  Metrics_c.h
+//  MNN
+//
+//  内置运行指标：开启后 C 层为每个 Session 记录 runSession / resizeSession / 拷入拷出 / 回调 / 创建 的耗时，
+//  计数与对数线性直方图均为原子操作，按模型 uuid() / bizCode() 与 Session 序号分组，
+//  可导出为扁平结构体或 Prometheus 文本格式；关闭时每次调用只多一次原子读。
+//  Session 到统计的映射缓存在线程本地，每个线程首次访问某个 Session 时加一次全局锁，之后的记录不加锁；
+//  释放一个 Session 只使它自己的缓存项失效
+//
+
+#ifndef MNN_Metrics_c_h
+#define MNN_Metrics_c_h
+
+#include <stddef.h>
+#include <stdint.h>
+#include "Interpreter_c.h"
+
+// 导出宏：Windows下导出，其他平台兼容
+#ifdef MNN_C_EXPORTS
+    // 仅当编译 libmnn.dll 时定义 MNN_C_EXPORTS，此时用 dllexport
+    #define MNN_C_API __declspec(dllexport)
+#else
+    #define MNN_C_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    MNN_METRIC_OP_RUN            = 0,   // runSession / runSessionWithCallBack*
+    MNN_METRIC_OP_RESIZE         = 1,   // resizeSession / resizeSessionEx
+    MNN_METRIC_OP_COPY_IN        = 2,   // MNN_Tensor_CopyFromHostTensor
+    MNN_METRIC_OP_COPY_OUT       = 3,   // MNN_Tensor_CopyToHostTensor
+    MNN_METRIC_OP_CALLBACK       = 4,   // 用户 before/after 回调本身的耗时
+    MNN_METRIC_OP_CREATE_SESSION = 5,
+    MNN_METRIC_OP_COUNT          = 6
+} MNN_MetricOp;
+
+#define MNN_METRIC_NAME_LENGTH 64
+
+// 一个 (模型, Session, 操作) 的统计
+typedef struct MNN_MetricSeries {
+    char model[MNN_METRIC_NAME_LENGTH];     // uuid()，过长时截断
+    char bizCode[MNN_METRIC_NAME_LENGTH];
+    int session;                            // 同一模型下存活 Session 的序号，释放后复用
+    MNN_MetricOp op;
+    uint64_t count;
+    double sumMs;
+    double p50Ms;
+    double p90Ms;
+    double p99Ms;
+    double p999Ms;
+    double maxMs;
+} MNN_MetricSeries;
+
+MNN_C_API void MNN_Metrics_setEnabled(MNN_BOOL enabled);
+MNN_C_API MNN_BOOL MNN_Metrics_isEnabled();
+/**
+ * @brief zero all counters. Series of released sessions are kept and reused.
+ */
+MNN_C_API void MNN_Metrics_reset();
+/**
+ * @brief copy every series with count > 0 into series.
+ * @return number of such series, which may exceed capacity.
+ */
+MNN_C_API int MNN_Metrics_snapshot(MNN_MetricSeries* series, int capacity);
+/**
+ * @brief render all series in Prometheus text exposition format (summary with quantiles, plus max).
+ * @return length of the full text excluding the terminator; the output is truncated when it is >= capacity.
+ */
+MNN_C_API size_t MNN_Metrics_prometheus(char* buffer, size_t capacity);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MNN_Metrics_c_h */
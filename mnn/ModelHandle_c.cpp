@@ -0,0 +1,271 @@
+//
+//  ModelHandle_c.cpp
+//  MNN
+//
+
+#include "ModelHandle_c.h"
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "ScheduleConfigCopy.hpp"
+
+namespace {
+
+// 一个已发布的模型版本，由 shared_ptr 管理：句柄持有当前版本，每个租约再持有一份。
+// 每个 Session 在自己的 Interpreter 上（MNN 对同一 Interpreter 的运行加锁串行），nets[i] 拥有 sessions[i]
+struct ModelVersion {
+    uint64_t version = 0;
+    std::vector<MNN_Interpreter*> nets;
+    std::vector<MNN_Session*> sessions;
+    std::vector<int> idle;
+    bool replaced = false;  // 已有新版本发布，等待者应改去新版本取租约；受 lock 保护
+    std::mutex lock;
+    std::condition_variable released;
+
+    ~ModelVersion() {
+        for (size_t i = 0; i < nets.size(); ++i) {
+            if (i < sessions.size()) {
+                MNN_Interpreter_releaseSession(nets[i], sessions[i]);
+            }
+            MNN_Interpreter_destroy(nets[i]);
+        }
+    }
+};
+
+// 后台回收线程：版本的 Session 与 Interpreter 在这里销毁，
+// 归还旧版本最后一个租约的请求线程不承担销毁的耗时。句柄销毁后仍可能有版本待回收，因此进程内共用一个且不退出
+class Reclaimer {
+public:
+    static Reclaimer& get() {
+        static Reclaimer* reclaimer = new Reclaimer();
+        return *reclaimer;
+    }
+    void push(ModelVersion* version) {
+        std::lock_guard<std::mutex> guard(mLock);
+        mQueue.push_back(version);
+        mReady.notify_one();
+    }
+
+private:
+    Reclaimer() {
+        std::thread(&Reclaimer::loop, this).detach();
+    }
+    void loop() {
+        for (;;) {
+            ModelVersion* version = nullptr;
+            {
+                std::unique_lock<std::mutex> guard(mLock);
+                mReady.wait(guard, [this]() { return !mQueue.empty(); });
+                version = mQueue.front();
+                mQueue.pop_front();
+            }
+            delete version;
+        }
+    }
+    std::mutex mLock;
+    std::condition_variable mReady;
+    std::deque<ModelVersion*> mQueue;
+};
+
+static void reclaimVersion(ModelVersion* version) {
+    Reclaimer::get().push(version);
+}
+
+} // namespace
+
+struct MNN_ModelHandle {
+    ScheduleConfigCopy config;
+    int sessionCount = 1;
+    int warmupRuns = 0;
+    std::vector<std::pair<enum MNN_HintMode, int>> hints;
+    bool hasSessionMode = false;
+    enum MNN_SessionMode sessionMode = MNN_SESSION_MODE_RELEASE;
+    // 只由 std::atomic_load / std::atomic_store 访问；libstdc++ 用全局自旋锁池实现，临界区只有引用计数的增减
+    std::shared_ptr<ModelVersion> current;
+    uint64_t nextVersion = 1;
+    std::mutex loadLock;    // 串行化 load，同时保护 hints / sessionMode / nextVersion
+};
+
+struct MNN_ModelLease {
+    std::shared_ptr<ModelVersion> version;
+    int index = 0;
+};
+
+// -------------------------- 内部工具 --------------------------
+static MNN_ErrorCode publish(MNN_ModelHandle* handle, MNN_Interpreter* net, uint64_t* version) {
+    if (net == nullptr) {
+        return MNN_INVALID_VALUE;
+    }
+    // 由 shared_ptr 接管后，任何失败路径都会通过回收线程释放已创建的 Session 与 Interpreter
+    std::shared_ptr<ModelVersion> next(new ModelVersion(), reclaimVersion);
+    next->nets.push_back(net);
+    for (int i = 0; i < handle->sessionCount; ++i) {
+        MNN_Interpreter* sessionNet = next->nets.back();
+        if (i > 0) {
+            sessionNet = MNN_Interpreter_createReplica(net);
+            if (sessionNet == nullptr) {
+                return MNN_OUT_OF_MEMORY;
+            }
+            next->nets.push_back(sessionNet);
+        }
+        for (auto& hint : handle->hints) {
+            MNN_Interpreter_setSessionHint(sessionNet, hint.first, hint.second);
+        }
+        if (handle->hasSessionMode) {
+            MNN_Interpreter_setSessionMode(sessionNet, handle->sessionMode);
+        }
+        MNN_Session* session = MNN_Interpreter_createSession(sessionNet, handle->config.get());
+        if (session == nullptr) {
+            // 析构按 sessions 的长度释放，没有 Session 的 Interpreter 只销毁
+            return MNN_NOT_SUPPORT;
+        }
+        next->sessions.push_back(session);
+        for (int run = 0; run < handle->warmupRuns; ++run) {
+            MNN_ErrorCode code = MNN_Interpreter_runSession(sessionNet, session);
+            if (code != MNN_NO_ERROR) {
+                return code;
+            }
+        }
+        next->idle.push_back(i);
+    }
+    next->version = handle->nextVersion++;
+    if (version != nullptr) {
+        *version = next->version;
+    }
+    // 发布后新请求立即拿到新版本；旧版本随最后一个租约析构
+    std::shared_ptr<ModelVersion> previous = std::atomic_exchange(&handle->current, next);
+    if (previous != nullptr) {
+        // 唤醒仍在旧版本上等待空闲 Session 的请求，让它们改去新版本
+        {
+            std::lock_guard<std::mutex> guard(previous->lock);
+            previous->replaced = true;
+        }
+        previous->released.notify_all();
+    }
+    return MNN_NO_ERROR;
+}
+
+// -------------------------- 句柄 --------------------------
+struct MNN_ModelHandle* MNN_ModelHandle_create(const struct MNN_ScheduleConfig* config, int sessionCount, int warmupRuns) {
+    if (config == nullptr) {
+        return nullptr;
+    }
+    auto handle = new MNN_ModelHandle();
+    handle->config.assign(*config);
+    handle->sessionCount = sessionCount > 0 ? sessionCount : 1;
+    handle->warmupRuns = warmupRuns > 0 ? warmupRuns : 0;
+    return handle;
+}
+
+void MNN_ModelHandle_destroy(struct MNN_ModelHandle* handle) {
+    delete handle;
+}
+
+void MNN_ModelHandle_setSessionHint(struct MNN_ModelHandle* handle, enum MNN_HintMode hint, int value) {
+    if (handle == nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> guard(handle->loadLock);
+    handle->hints.push_back(std::make_pair(hint, value));
+}
+
+void MNN_ModelHandle_setSessionMode(struct MNN_ModelHandle* handle, enum MNN_SessionMode mode) {
+    if (handle == nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> guard(handle->loadLock);
+    handle->hasSessionMode = true;
+    handle->sessionMode = mode;
+}
+
+MNN_ErrorCode MNN_ModelHandle_loadFile(struct MNN_ModelHandle* handle, const char* file, uint64_t* version) {
+    if (handle == nullptr || file == nullptr) {
+        return MNN_INVALID_VALUE;
+    }
+    std::lock_guard<std::mutex> guard(handle->loadLock);
+    MNN_Interpreter* net = MNN_Interpreter_createFromFile(file);
+    if (net == nullptr) {
+        return MNN_FILE_OPEN_FAILED;
+    }
+    return publish(handle, net, version);
+}
+
+MNN_ErrorCode MNN_ModelHandle_loadBuffer(struct MNN_ModelHandle* handle, const void* buffer, size_t size, uint64_t* version) {
+    if (handle == nullptr || buffer == nullptr || size == 0) {
+        return MNN_INVALID_VALUE;
+    }
+    std::lock_guard<std::mutex> guard(handle->loadLock);
+    return publish(handle, MNN_Interpreter_createFromBuffer(buffer, size), version);
+}
+
+uint64_t MNN_ModelHandle_version(struct MNN_ModelHandle* handle) {
+    if (handle == nullptr) {
+        return 0;
+    }
+    std::shared_ptr<ModelVersion> current = std::atomic_load(&handle->current);
+    return current == nullptr ? 0 : current->version;
+}
+
+struct MNN_ModelLease* MNN_ModelHandle_acquire(struct MNN_ModelHandle* handle) {
+    if (handle == nullptr) {
+        return nullptr;
+    }
+    for (;;) {
+        std::shared_ptr<ModelVersion> current = std::atomic_load(&handle->current);
+        if (current == nullptr) {
+            return nullptr;
+        }
+        int index = 0;
+        {
+            std::unique_lock<std::mutex> guard(current->lock);
+            current->released.wait(guard, [&]() { return current->replaced || !current->idle.empty(); });
+            if (current->replaced) {
+                // 等待期间发布了新版本，重新读取当前版本
+                continue;
+            }
+            index = current->idle.back();
+            current->idle.pop_back();
+        }
+        auto lease = new MNN_ModelLease();
+        lease->index = index;
+        lease->version = std::move(current);
+        return lease;
+    }
+}
+
+// -------------------------- 租约 --------------------------
+void MNN_ModelLease_release(struct MNN_ModelLease* lease) {
+    if (lease == nullptr) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> guard(lease->version->lock);
+        lease->version->idle.push_back(lease->index);
+    }
+    lease->version->released.notify_one();
+    // 若该版本已被替换且这是最后一个租约，这里把它交给回收线程销毁
+    delete lease;
+}
+
+uint64_t MNN_ModelLease_version(const struct MNN_ModelLease* lease) {
+    return lease == nullptr ? 0 : lease->version->version;
+}
+
+struct MNN_Interpreter* MNN_ModelLease_interpreter(const struct MNN_ModelLease* lease) {
+    return lease == nullptr ? nullptr : lease->version->nets[lease->index];
+}
+
+struct MNN_Session* MNN_ModelLease_session(const struct MNN_ModelLease* lease) {
+    return lease == nullptr ? nullptr : lease->version->sessions[lease->index];
+}
+
+MNN_ErrorCode MNN_ModelLease_run(struct MNN_ModelLease* lease) {
+    if (lease == nullptr) {
+        return MNN_INVALID_VALUE;
+    }
+    return MNN_Interpreter_runSession(lease->version->nets[lease->index], lease->version->sessions[lease->index]);
+}
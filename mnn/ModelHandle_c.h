@@ -0,0 +1,80 @@
+//
+//  ModelHandle_c.h
+//  MNN
+//
+//  版本化模型句柄，支持不停机热更新：
+//  新版本的 Session 池（每个 Session 一个 Interpreter）在调用 load 的线程上创建并预热，完成后原子发布；
+//  请求通过租约（lease）持有某个版本，旧版本在最后一个租约归还后由后台线程释放 Session 并销毁 Interpreter
+//
+
+#ifndef MNN_ModelHandle_c_h
+#define MNN_ModelHandle_c_h
+
+#include <stdint.h>
+#include "Interpreter_c.h"
+
+// 导出宏：Windows下导出，其他平台兼容
+#ifdef MNN_C_EXPORTS
+    // 仅当编译 libmnn.dll 时定义 MNN_C_EXPORTS，此时用 dllexport
+    #define MNN_C_API __declspec(dllexport)
+#else
+    #define MNN_C_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct MNN_ModelHandle;
+// 对某个模型版本中一个 Session 的独占租约
+struct MNN_ModelLease;
+
+/**
+ * @brief create an empty handle. Nothing can be acquired until the first successful load.
+ * @param config schedule config for every session, copied.
+ * @param sessionCount sessions per version, i.e. how many leases can run concurrently (at least 1).
+ * Each session is created on its own interpreter (the loaded one plus replicas of it), so they do not
+ * serialize inside MNN; memory for the model therefore grows with sessionCount.
+ * @param warmupRuns runs of each new session before it is published.
+ */
+MNN_C_API struct MNN_ModelHandle* MNN_ModelHandle_create(const struct MNN_ScheduleConfig* config, int sessionCount, int warmupRuns);
+/**
+ * @brief destroy the handle. Versions still leased are released when their last lease is.
+ * Versions are always destroyed on a background thread, never on the caller's.
+ */
+MNN_C_API void MNN_ModelHandle_destroy(struct MNN_ModelHandle* handle);
+/**
+ * @brief session hint applied to the interpreters of every version loaded afterwards.
+ */
+MNN_C_API void MNN_ModelHandle_setSessionHint(struct MNN_ModelHandle* handle, enum MNN_HintMode hint, int value);
+MNN_C_API void MNN_ModelHandle_setSessionMode(struct MNN_ModelHandle* handle, enum MNN_SessionMode mode);
+
+/**
+ * @brief build, warm and publish a new version. Requests keep using the current version meanwhile,
+ * so this can be called from a background thread. Concurrent loads are serialized.
+ * @param version optional, receives the published version number (starting at 1).
+ */
+MNN_C_API MNN_ErrorCode MNN_ModelHandle_loadFile(struct MNN_ModelHandle* handle, const char* file, uint64_t* version);
+MNN_C_API MNN_ErrorCode MNN_ModelHandle_loadBuffer(struct MNN_ModelHandle* handle, const void* buffer, size_t size, uint64_t* version);
+/**
+ * @return the published version number, 0 before the first load.
+ */
+MNN_C_API uint64_t MNN_ModelHandle_version(struct MNN_ModelHandle* handle);
+
+/**
+ * @brief lease a free session of the current version, blocking while all of its sessions are leased.
+ * A caller still waiting when a new version is published moves on to the new version.
+ * @return NULL if nothing has been loaded.
+ */
+MNN_C_API struct MNN_ModelLease* MNN_ModelHandle_acquire(struct MNN_ModelHandle* handle);
+MNN_C_API void MNN_ModelLease_release(struct MNN_ModelLease* lease);
+MNN_C_API uint64_t MNN_ModelLease_version(const struct MNN_ModelLease* lease);
+MNN_C_API struct MNN_Interpreter* MNN_ModelLease_interpreter(const struct MNN_ModelLease* lease);
+MNN_C_API struct MNN_Session* MNN_ModelLease_session(const struct MNN_ModelLease* lease);
+MNN_C_API MNN_ErrorCode MNN_ModelLease_run(struct MNN_ModelLease* lease);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MNN_ModelHandle_c_h */
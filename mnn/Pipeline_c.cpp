@@ -0,0 +1,316 @@
+//
+//  Pipeline_c.cpp
+//  MNN
+//
+
+#include "Pipeline_c.h"
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "CpuAffinity.hpp"
+#include "ShapeCopy.hpp"
+
+namespace {
+
+// 段之间传递的张量在帧内的槽位：slot 为帧的主机张量下标
+struct Binding {
+    int slot;
+    MNN_Tensor* tensor;
+};
+
+struct Stage {
+    // MNN 对同一 Interpreter 的运行加锁串行，各段必须在不同的 Interpreter 上才能重叠执行：
+    // 第一段用调用方的 net，其余段各持有一个副本
+    MNN_Interpreter* net = nullptr;
+    bool ownsNet = false;
+    MNN_Session* session = nullptr;
+    std::vector<int> cores;
+    std::vector<Binding> inputs;
+    std::vector<Binding> outputs;
+    std::deque<MNN_PipelineFrame*> queue;   // nullptr 表示停止
+    std::mutex lock;
+    std::condition_variable ready;
+    std::thread worker;
+};
+
+} // namespace
+
+struct MNN_Pipeline;
+
+struct MNN_PipelineFrame {
+    MNN_Pipeline* pipeline = nullptr;
+    std::vector<MNN_Tensor*> hosts;
+    MNN_ErrorCode code = MNN_NO_ERROR;
+    bool done = false;
+};
+
+struct MNN_Pipeline {
+    MNN_Interpreter* net = nullptr;
+    std::vector<Stage*> stages;
+    std::map<std::string, int> slots;
+    std::vector<MNN_PipelineFrame*> frames;
+    std::vector<MNN_PipelineFrame*> idle;
+    std::mutex frameLock;                   // 保护 idle 与各帧的 done
+    std::condition_variable frameReleased;
+    std::condition_variable frameDone;
+};
+
+// -------------------------- 内部工具 --------------------------
+static void push(Stage* stage, MNN_PipelineFrame* frame) {
+    {
+        std::lock_guard<std::mutex> guard(stage->lock);
+        stage->queue.push_back(frame);
+    }
+    stage->ready.notify_one();
+}
+
+static MNN_PipelineFrame* pop(Stage* stage) {
+    std::unique_lock<std::mutex> guard(stage->lock);
+    stage->ready.wait(guard, [stage]() { return !stage->queue.empty(); });
+    MNN_PipelineFrame* frame = stage->queue.front();
+    stage->queue.pop_front();
+    return frame;
+}
+
+static MNN_ErrorCode runStage(Stage* stage, MNN_PipelineFrame* frame) {
+    for (auto& input : stage->inputs) {
+        if (!MNN_Tensor_CopyFromHostTensor(input.tensor, frame->hosts[input.slot])) {
+            return MNN_INVALID_VALUE;
+        }
+    }
+    MNN_ErrorCode code = MNN_Interpreter_runSession(stage->net, stage->session);
+    if (code != MNN_NO_ERROR) {
+        return code;
+    }
+    for (auto& output : stage->outputs) {
+        if (!MNN_Tensor_CopyToHostTensor(output.tensor, frame->hosts[output.slot])) {
+            return MNN_INVALID_VALUE;
+        }
+    }
+    return MNN_NO_ERROR;
+}
+
+static void stageLoop(MNN_Pipeline* pipeline, size_t index) {
+    Stage* stage = pipeline->stages[index];
+    Stage* next = index + 1 < pipeline->stages.size() ? pipeline->stages[index + 1] : nullptr;
+    pinCurrentThread(stage->cores);
+    while (true) {
+        MNN_PipelineFrame* frame = pop(stage);
+        if (frame == nullptr) {
+            if (next != nullptr) {
+                push(next, nullptr);
+            }
+            return;
+        }
+        // 前面某段失败的帧直接流到末尾
+        if (frame->code == MNN_NO_ERROR) {
+            frame->code = runStage(stage, frame);
+        }
+        if (next != nullptr) {
+            push(next, frame);
+            continue;
+        }
+        {
+            std::lock_guard<std::mutex> guard(pipeline->frameLock);
+            frame->done = true;
+        }
+        pipeline->frameDone.notify_all();
+    }
+}
+
+static int slotOf(MNN_Pipeline* pipeline, const char* name, std::vector<MNN_Tensor*>& templates, MNN_Tensor* tensor) {
+    auto iter = pipeline->slots.find(name);
+    if (iter != pipeline->slots.end()) {
+        return iter->second;
+    }
+    int slot = (int)templates.size();
+    templates.push_back(tensor);
+    pipeline->slots[name] = slot;
+    return slot;
+}
+
+static bool createStage(MNN_Pipeline* pipeline, const MNN_PipelineStage& desc, const struct MNN_ScheduleConfig& config,
+                        std::vector<MNN_Tensor*>& templates) {
+    Stage* stage = new Stage();
+    pipeline->stages.push_back(stage);
+    if (pipeline->stages.size() == 1) {
+        stage->net = pipeline->net;
+    } else {
+        stage->net = MNN_Interpreter_createReplica(pipeline->net);
+        stage->ownsNet = true;
+        if (stage->net == nullptr) {
+            return false;
+        }
+    }
+    if (desc.cores != nullptr && desc.coreCount > 0) {
+        stage->cores.assign(desc.cores, desc.cores + desc.coreCount);
+    }
+    struct MNN_ScheduleConfig stageConfig = config;
+    stageConfig.path.inputs = desc.inputs;
+    stageConfig.path.outputs = desc.outputs;
+    stageConfig.path.mode = MNN_PATH_MODE_TENSOR;
+    if (desc.numThread > 0) {
+        stageConfig.numThread = desc.numThread;
+    } else if (!stage->cores.empty()) {
+        stageConfig.numThread = (int)stage->cores.size();
+    }
+    {
+        // 在绑定到本段核心的线程上创建，Session 的缓冲按首次触碰分配到对应节点
+        ScopedAffinity affinity(stage->cores);
+        std::vector<int> cores = stage->cores;
+        MNN_Interpreter_setSessionHintArray(stage->net, MNN_HINT_MODE_CPU_CORE_IDS, cores.data(), cores.size());
+        stage->session = MNN_Interpreter_createSession(stage->net, &stageConfig);
+    }
+    if (stage->session == nullptr) {
+        return false;
+    }
+    // 副本上的 Session 只有模型默认形状，输入改成前面各段已确定的形状（模型输入取首段，切分点取上游输出）
+    bool resized = false;
+    for (size_t i = 0; i < desc.inputs.size; ++i) {
+        const char* name = desc.inputs.data[i];
+        MNN_Tensor* tensor = MNN_Interpreter_getSessionInput(stage->net, stage->session, name);
+        if (tensor == nullptr) {
+            return false;
+        }
+        Binding binding = {slotOf(pipeline, name, templates, tensor), tensor};
+        if (templates[binding.slot] != tensor) {
+            resized = copyShape(stage->net, templates[binding.slot], tensor) || resized;
+        }
+        stage->inputs.push_back(binding);
+    }
+    if (resized) {
+        ScopedAffinity affinity(stage->cores);
+        MNN_Interpreter_resizeSession(stage->net, stage->session);
+    }
+    for (size_t i = 0; i < desc.outputs.size; ++i) {
+        const char* name = desc.outputs.data[i];
+        MNN_Tensor* tensor = MNN_Interpreter_getSessionOutput(stage->net, stage->session, name);
+        if (tensor == nullptr) {
+            return false;
+        }
+        Binding binding = {slotOf(pipeline, name, templates, tensor), tensor};
+        stage->outputs.push_back(binding);
+    }
+    return true;
+}
+
+static void releaseAll(MNN_Pipeline* pipeline) {
+    for (auto stage : pipeline->stages) {
+        if (stage->session != nullptr) {
+            MNN_Interpreter_releaseSession(stage->net, stage->session);
+        }
+        if (stage->ownsNet && stage->net != nullptr) {
+            MNN_Interpreter_destroy(stage->net);
+        }
+        delete stage;
+    }
+    for (auto frame : pipeline->frames) {
+        for (auto host : frame->hosts) {
+            MNN_Tensor_Destroy(host);
+        }
+        delete frame;
+    }
+    delete pipeline;
+}
+
+// -------------------------- 接口实现 --------------------------
+struct MNN_Pipeline* MNN_Pipeline_create(struct MNN_Interpreter* net, const MNN_PipelineStage* stages, int stageCount,
+                                         const struct MNN_ScheduleConfig* config, int depth) {
+    if (net == nullptr || stages == nullptr || stageCount <= 0 || config == nullptr) {
+        return nullptr;
+    }
+    auto pipeline = new MNN_Pipeline();
+    pipeline->net = net;
+    std::vector<MNN_Tensor*> templates;
+    bool ok = true;
+    for (int i = 0; i < stageCount && ok; ++i) {
+        ok = createStage(pipeline, stages[i], *config, templates);
+    }
+    MNN_Interpreter_setSessionHintArray(net, MNN_HINT_MODE_CPU_CORE_IDS, nullptr, 0);
+    if (!ok) {
+        releaseAll(pipeline);
+        return nullptr;
+    }
+
+    depth = depth > 0 ? depth : stageCount;
+    for (int i = 0; i < depth; ++i) {
+        auto frame = new MNN_PipelineFrame();
+        frame->pipeline = pipeline;
+        pipeline->frames.push_back(frame);
+        for (auto tensor : templates) {
+            frame->hosts.push_back(MNN_Tensor_CreateHostTensorFromDevice(tensor, 0));
+        }
+        pipeline->idle.push_back(frame);
+    }
+    for (size_t i = 0; i < pipeline->stages.size(); ++i) {
+        pipeline->stages[i]->worker = std::thread(stageLoop, pipeline, i);
+    }
+    return pipeline;
+}
+
+void MNN_Pipeline_destroy(struct MNN_Pipeline* pipeline) {
+    if (pipeline == nullptr) {
+        return;
+    }
+    // 停止信号排在已提交的帧之后，逐段向后传递
+    push(pipeline->stages[0], nullptr);
+    for (auto stage : pipeline->stages) {
+        stage->worker.join();
+    }
+    releaseAll(pipeline);
+}
+
+struct MNN_PipelineFrame* MNN_Pipeline_acquireFrame(struct MNN_Pipeline* pipeline) {
+    if (pipeline == nullptr) {
+        return nullptr;
+    }
+    std::unique_lock<std::mutex> guard(pipeline->frameLock);
+    pipeline->frameReleased.wait(guard, [pipeline]() { return !pipeline->idle.empty(); });
+    MNN_PipelineFrame* frame = pipeline->idle.back();
+    pipeline->idle.pop_back();
+    frame->code = MNN_NO_ERROR;
+    frame->done = false;
+    return frame;
+}
+
+struct MNN_Tensor* MNN_PipelineFrame_tensor(struct MNN_PipelineFrame* frame, const char* name) {
+    if (frame == nullptr || name == nullptr) {
+        return nullptr;
+    }
+    // 所有帧的槽位布局相同，由流水线的名字表查找
+    auto iter = frame->pipeline->slots.find(name);
+    return iter == frame->pipeline->slots.end() ? nullptr : frame->hosts[iter->second];
+}
+
+void MNN_Pipeline_submit(struct MNN_Pipeline* pipeline, struct MNN_PipelineFrame* frame) {
+    if (pipeline == nullptr || frame == nullptr) {
+        return;
+    }
+    push(pipeline->stages[0], frame);
+}
+
+MNN_ErrorCode MNN_PipelineFrame_wait(struct MNN_PipelineFrame* frame) {
+    if (frame == nullptr) {
+        return MNN_INVALID_VALUE;
+    }
+    MNN_Pipeline* pipeline = frame->pipeline;
+    std::unique_lock<std::mutex> guard(pipeline->frameLock);
+    pipeline->frameDone.wait(guard, [frame]() { return frame->done; });
+    return frame->code;
+}
+
+void MNN_Pipeline_releaseFrame(struct MNN_Pipeline* pipeline, struct MNN_PipelineFrame* frame) {
+    if (pipeline == nullptr || frame == nullptr) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> guard(pipeline->frameLock);
+        pipeline->idle.push_back(frame);
+    }
+    pipeline->frameReleased.notify_one();
+}
@@ -0,0 +1,80 @@
+//
+//  Pipeline_c.h
+//  MNN
+//
+//  流水线并行执行：在用户声明的张量处把模型切成若干段，每段是一个 MNN_PATH_MODE_TENSOR 的 Session，
+//  各段在各自的 Interpreter 上（同一 Interpreter 的运行在 MNN 内串行），绑定到各自的核心并由独立线程执行；请求以帧（frame）为单位依次流过各段，
+//  第 k 段处理第 n 帧的同时第 k-1 段处理第 n+1 帧
+//
+
+#ifndef MNN_Pipeline_c_h
+#define MNN_Pipeline_c_h
+
+#include "Interpreter_c.h"
+
+// 导出宏：Windows下导出，其他平台兼容
+#ifdef MNN_C_EXPORTS
+    // 仅当编译 libmnn.dll 时定义 MNN_C_EXPORTS，此时用 dllexport
+    #define MNN_C_API __declspec(dllexport)
+#else
+    #define MNN_C_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct MNN_PipelineStage {
+    StringArray inputs;     // 本段的输入张量：模型输入或前面各段的输出
+    StringArray outputs;    // 本段的输出张量：切分点或模型输出
+    const int* cores;       // 本段绑定的逻辑 CPU，可为 NULL
+    int coreCount;
+    int numThread;          // <= 0 时取 coreCount，两者都为 0 时沿用 config->numThread
+} MNN_PipelineStage;
+
+struct MNN_Pipeline;
+// 一次请求在流水线中流转的载体，持有所有段间张量的主机副本
+struct MNN_PipelineFrame;
+
+/**
+ * @brief split net into stages and start one worker thread per stage.
+ * The first stage runs on net, every other stage on its own replica of net (MNN_Interpreter_createReplica),
+ * owned by the pipeline, so that stages overlap; net's model must not be released, and hints or modes
+ * set on net do not reach the replicas.
+ * Shapes are fixed at creation: the first stage's session starts with the model's input shapes, and every
+ * later stage resizes its inputs to the shapes of the first stage or the stage producing them.
+ * The interpreter's CPU_CORE_IDS hint is changed; do not create other sessions on net concurrently.
+ * @param config base schedule config, path and numThread are replaced per stage.
+ * @param depth number of frames, i.e. requests in flight (at least the stage count is useful).
+ */
+MNN_C_API struct MNN_Pipeline* MNN_Pipeline_create(struct MNN_Interpreter* net, const MNN_PipelineStage* stages, int stageCount,
+                                                   const struct MNN_ScheduleConfig* config, int depth);
+/**
+ * @brief stop the workers after the frames already submitted, then release the sessions.
+ */
+MNN_C_API void MNN_Pipeline_destroy(struct MNN_Pipeline* pipeline);
+
+/**
+ * @brief take a free frame, blocking while all frames are in flight.
+ */
+MNN_C_API struct MNN_PipelineFrame* MNN_Pipeline_acquireFrame(struct MNN_Pipeline* pipeline);
+/**
+ * @brief host tensor of a boundary in the frame: fill the first stage's inputs before submit,
+ * read the last stage's outputs after wait.
+ */
+MNN_C_API struct MNN_Tensor* MNN_PipelineFrame_tensor(struct MNN_PipelineFrame* frame, const char* name);
+/**
+ * @brief push the frame into the first stage; returns immediately.
+ */
+MNN_C_API void MNN_Pipeline_submit(struct MNN_Pipeline* pipeline, struct MNN_PipelineFrame* frame);
+/**
+ * @brief block until the frame has passed the last stage (or a stage failed).
+ */
+MNN_C_API MNN_ErrorCode MNN_PipelineFrame_wait(struct MNN_PipelineFrame* frame);
+MNN_C_API void MNN_Pipeline_releaseFrame(struct MNN_Pipeline* pipeline, struct MNN_PipelineFrame* frame);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MNN_Pipeline_c_h */
@@ -0,0 +1,386 @@
+//
+//  Placement_c.cpp
+//  MNN
+//
+
+#include "Placement_c.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "CpuAffinity.hpp"
+#ifdef __linux__
+#include <dirent.h>
+#endif
+
+namespace {
+
+struct CoreSet {
+    int node = 0;
+    int package = 0;
+    std::vector<int> cores;
+    int load = 0;
+};
+
+// -------------------------- 拓扑发现 --------------------------
+// 解析 sysfs 的 cpulist 格式，例如 "0-3,8-11"
+static std::vector<int> parseCpuList(const char* text) {
+    std::vector<int> cpus;
+    const char* p = text;
+    while (*p != '\0' && *p != '\n') {
+        char* end = nullptr;
+        long first = strtol(p, &end, 10);
+        if (end == p) {
+            break;
+        }
+        long last = first;
+        p = end;
+        if (*p == '-') {
+            last = strtol(p + 1, &end, 10);
+            p = end;
+        }
+        for (long cpu = first; cpu <= last; ++cpu) {
+            cpus.push_back((int)cpu);
+        }
+        if (*p == ',') {
+            ++p;
+        }
+    }
+    return cpus;
+}
+
+static bool readLine(const char* path, char* buffer, size_t size) {
+    FILE* file = fopen(path, "r");
+    if (file == nullptr) {
+        return false;
+    }
+    bool ok = fgets(buffer, (int)size, file) != nullptr;
+    fclose(file);
+    return ok;
+}
+
+static int readInt(const char* path, int fallback) {
+    char buffer[64];
+    if (!readLine(path, buffer, sizeof(buffer))) {
+        return fallback;
+    }
+    return atoi(buffer);
+}
+
+struct CpuInfo {
+    int cpu;
+    int node;
+    int package;
+    int primary;        // 同一物理核中编号最小的可用逻辑 CPU
+};
+
+#ifdef __linux__
+static std::vector<CpuInfo> discoverCpus() {
+    std::vector<CpuInfo> result;
+    char buffer[4096];
+    if (!readLine("/sys/devices/system/cpu/online", buffer, sizeof(buffer))) {
+        return result;
+    }
+    std::vector<int> online = parseCpuList(buffer);
+
+    // 只使用进程被允许运行的 CPU（容器 / taskset 限制）
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    bool hasMask = sched_getaffinity(0, sizeof(allowed), &allowed) == 0;
+    auto usable = [&](int cpu) {
+        return cpu >= 0 && cpu < CPU_SETSIZE && (!hasMask || CPU_ISSET(cpu, &allowed));
+    };
+
+    std::map<int, int> nodeOf;
+    DIR* dir = opendir("/sys/devices/system/node");
+    if (dir != nullptr) {
+        struct dirent* entry;
+        while ((entry = readdir(dir)) != nullptr) {
+            int node = 0;
+            if (sscanf(entry->d_name, "node%d", &node) != 1) {
+                continue;
+            }
+            char path[256];
+            snprintf(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist", node);
+            if (readLine(path, buffer, sizeof(buffer))) {
+                for (int cpu : parseCpuList(buffer)) {
+                    nodeOf[cpu] = node;
+                }
+            }
+        }
+        closedir(dir);
+    }
+
+    for (int cpu : online) {
+        if (!usable(cpu)) {
+            continue;
+        }
+        char path[256];
+        CpuInfo info;
+        info.cpu = cpu;
+        auto nodeIter = nodeOf.find(cpu);
+        info.node = nodeIter == nodeOf.end() ? 0 : nodeIter->second;
+        snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/topology/physical_package_id", cpu);
+        info.package = readInt(path, 0);
+        info.primary = cpu;
+        snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/topology/thread_siblings_list", cpu);
+        if (readLine(path, buffer, sizeof(buffer))) {
+            for (int sibling : parseCpuList(buffer)) {
+                if (usable(sibling) && sibling < info.primary) {
+                    info.primary = sibling;
+                }
+            }
+        }
+        result.push_back(info);
+    }
+    return result;
+}
+#else
+static std::vector<CpuInfo> discoverCpus() {
+    return std::vector<CpuInfo>();
+}
+#endif
+
+} // namespace
+
+struct MNN_Placement {
+    std::vector<CoreSet> sets;
+    int nodeCount = 1;
+    bool pinned = false;    // 拓扑发现失败时不绑核
+    std::mutex lock;        // 保护各组 load 与模型的 busy 状态
+};
+
+struct MNN_PlacedModel {
+    MNN_Placement* placement = nullptr;
+    MNN_Interpreter* net = nullptr;
+    // 每组一个 Interpreter：MNN 对同一 Interpreter 的运行加锁串行，共用一个就无法并行使用各组。
+    // 第 0 组用调用方的 net，其余组是本模型持有的副本
+    std::vector<MNN_Interpreter*> nets;
+    std::vector<MNN_Session*> sessions;
+    std::vector<bool> busy;
+    std::condition_variable released;
+};
+
+// -------------------------- 核心组划分 --------------------------
+static void buildSets(MNN_Placement* placement, const MNN_PlacementConfig& config) {
+    std::vector<CpuInfo> cpus = discoverCpus();
+    if (cpus.empty()) {
+        CoreSet all;
+        int count = (int)std::thread::hardware_concurrency();
+        all.cores.resize(count > 0 ? count : 1);
+        placement->sets.push_back(all);
+        return;
+    }
+    placement->pinned = true;
+
+    // 按 (节点, socket) 分组，组内先放物理核的主线程，开启 SMT 时紧跟其兄弟线程，保证兄弟线程落在同一组
+    std::map<std::pair<int, int>, std::vector<CpuInfo>> groups;
+    for (auto& info : cpus) {
+        groups[std::make_pair(info.node, info.package)].push_back(info);
+    }
+    std::map<int, bool> nodes;
+    for (auto& group : groups) {
+        std::vector<CpuInfo>& members = group.second;
+        std::sort(members.begin(), members.end(), [](const CpuInfo& a, const CpuInfo& b) {
+            return a.primary != b.primary ? a.primary < b.primary : a.cpu < b.cpu;
+        });
+        std::vector<int> ordered;
+        for (auto& info : members) {
+            if (info.cpu == info.primary || config.useSmt) {
+                ordered.push_back(info.cpu);
+            }
+        }
+        const int perSet = config.threadsPerSet > 0 ? config.threadsPerSet : (int)ordered.size();
+        for (size_t begin = 0; begin < ordered.size(); begin += perSet) {
+            size_t end = std::min(ordered.size(), begin + (size_t)perSet);
+            CoreSet set;
+            set.node = group.first.first;
+            set.package = group.first.second;
+            set.cores.assign(ordered.begin() + begin, ordered.begin() + end);
+            placement->sets.push_back(set);
+        }
+        nodes[group.first.first] = true;
+    }
+    placement->nodeCount = (int)nodes.size();
+}
+
+// 按 load / 核数 比较，核数少的组分到的请求相应少
+static bool lessLoaded(const CoreSet& a, const CoreSet& b) {
+    return (long long)a.load * (long long)b.cores.size() < (long long)b.load * (long long)a.cores.size();
+}
+
+// -------------------------- 接口实现 --------------------------
+struct MNN_Placement* MNN_Placement_create(const MNN_PlacementConfig* config) {
+    MNN_PlacementConfig defaultConfig;
+    defaultConfig.threadsPerSet = 0;
+    defaultConfig.useSmt = 0;
+    auto placement = new MNN_Placement();
+    buildSets(placement, config != nullptr ? *config : defaultConfig);
+    return placement;
+}
+
+void MNN_Placement_destroy(struct MNN_Placement* placement) {
+    delete placement;
+}
+
+int MNN_Placement_setCount(const struct MNN_Placement* placement) {
+    return placement == nullptr ? 0 : (int)placement->sets.size();
+}
+
+int MNN_Placement_nodeCount(const struct MNN_Placement* placement) {
+    return placement == nullptr ? 0 : placement->nodeCount;
+}
+
+MNN_BOOL MNN_Placement_getSetInfo(const struct MNN_Placement* placement, int index, MNN_CoreSetInfo* info) {
+    if (placement == nullptr || info == nullptr || index < 0 || index >= (int)placement->sets.size()) {
+        return 0;
+    }
+    auto mutablePlacement = const_cast<MNN_Placement*>(placement);
+    std::lock_guard<std::mutex> guard(mutablePlacement->lock);
+    const CoreSet& set = placement->sets[index];
+    info->node = set.node;
+    info->socket = set.package;
+    info->coreCount = (int)set.cores.size();
+    info->load = set.load;
+    return 1;
+}
+
+int MNN_Placement_getSetCores(const struct MNN_Placement* placement, int index, int* cores, int capacity) {
+    if (placement == nullptr || index < 0 || index >= (int)placement->sets.size() || !placement->pinned) {
+        return 0;
+    }
+    const std::vector<int>& setCores = placement->sets[index].cores;
+    for (int i = 0; i < (int)setCores.size() && i < capacity; ++i) {
+        cores[i] = setCores[i];
+    }
+    return (int)setCores.size();
+}
+
+struct MNN_PlacedModel* MNN_PlacedModel_create(struct MNN_Placement* placement, struct MNN_Interpreter* net,
+                                               const struct MNN_ScheduleConfig* config) {
+    if (placement == nullptr || net == nullptr || config == nullptr) {
+        return nullptr;
+    }
+    auto model = new MNN_PlacedModel();
+    model->placement = placement;
+    model->net = net;
+    for (auto& set : placement->sets) {
+        MNN_Interpreter* setNet = model->nets.empty() ? net : MNN_Interpreter_createReplica(net);
+        if (setNet == nullptr) {
+            MNN_Interpreter_setSessionHintArray(net, MNN_HINT_MODE_CPU_CORE_IDS, nullptr, 0);
+            MNN_PlacedModel_destroy(model);
+            return nullptr;
+        }
+        model->nets.push_back(setNet);
+        struct MNN_ScheduleConfig setConfig = *config;
+        setConfig.numThread = (int)set.cores.size();
+        struct MNN_Session* session = nullptr;
+        if (placement->pinned) {
+            // 在绑定到该组的线程上创建，Session 的缓冲按首次触碰分配到本节点
+            ScopedAffinity affinity(set.cores);
+            std::vector<int> cores = set.cores;
+            MNN_Interpreter_setSessionHintArray(setNet, MNN_HINT_MODE_CPU_CORE_IDS, cores.data(), cores.size());
+            session = MNN_Interpreter_createSession(setNet, &setConfig);
+        } else {
+            session = MNN_Interpreter_createSession(setNet, &setConfig);
+        }
+        model->sessions.push_back(session);
+        model->busy.push_back(false);
+        if (session == nullptr) {
+            MNN_Interpreter_setSessionHintArray(net, MNN_HINT_MODE_CPU_CORE_IDS, nullptr, 0);
+            MNN_PlacedModel_destroy(model);
+            return nullptr;
+        }
+    }
+    if (placement->pinned) {
+        MNN_Interpreter_setSessionHintArray(net, MNN_HINT_MODE_CPU_CORE_IDS, nullptr, 0);
+    }
+    return model;
+}
+
+void MNN_PlacedModel_destroy(struct MNN_PlacedModel* model) {
+    if (model == nullptr) {
+        return;
+    }
+    for (size_t i = 0; i < model->sessions.size(); ++i) {
+        if (model->sessions[i] != nullptr) {
+            MNN_Interpreter_releaseSession(model->nets[i], model->sessions[i]);
+        }
+    }
+    for (size_t i = 1; i < model->nets.size(); ++i) {
+        MNN_Interpreter_destroy(model->nets[i]);
+    }
+    delete model;
+}
+
+struct MNN_Session* MNN_PlacedModel_acquire(struct MNN_PlacedModel* model, int* setIndex) {
+    if (model == nullptr || model->sessions.empty()) {
+        return nullptr;
+    }
+    MNN_Placement* placement = model->placement;
+    std::unique_lock<std::mutex> guard(placement->lock);
+    int chosen = -1;
+    while (true) {
+        for (int i = 0; i < (int)model->sessions.size(); ++i) {
+            if (model->busy[i]) {
+                continue;
+            }
+            if (chosen < 0 || lessLoaded(placement->sets[i], placement->sets[chosen])) {
+                chosen = i;
+            }
+        }
+        if (chosen >= 0) {
+            break;
+        }
+        model->released.wait(guard);
+    }
+    model->busy[chosen] = true;
+    placement->sets[chosen].load += 1;
+    if (setIndex != nullptr) {
+        *setIndex = chosen;
+    }
+    return model->sessions[chosen];
+}
+
+MNN_ErrorCode MNN_PlacedModel_run(struct MNN_PlacedModel* model, int setIndex) {
+    if (model == nullptr || setIndex < 0 || setIndex >= (int)model->sessions.size()) {
+        return MNN_INVALID_VALUE;
+    }
+    MNN_Placement* placement = model->placement;
+    if (!placement->pinned) {
+        return MNN_Interpreter_runSession(model->nets[setIndex], model->sessions[setIndex]);
+    }
+    // MNN 的调用线程也承担计算，运行期间把它绑到该组，避免跨节点访问
+    ScopedAffinity affinity(placement->sets[setIndex].cores);
+    return MNN_Interpreter_runSession(model->nets[setIndex], model->sessions[setIndex]);
+}
+
+void MNN_PlacedModel_release(struct MNN_PlacedModel* model, int setIndex) {
+    if (model == nullptr || setIndex < 0 || setIndex >= (int)model->sessions.size()) {
+        return;
+    }
+    MNN_Placement* placement = model->placement;
+    {
+        std::lock_guard<std::mutex> guard(placement->lock);
+        // 重复 release 会把 load 减成负数
+        if (!model->busy[setIndex]) {
+            return;
+        }
+        model->busy[setIndex] = false;
+        placement->sets[setIndex].load -= 1;
+    }
+    model->released.notify_one();
+}
+
+struct MNN_Interpreter* MNN_PlacedModel_interpreter(const struct MNN_PlacedModel* model, int setIndex) {
+    if (model == nullptr || setIndex < 0 || setIndex >= (int)model->nets.size()) {
+        return nullptr;
+    }
+    return model->nets[setIndex];
+}
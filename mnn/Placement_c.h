@@ -0,0 +1,94 @@
+//
+//  Placement_c.h
+//  MNN
+//
+//  按 CPU 拓扑放置 Session：
+//  从 sysfs 读取 socket / NUMA 节点 / SMT 兄弟线程，把核心划分为互不重叠且不跨节点的核心组，
+//  每组在各自的 Interpreter 上用 MNN_HINT_MODE_CPU_CORE_IDS 创建绑核的 Session，请求路由到负载最低的组，
+//  创建与运行时调用线程也绑定到该组，使首次触碰分配的内存落在本节点
+//
+
+#ifndef MNN_Placement_c_h
+#define MNN_Placement_c_h
+
+#include "Interpreter_c.h"
+
+// 导出宏：Windows下导出，其他平台兼容
+#ifdef MNN_C_EXPORTS
+    // 仅当编译 libmnn.dll 时定义 MNN_C_EXPORTS，此时用 dllexport
+    #define MNN_C_API __declspec(dllexport)
+#else
+    #define MNN_C_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct MNN_PlacementConfig {
+    int threadsPerSet;      // 每个核心组的线程数，<= 0 表示每个 NUMA 节点一组
+    MNN_BOOL useSmt;        // 为 0 时每个物理核只用一个硬件线程
+} MNN_PlacementConfig;
+
+typedef struct MNN_CoreSetInfo {
+    int node;               // NUMA 节点，无 NUMA 信息时为 0
+    int socket;             // 物理 socket
+    int coreCount;          // 组内逻辑 CPU 数，即该组 Session 的线程数
+    int load;               // 当前正在使用该组的请求数
+} MNN_CoreSetInfo;
+
+struct MNN_Placement;
+// 同一模型在每个核心组上各有一个 Session
+struct MNN_PlacedModel;
+
+/**
+ * @brief discover the CPU topology and partition it into core sets. Sets never span NUMA nodes.
+ * On platforms without sysfs all cores form one set and nothing is pinned.
+ * @param config NULL means one set per NUMA node without SMT siblings.
+ */
+MNN_C_API struct MNN_Placement* MNN_Placement_create(const MNN_PlacementConfig* config);
+MNN_C_API void MNN_Placement_destroy(struct MNN_Placement* placement);
+MNN_C_API int MNN_Placement_setCount(const struct MNN_Placement* placement);
+MNN_C_API int MNN_Placement_nodeCount(const struct MNN_Placement* placement);
+MNN_C_API MNN_BOOL MNN_Placement_getSetInfo(const struct MNN_Placement* placement, int index, MNN_CoreSetInfo* info);
+/**
+ * @brief copy the logical CPU ids of a set into cores.
+ * @return number of CPUs in the set, which may exceed capacity.
+ */
+MNN_C_API int MNN_Placement_getSetCores(const struct MNN_Placement* placement, int index, int* cores, int capacity);
+
+/**
+ * @brief create one session per core set. config->numThread is replaced by the set size.
+ * The first set uses net; every other set gets its own replica of net (MNN_Interpreter_createReplica),
+ * so runs placed on different sets do not serialize on one interpreter. The replicas are owned by the model;
+ * net's model must not be released, and hints or modes set on net do not reach the replicas.
+ * net's CPU_CORE_IDS hint is changed; do not create other sessions on net concurrently.
+ * The model must be destroyed before the placement.
+ */
+MNN_C_API struct MNN_PlacedModel* MNN_PlacedModel_create(struct MNN_Placement* placement, struct MNN_Interpreter* net,
+                                                         const struct MNN_ScheduleConfig* config);
+MNN_C_API void MNN_PlacedModel_destroy(struct MNN_PlacedModel* model);
+/**
+ * @brief lease the session of the least loaded core set (load counted across all models of the placement),
+ * blocking until that set's session of this model is free.
+ * @param setIndex receives the set to pass to run/release.
+ */
+MNN_C_API struct MNN_Session* MNN_PlacedModel_acquire(struct MNN_PlacedModel* model, int* setIndex);
+/**
+ * @brief run the leased session with the calling thread pinned to its core set.
+ */
+MNN_C_API MNN_ErrorCode MNN_PlacedModel_run(struct MNN_PlacedModel* model, int setIndex);
+/**
+ * @brief return the lease; releasing a set that is not leased is ignored.
+ */
+MNN_C_API void MNN_PlacedModel_release(struct MNN_PlacedModel* model, int setIndex);
+/**
+ * @brief the interpreter owning the session of a set, to fill inputs and read outputs of that session.
+ */
+MNN_C_API struct MNN_Interpreter* MNN_PlacedModel_interpreter(const struct MNN_PlacedModel* model, int setIndex);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MNN_Placement_c_h */
@@ -0,0 +1,34 @@
+//
+//  Recorder.hpp
+//  MNN
+//
+//  Recorder_c 的内部录制接口，供 Interpreter_c 的 runSession 调用
+//
+
+#ifndef MNN_Recorder_hpp
+#define MNN_Recorder_hpp
+
+#include <atomic>
+#include "Recorder_c.h"
+
+namespace Recorder {
+
+// 已挂载 Recorder 的 Interpreter 数量，为 0 时 runSession 只多一次原子读
+extern std::atomic<int> gAttached;
+
+inline bool active() {
+    return gAttached.load(std::memory_order_relaxed) > 0;
+}
+
+struct Capture;
+
+// 本次运行被抽中时拷贝输入并返回非空，必须随后调用 end
+Capture* begin(const MNN_Interpreter* net, MNN_Session* session);
+// 运行成功时写入记录，随后释放 capture
+void end(Capture* capture, uint64_t latencyNs, MNN_ErrorCode code);
+// Interpreter 销毁时调用，解除挂载
+void forget(const MNN_Interpreter* net);
+
+} // namespace Recorder
+
+#endif /* MNN_Recorder_hpp */
@@ -0,0 +1,516 @@
+//
+//  Recorder_c.cpp
+//  MNN
+//
+
+#include "Recorder_c.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "Recorder.hpp"
+
+static const char kMagic[8] = {'M', 'N', 'N', 'R', 'E', 'C', '1', '\0'};
+
+struct RecorderState {
+    std::mutex lock;                    // 保护 file 的写入
+    FILE* file = nullptr;
+    std::atomic<double> sampleRate;
+    std::atomic<uint64_t> runs;
+    std::atomic<uint64_t> count;
+
+    RecorderState() : sampleRate(1.0), runs(0), count(0) {
+    }
+    ~RecorderState() {
+        if (file != nullptr) {
+            fclose(file);
+        }
+    }
+};
+
+struct MNN_Recorder {
+    std::shared_ptr<RecorderState> state;
+};
+
+struct MNN_RecordReader {
+    FILE* file = nullptr;
+    std::vector<uint8_t> buffer;
+    std::string model;
+    std::vector<std::string> names;
+    std::vector<std::vector<int>> dims;
+    std::vector<std::vector<uint8_t>> data;
+    std::vector<MNN_RecordInput> inputs;
+};
+
+namespace Recorder {
+
+std::atomic<int> gAttached(0);
+
+struct Capture {
+    std::shared_ptr<RecorderState> state;
+    uint64_t timestampNs = 0;
+    std::string model;
+    std::vector<uint8_t> inputs;        // 已序列化的输入部分（含输入数）
+};
+
+} // namespace Recorder
+
+typedef std::map<const MNN_Interpreter*, std::shared_ptr<RecorderState>> Registry;
+
+// 挂载关系的写入方（attach / detach / close / forget）在 gRegistryLock 下修改 gRegistry 后发布一份只读快照，
+// runSession 路径只用 std::atomic_load 取快照查找，不争用全局锁
+static std::mutex gRegistryLock;
+static Registry gRegistry;
+static std::shared_ptr<const Registry> gSnapshot;
+
+// -------------------------- 内部工具 --------------------------
+// 调用方持有 gRegistryLock
+static void publishLocked() {
+    std::shared_ptr<const Registry> snapshot;
+    if (!gRegistry.empty()) {
+        snapshot = std::make_shared<const Registry>(gRegistry);
+    }
+    std::atomic_store(&gSnapshot, snapshot);
+}
+
+template <typename T>
+static void put(std::vector<uint8_t>& out, T value) {
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+    out.insert(out.end(), bytes, bytes + sizeof(T));
+}
+
+static void putBytes(std::vector<uint8_t>& out, const void* data, size_t size) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    out.insert(out.end(), bytes, bytes + size);
+}
+
+// 按比例均匀抽样：第 n 次运行在 floor((n + 1) * rate) 增加时被抽中
+static bool sampled(RecorderState* state) {
+    uint64_t n = state->runs.fetch_add(1, std::memory_order_relaxed);
+    double rate = state->sampleRate.load(std::memory_order_relaxed);
+    return floor((n + 1) * rate) > floor(n * rate);
+}
+
+static bool serializeInputs(MNN_Interpreter* net, MNN_Session* session, std::vector<uint8_t>& out) {
+    MNN_NamedTensorList list = MNN_Interpreter_GetSessionInputAll(net, session);
+    put<uint16_t>(out, (uint16_t)list.count);
+    bool ok = true;
+    for (int i = 0; i < list.count && ok; ++i) {
+        MNN_Tensor* host = MNN_Tensor_CreateHostTensorFromDevice(list.tensors[i].tensor, true);
+        if (host == nullptr) {
+            ok = false;
+            break;
+        }
+        halide_type_t type;
+        MNN_Tensor_GetHalideType(host, &type);
+        int dimCount = 0;
+        int* shape = MNN_Tensor_Shape(host, &dimCount);
+        size_t nameLength = strlen(list.tensors[i].name);
+        put<uint16_t>(out, (uint16_t)nameLength);
+        putBytes(out, list.tensors[i].name, nameLength);
+        put<uint8_t>(out, (uint8_t)type.code);
+        put<uint8_t>(out, type.bits);
+        put<uint8_t>(out, (uint8_t)MNN_Tensor_GetDimensionType(host));
+        put<uint8_t>(out, (uint8_t)dimCount);
+        for (int d = 0; d < dimCount; ++d) {
+            put<int32_t>(out, shape[d]);
+        }
+        uint32_t size = (uint32_t)MNN_Tensor_Size(host);
+        put<uint32_t>(out, size);
+        putBytes(out, MNN_Tensor_Host(host), size);
+        MNN_Tensor_FreeShape(shape);
+        MNN_Tensor_Destroy(host);
+    }
+    MNN_NamedTensorList_Free(list);
+    return ok;
+}
+
+// 从 data[*offset] 读取，越界返回 false
+template <typename T>
+static bool get(const std::vector<uint8_t>& data, size_t* offset, T* value) {
+    if (*offset + sizeof(T) > data.size()) {
+        return false;
+    }
+    memcpy(value, data.data() + *offset, sizeof(T));
+    *offset += sizeof(T);
+    return true;
+}
+
+static bool getBytes(const std::vector<uint8_t>& data, size_t* offset, size_t size, const uint8_t** bytes) {
+    if (*offset + size > data.size()) {
+        return false;
+    }
+    *bytes = data.data() + *offset;
+    *offset += size;
+    return true;
+}
+
+// 找到最后一条完整记录的结尾；崩溃或掉电可能在文件末尾留下写了一半的记录，
+// 不截掉的话之后追加的记录会从它的长度字段之后开始，读取时整体错位
+static bool completeLength(FILE* file, long* complete) {
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    if (size < 0) {
+        return false;
+    }
+    char magic[sizeof(kMagic)];
+    fseek(file, 0, SEEK_SET);
+    size_t got = fread(magic, 1, sizeof(magic), file);
+    if (memcmp(magic, kMagic, got) != 0) {
+        return false;
+    }
+    if (got < sizeof(kMagic)) {
+        // 文件头本身不完整，从头重写
+        *complete = 0;
+        return true;
+    }
+    long offset = (long)sizeof(kMagic);
+    uint32_t length = 0;
+    while (fread(&length, 1, sizeof(length), file) == sizeof(length) &&
+           (uint64_t)offset + sizeof(length) + length <= (uint64_t)size) {
+        offset += (long)(sizeof(length) + length);
+        fseek(file, offset, SEEK_SET);
+    }
+    *complete = offset;
+    return true;
+}
+
+namespace Recorder {
+
+Capture* begin(const MNN_Interpreter* net, MNN_Session* session) {
+    std::shared_ptr<const Registry> snapshot = std::atomic_load(&gSnapshot);
+    if (snapshot == nullptr) {
+        return nullptr;
+    }
+    auto iter = snapshot->find(net);
+    if (iter == snapshot->end()) {
+        return nullptr;
+    }
+    std::shared_ptr<RecorderState> state = iter->second;
+    if (!sampled(state.get())) {
+        return nullptr;
+    }
+    auto capture = new Capture();
+    capture->state = state;
+    capture->timestampNs = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    const char* uuid = MNN_Interpreter_uuid(net);
+    capture->model = uuid != nullptr ? uuid : "";
+    if (!serializeInputs(const_cast<MNN_Interpreter*>(net), session, capture->inputs)) {
+        delete capture;
+        return nullptr;
+    }
+    return capture;
+}
+
+void end(Capture* capture, uint64_t latencyNs, MNN_ErrorCode code) {
+    if (capture == nullptr) {
+        return;
+    }
+    if (code == MNN_NO_ERROR) {
+        std::vector<uint8_t> record;
+        uint16_t modelLength = (uint16_t)std::min<size_t>(capture->model.size(), 0xFFFF);
+        uint32_t length = (uint32_t)(sizeof(uint64_t) * 2 + sizeof(uint16_t) + modelLength + capture->inputs.size());
+        record.reserve(sizeof(uint32_t) + length);
+        put<uint32_t>(record, length);
+        put<uint64_t>(record, capture->timestampNs);
+        put<uint64_t>(record, latencyNs);
+        put<uint16_t>(record, modelLength);
+        putBytes(record, capture->model.data(), modelLength);
+        putBytes(record, capture->inputs.data(), capture->inputs.size());
+        RecorderState* state = capture->state.get();
+        std::lock_guard<std::mutex> guard(state->lock);
+        if (state->file != nullptr && fwrite(record.data(), 1, record.size(), state->file) == record.size()) {
+            fflush(state->file);
+            state->count.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    delete capture;
+}
+
+void forget(const MNN_Interpreter* net) {
+    std::lock_guard<std::mutex> guard(gRegistryLock);
+    if (gRegistry.erase(net) > 0) {
+        gAttached.fetch_sub(1, std::memory_order_relaxed);
+        publishLocked();
+    }
+}
+
+} // namespace Recorder
+
+// -------------------------- 录制 --------------------------
+struct MNN_Recorder* MNN_Recorder_open(const char* path, float sampleRate) {
+    if (path == nullptr || !(sampleRate > 0.0f)) {
+        return nullptr;
+    }
+    FILE* file = fopen(path, "r+b");
+    if (file == nullptr) {
+        file = fopen(path, "w+b");
+    }
+    if (file == nullptr) {
+        return nullptr;
+    }
+    long complete = 0;
+    if (!completeLength(file, &complete)) {
+        fclose(file);
+        return nullptr;
+    }
+    fflush(file);
+    if (ftruncate(fileno(file), complete) != 0) {
+        fclose(file);
+        return nullptr;
+    }
+    fseek(file, complete, SEEK_SET);
+    if (complete == 0) {
+        fwrite(kMagic, 1, sizeof(kMagic), file);
+        fflush(file);
+    }
+    auto recorder = new MNN_Recorder();
+    recorder->state = std::make_shared<RecorderState>();
+    recorder->state->file = file;
+    MNN_Recorder_setSampleRate(recorder, sampleRate);
+    return recorder;
+}
+
+void MNN_Recorder_close(struct MNN_Recorder* recorder) {
+    if (recorder == nullptr) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> guard(gRegistryLock);
+        for (auto iter = gRegistry.begin(); iter != gRegistry.end();) {
+            if (iter->second == recorder->state) {
+                iter = gRegistry.erase(iter);
+                Recorder::gAttached.fetch_sub(1, std::memory_order_relaxed);
+            } else {
+                ++iter;
+            }
+        }
+        publishLocked();
+    }
+    // 进行中的 capture 仍持有 state，最后一个释放时关闭文件
+    delete recorder;
+}
+
+void MNN_Recorder_setSampleRate(struct MNN_Recorder* recorder, float sampleRate) {
+    if (recorder == nullptr) {
+        return;
+    }
+    double rate = sampleRate > 1.0f ? 1.0 : (sampleRate < 0.0f ? 0.0 : (double)sampleRate);
+    recorder->state->sampleRate.store(rate, std::memory_order_relaxed);
+}
+
+void MNN_Recorder_attach(struct MNN_Recorder* recorder, const struct MNN_Interpreter* net) {
+    if (recorder == nullptr || net == nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> guard(gRegistryLock);
+    auto& slot = gRegistry[net];
+    if (slot == nullptr) {
+        Recorder::gAttached.fetch_add(1, std::memory_order_relaxed);
+    }
+    slot = recorder->state;
+    publishLocked();
+}
+
+void MNN_Recorder_detach(struct MNN_Recorder* recorder, const struct MNN_Interpreter* net) {
+    if (recorder == nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> guard(gRegistryLock);
+    auto iter = gRegistry.find(net);
+    if (iter != gRegistry.end() && iter->second == recorder->state) {
+        gRegistry.erase(iter);
+        Recorder::gAttached.fetch_sub(1, std::memory_order_relaxed);
+        publishLocked();
+    }
+}
+
+uint64_t MNN_Recorder_count(struct MNN_Recorder* recorder) {
+    if (recorder == nullptr) {
+        return 0;
+    }
+    return recorder->state->count.load(std::memory_order_relaxed);
+}
+
+// -------------------------- 读取与回放 --------------------------
+struct MNN_RecordReader* MNN_RecordReader_open(const char* path) {
+    if (path == nullptr) {
+        return nullptr;
+    }
+    FILE* file = fopen(path, "rb");
+    if (file == nullptr) {
+        return nullptr;
+    }
+    char magic[sizeof(kMagic)];
+    if (fread(magic, 1, sizeof(magic), file) != sizeof(magic) || memcmp(magic, kMagic, sizeof(kMagic)) != 0) {
+        fclose(file);
+        return nullptr;
+    }
+    auto reader = new MNN_RecordReader();
+    reader->file = file;
+    return reader;
+}
+
+void MNN_RecordReader_close(struct MNN_RecordReader* reader) {
+    if (reader == nullptr) {
+        return;
+    }
+    fclose(reader->file);
+    delete reader;
+}
+
+MNN_BOOL MNN_RecordReader_next(struct MNN_RecordReader* reader, MNN_Record* record) {
+    if (reader == nullptr || record == nullptr) {
+        return false;
+    }
+    uint32_t length = 0;
+    if (fread(&length, 1, sizeof(length), reader->file) != sizeof(length)) {
+        return false;
+    }
+    reader->buffer.resize(length);
+    if (fread(reader->buffer.data(), 1, length, reader->file) != length) {
+        return false;
+    }
+    const std::vector<uint8_t>& buffer = reader->buffer;
+    size_t offset = 0;
+    uint16_t modelLength = 0;
+    uint16_t count = 0;
+    const uint8_t* bytes = nullptr;
+    if (!get(buffer, &offset, &record->timestampNs) || !get(buffer, &offset, &record->latencyNs) ||
+        !get(buffer, &offset, &modelLength) || !getBytes(buffer, &offset, modelLength, &bytes)) {
+        return false;
+    }
+    reader->model.assign(reinterpret_cast<const char*>(bytes), modelLength);
+    if (!get(buffer, &offset, &count)) {
+        return false;
+    }
+    reader->names.resize(count);
+    reader->dims.resize(count);
+    reader->data.resize(count);
+    reader->inputs.resize(count);
+    for (int i = 0; i < count; ++i) {
+        uint16_t nameLength = 0;
+        uint8_t code = 0;
+        uint8_t bits = 0;
+        uint8_t dimType = 0;
+        uint8_t dimCount = 0;
+        if (!get(buffer, &offset, &nameLength) || !getBytes(buffer, &offset, nameLength, &bytes)) {
+            return false;
+        }
+        reader->names[i].assign(reinterpret_cast<const char*>(bytes), nameLength);
+        if (!get(buffer, &offset, &code) || !get(buffer, &offset, &bits) || !get(buffer, &offset, &dimType) ||
+            !get(buffer, &offset, &dimCount)) {
+            return false;
+        }
+        reader->dims[i].resize(dimCount);
+        for (int d = 0; d < dimCount; ++d) {
+            int32_t dim = 0;
+            if (!get(buffer, &offset, &dim)) {
+                return false;
+            }
+            reader->dims[i][d] = dim;
+        }
+        uint32_t size = 0;
+        if (!get(buffer, &offset, &size) || !getBytes(buffer, &offset, size, &bytes)) {
+            return false;
+        }
+        // 复制到独立缓冲，保证数据按元素类型对齐
+        reader->data[i].assign(bytes, bytes + size);
+        MNN_RecordInput& input = reader->inputs[i];
+        input.name = reader->names[i].c_str();
+        input.type.code = (halide_type_code_t)code;
+        input.type.bits = bits;
+        input.type.lanes = 1;
+        input.dimType = (MNN_DimensionType)dimType;
+        input.dims = reader->dims[i].data();
+        input.dimCount = dimCount;
+        input.data = reader->data[i].data();
+        input.size = size;
+    }
+    record->model = reader->model.c_str();
+    record->inputs = reader->inputs.data();
+    record->inputCount = count;
+    return true;
+}
+
+MNN_ErrorCode MNN_Record_apply(struct MNN_Interpreter* net, struct MNN_Session* session, const MNN_Record* record,
+                               MNN_BOOL* resized) {
+    if (resized != nullptr) {
+        *resized = false;
+    }
+    if (net == nullptr || session == nullptr || record == nullptr) {
+        return MNN_INVALID_VALUE;
+    }
+    // 先校验全部输入（名字、类型、形状与数据长度）再 resize，任何一项不合法都不会让 Session 停在只改了一部分形状的状态
+    std::vector<MNN_Tensor*> tensors(record->inputCount, nullptr);
+    std::vector<MNN_Tensor*> hosts;
+    std::vector<bool> reshape(record->inputCount, false);
+    MNN_ErrorCode code = MNN_NO_ERROR;
+    for (int i = 0; i < record->inputCount && code == MNN_NO_ERROR; ++i) {
+        const MNN_RecordInput& input = record->inputs[i];
+        tensors[i] = MNN_Interpreter_getSessionInput(net, session, input.name);
+        if (tensors[i] == nullptr) {
+            code = MNN_INVALID_VALUE;
+            break;
+        }
+        halide_type_t type;
+        MNN_Tensor_GetHalideType(tensors[i], &type);
+        if (type.code != input.type.code || type.bits != input.type.bits) {
+            code = MNN_INVALID_VALUE;
+            break;
+        }
+        // 包装记录中的数据，不拷贝；按记录的布局算出的字节数必须与数据长度一致
+        MNN_Tensor* host = MNN_Tensor_CreateHost(input.dims, input.dimCount, input.type, const_cast<void*>(input.data),
+                                                 input.dimType);
+        if (host == nullptr) {
+            code = MNN_INVALID_VALUE;
+            break;
+        }
+        hosts.push_back(host);
+        if ((size_t)MNN_Tensor_Size(host) != input.size) {
+            code = MNN_INVALID_VALUE;
+            break;
+        }
+        int dimCount = 0;
+        int* shape = MNN_Tensor_Shape(tensors[i], &dimCount);
+        reshape[i] = shape == nullptr || dimCount != input.dimCount ||
+                     std::vector<int>(shape, shape + dimCount) != std::vector<int>(input.dims, input.dims + input.dimCount);
+        MNN_Tensor_FreeShape(shape);
+    }
+    bool changed = false;
+    for (int i = 0; i < record->inputCount && code == MNN_NO_ERROR; ++i) {
+        if (reshape[i]) {
+            const MNN_RecordInput& input = record->inputs[i];
+            MNN_Interpreter_resizeTensor(net, tensors[i], input.dims, input.dimCount);
+            changed = true;
+        }
+    }
+    if (changed) {
+        MNN_Interpreter_resizeSession(net, session);
+        if (resized != nullptr) {
+            *resized = true;
+        }
+        // resizeSession 没有返回值，由 RESIZE_STATUS 判断：0 就绪，1 内存分配失败，2 形状计算失败
+        int status = 0;
+        if (MNN_Interpreter_getSessionInfo(net, session, MNN_SESSION_INFO_CODE_RESIZE_STATUS, &status) && status != 0) {
+            code = status == 1 ? MNN_OUT_OF_MEMORY : MNN_INVALID_VALUE;
+        }
+    }
+    for (size_t i = 0; i < hosts.size() && code == MNN_NO_ERROR; ++i) {
+        if (!MNN_Tensor_CopyFromHostTensor(tensors[i], hosts[i])) {
+            code = MNN_INVALID_VALUE;
+        }
+    }
+    for (auto host : hosts) {
+        MNN_Tensor_Destroy(host);
+    }
+    return code;
+}
@@ -0,0 +1,99 @@
+//
+//  Recorder_c.h
+//  MNN
+//
+//  流量录制与回放：Recorder 挂到 Interpreter 上后，runSession 按比例抽样，
+//  把输入张量的形状、类型、数据与实测 runSession 延迟追加写入紧凑的二进制文件；
+//  RecordReader 顺序读出记录，MNN_Record_apply 把记录的输入恢复到 Session 上供回放
+//
+//  文件格式（小端）：8 字节魔数 "MNNREC1\0"，随后是若干条记录，每条为
+//    u32 长度（不含自身） | u64 时间戳 ns | u64 延迟 ns | u16 模型名长 | 模型名 | u16 输入数 |
+//    每个输入：u16 名长 | 名 | u8 类型码 | u8 位宽 | u8 维度类型 | u8 维数 | i32 维度 x 维数 | u32 字节数 | 数据
+//  写入中断时尾部的残缺记录在读取时被忽略
+//
+
+#ifndef MNN_Recorder_c_h
+#define MNN_Recorder_c_h
+
+#include <stdint.h>
+#include "Interpreter_c.h"
+
+// 导出宏：Windows下导出，其他平台兼容
+#ifdef MNN_C_EXPORTS
+    // 仅当编译 libmnn.dll 时定义 MNN_C_EXPORTS，此时用 dllexport
+    #define MNN_C_API __declspec(dllexport)
+#else
+    #define MNN_C_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct MNN_Recorder MNN_Recorder;
+typedef struct MNN_RecordReader MNN_RecordReader;
+
+typedef struct MNN_RecordInput {
+    const char* name;
+    struct halide_type_t type;
+    enum MNN_DimensionType dimType;
+    const int* dims;
+    int dimCount;
+    const void* data;
+    size_t size;            // 数据字节数
+} MNN_RecordInput;
+
+// 读出的一条记录，指针在下一次 MNN_RecordReader_next 前有效
+typedef struct MNN_Record {
+    uint64_t timestampNs;   // 录制时的系统时间
+    uint64_t latencyNs;     // 录制时 runSession 的耗时
+    const char* model;      // 模型 uuid()
+    const MNN_RecordInput* inputs;
+    int inputCount;
+} MNN_Record;
+
+/**
+ * @brief open path for appending; a new file gets the magic header. A record left incomplete at the end
+ * of an existing file (a crash while writing) is truncated so appended records stay readable.
+ * @return NULL when the file cannot be opened or is not a record file.
+ * @param sampleRate fraction of runs to capture in (0, 1]; samples are evenly spaced, not random.
+ */
+MNN_C_API struct MNN_Recorder* MNN_Recorder_open(const char* path, float sampleRate);
+/**
+ * @brief detach from every interpreter and close. Captures already in flight finish writing first.
+ */
+MNN_C_API void MNN_Recorder_close(struct MNN_Recorder* recorder);
+MNN_C_API void MNN_Recorder_setSampleRate(struct MNN_Recorder* recorder, float sampleRate);
+/**
+ * @brief capture runSession calls on every session of net. An interpreter has at most one recorder;
+ * attaching replaces the previous one.
+ */
+MNN_C_API void MNN_Recorder_attach(struct MNN_Recorder* recorder, const struct MNN_Interpreter* net);
+MNN_C_API void MNN_Recorder_detach(struct MNN_Recorder* recorder, const struct MNN_Interpreter* net);
+/**
+ * @brief number of records written since open.
+ */
+MNN_C_API uint64_t MNN_Recorder_count(struct MNN_Recorder* recorder);
+
+MNN_C_API struct MNN_RecordReader* MNN_RecordReader_open(const char* path);
+MNN_C_API void MNN_RecordReader_close(struct MNN_RecordReader* reader);
+/**
+ * @brief read the next record.
+ * @return false at end of file or on a truncated record.
+ */
+MNN_C_API MNN_BOOL MNN_RecordReader_next(struct MNN_RecordReader* reader, MNN_Record* record);
+/**
+ * @brief copy the recorded inputs into session, resizing the session first when any shape differs.
+ * @param resized optional, set to whether a resize happened.
+ * @return MNN_INVALID_VALUE when an input name is missing, its type does not match or its data size does
+ * not match its shape (all inputs are checked before any is resized, so the session is left as it was),
+ * or the error of the resize (MNN_OUT_OF_MEMORY when it could not allocate).
+ */
+MNN_C_API MNN_ErrorCode MNN_Record_apply(struct MNN_Interpreter* net, struct MNN_Session* session,
+                                         const MNN_Record* record, MNN_BOOL* resized);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MNN_Recorder_c_h */
@@ -0,0 +1,430 @@
+//
+//  RequestQueue_c.cpp
+//  MNN
+//
+
+#include "RequestQueue_c.h"
+#include "Tensor_c.h"
+#include <stdint.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "ShapeCopy.hpp"
+
+namespace {
+
+struct Cell {
+    std::atomic<size_t> sequence;
+    MNN_QueueRequest* request;
+};
+
+struct Worker {
+    // MNN 对同一 Interpreter 的运行加锁串行，每个工作线程在各自的 Interpreter 上：
+    // 第一个用调用方的 net，其余各持有一个副本
+    MNN_Interpreter* net = nullptr;
+    MNN_Session* session = nullptr;
+    std::vector<MNN_Tensor*> inputs;    // 与请求的输入槽位一一对应
+    std::vector<MNN_Tensor*> outputs;
+    std::thread thread;
+};
+
+} // namespace
+
+struct MNN_QueueRequest {
+    MNN_RequestQueue* queue = nullptr;
+    std::vector<MNN_Tensor*> hosts;     // 先输入后输出
+    uint64_t enqueuedNs = 0;
+    uint64_t queueNs = 0;
+    MNN_ErrorCode code = MNN_NO_ERROR;
+    bool done = false;
+    std::mutex lock;
+    std::condition_variable finished;
+};
+
+struct MNN_RequestQueue {
+    MNN_Interpreter* net = nullptr;
+    MNN_RequestQueueConfig config;
+    std::unique_ptr<Cell[]> cells;
+    size_t mask = 0;
+    // 生产者与消费者的位置各占一条缓存行，避免伪共享
+    char pad0[64];
+    std::atomic<size_t> enqueuePos{0};
+    char pad1[64];
+    std::atomic<size_t> dequeuePos{0};
+    char pad2[64];
+
+    std::vector<Worker*> workers;
+    std::map<std::string, int> slots;
+    std::vector<MNN_Tensor*> templates;
+    int inputCount = 0;
+    std::atomic<bool> stopping{false};
+    // 空闲工作线程在此休眠；生产者只在有人休眠时才加锁唤醒
+    std::mutex sleepLock;
+    std::condition_variable wake;
+    std::atomic<int> sleepers{0};
+
+    std::atomic<uint64_t> submitted{0};
+    std::atomic<uint64_t> rejectedFull{0};
+    std::atomic<uint64_t> rejectedAge{0};
+    std::atomic<uint64_t> expired{0};
+    std::atomic<uint64_t> completed{0};
+    std::atomic<uint64_t> dequeued{0};
+    std::atomic<uint64_t> totalQueueNs{0};
+    std::atomic<uint64_t> maxQueueNs{0};
+    std::atomic<uint64_t> lastQueueNs{0};
+    std::atomic<uint64_t> serviceNs{0};
+};
+
+// -------------------------- 内部工具 --------------------------
+static uint64_t nowNs() {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static bool enqueue(MNN_RequestQueue* q, MNN_QueueRequest* request) {
+    size_t pos = q->enqueuePos.load(std::memory_order_relaxed);
+    Cell* cell;
+    for (;;) {
+        cell = &q->cells[pos & q->mask];
+        size_t seq = cell->sequence.load(std::memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+        if (diff == 0) {
+            if (q->enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            return false;
+        } else {
+            pos = q->enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+    cell->request = request;
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+static MNN_QueueRequest* dequeue(MNN_RequestQueue* q) {
+    size_t pos = q->dequeuePos.load(std::memory_order_relaxed);
+    Cell* cell;
+    for (;;) {
+        cell = &q->cells[pos & q->mask];
+        size_t seq = cell->sequence.load(std::memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)(pos + 1);
+        if (diff == 0) {
+            if (q->dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            return nullptr;
+        } else {
+            pos = q->dequeuePos.load(std::memory_order_relaxed);
+        }
+    }
+    MNN_QueueRequest* request = cell->request;
+    cell->sequence.store(pos + q->mask + 1, std::memory_order_release);
+    return request;
+}
+
+static int depthOf(MNN_RequestQueue* q) {
+    size_t tail = q->enqueuePos.load(std::memory_order_relaxed);
+    size_t head = q->dequeuePos.load(std::memory_order_relaxed);
+    return tail > head ? (int)(tail - head) : 0;
+}
+
+// 持锁通知：等待方醒来后可能立即销毁请求
+static void complete(MNN_QueueRequest* request, MNN_ErrorCode code) {
+    std::lock_guard<std::mutex> guard(request->lock);
+    request->code = code;
+    request->done = true;
+    request->finished.notify_all();
+}
+
+static MNN_ErrorCode execute(MNN_RequestQueue* q, Worker* worker, MNN_QueueRequest* request) {
+    for (size_t i = 0; i < worker->inputs.size(); ++i) {
+        if (!MNN_Tensor_CopyFromHostTensor(worker->inputs[i], request->hosts[i])) {
+            return MNN_INVALID_VALUE;
+        }
+    }
+    MNN_ErrorCode code = MNN_Interpreter_runSession(worker->net, worker->session);
+    if (code != MNN_NO_ERROR) {
+        return code;
+    }
+    for (size_t i = 0; i < worker->outputs.size(); ++i) {
+        if (!MNN_Tensor_CopyToHostTensor(worker->outputs[i], request->hosts[q->inputCount + i])) {
+            return MNN_INVALID_VALUE;
+        }
+    }
+    return MNN_NO_ERROR;
+}
+
+// 短暂自旋后休眠；先登记 sleepers 再复查队列，与 submit 的“先入队再看 sleepers”配对，不会漏唤醒
+static MNN_QueueRequest* next(MNN_RequestQueue* q) {
+    for (int spin = 0; spin < 64; ++spin) {
+        MNN_QueueRequest* request = dequeue(q);
+        if (request != nullptr) {
+            return request;
+        }
+        std::this_thread::yield();
+    }
+    std::unique_lock<std::mutex> guard(q->sleepLock);
+    for (;;) {
+        q->sleepers.fetch_add(1);
+        MNN_QueueRequest* request = dequeue(q);
+        if (request != nullptr || q->stopping.load()) {
+            q->sleepers.fetch_sub(1);
+            return request;
+        }
+        q->wake.wait(guard);
+        q->sleepers.fetch_sub(1);
+    }
+}
+
+static void workerLoop(MNN_RequestQueue* q, Worker* worker) {
+    for (;;) {
+        MNN_QueueRequest* request = next(q);
+        if (request == nullptr) {
+            return;
+        }
+        uint64_t start = nowNs();
+        uint64_t waited = start - request->enqueuedNs;
+        request->queueNs = waited;
+        q->dequeued.fetch_add(1, std::memory_order_relaxed);
+        q->totalQueueNs.fetch_add(waited, std::memory_order_relaxed);
+        q->lastQueueNs.store(waited, std::memory_order_relaxed);
+        uint64_t maxNs = q->maxQueueNs.load(std::memory_order_relaxed);
+        while (waited > maxNs && !q->maxQueueNs.compare_exchange_weak(maxNs, waited, std::memory_order_relaxed)) {
+        }
+        if (q->config.maxQueueAgeUs > 0 && waited > q->config.maxQueueAgeUs * 1000) {
+            q->expired.fetch_add(1, std::memory_order_relaxed);
+            complete(request, MNN_DEADLINE_EXCEEDED);
+            continue;
+        }
+        MNN_ErrorCode code = execute(q, worker, request);
+        uint64_t service = nowNs() - start;
+        uint64_t average = q->serviceNs.load(std::memory_order_relaxed);
+        q->serviceNs.store(average == 0 ? service : (average * 7 + service) / 8, std::memory_order_relaxed);
+        q->completed.fetch_add(1, std::memory_order_relaxed);
+        complete(request, code);
+    }
+}
+
+static void releaseAll(MNN_RequestQueue* q) {
+    for (auto worker : q->workers) {
+        if (worker->session != nullptr) {
+            MNN_Interpreter_releaseSession(worker->net, worker->session);
+        }
+        if (worker->net != nullptr && worker->net != q->net) {
+            MNN_Interpreter_destroy(worker->net);
+        }
+        delete worker;
+    }
+    delete q;
+}
+
+static bool bindWorker(MNN_RequestQueue* q, Worker* worker, const struct MNN_ScheduleConfig* config) {
+    bool first = q->slots.empty();
+    worker->net = first ? q->net : MNN_Interpreter_createReplica(q->net);
+    if (worker->net == nullptr) {
+        return false;
+    }
+    worker->session = MNN_Interpreter_createSession(worker->net, config);
+    if (worker->session == nullptr) {
+        return false;
+    }
+    MNN_NamedTensorList inputs = MNN_Interpreter_GetSessionInputAll(worker->net, worker->session);
+    if (!first) {
+        // 副本上的 Session 只有模型默认形状，按名字改成第一个 Session 的输入形状后再取输出
+        bool resized = false;
+        for (int i = 0; i < inputs.count; ++i) {
+            auto iter = q->slots.find(inputs.tensors[i].name);
+            if (iter != q->slots.end() && iter->second < q->inputCount) {
+                resized = copyShape(worker->net, q->templates[iter->second], inputs.tensors[i].tensor) || resized;
+            }
+        }
+        if (resized) {
+            MNN_Interpreter_resizeSession(worker->net, worker->session);
+        }
+    }
+    MNN_NamedTensorList outputs = MNN_Interpreter_GetSessionOutputAll(worker->net, worker->session);
+    // 第一个 Session 决定槽位，其余 Session 的张量按名字对齐
+    if (first) {
+        q->inputCount = inputs.count;
+        for (int i = 0; i < inputs.count; ++i) {
+            q->slots[inputs.tensors[i].name] = i;
+            q->templates.push_back(inputs.tensors[i].tensor);
+        }
+        for (int i = 0; i < outputs.count; ++i) {
+            q->slots[outputs.tensors[i].name] = inputs.count + i;
+            q->templates.push_back(outputs.tensors[i].tensor);
+        }
+    }
+    worker->inputs.assign(inputs.count, nullptr);
+    worker->outputs.assign(outputs.count, nullptr);
+    for (int i = 0; i < inputs.count; ++i) {
+        worker->inputs[q->slots[inputs.tensors[i].name]] = inputs.tensors[i].tensor;
+    }
+    for (int i = 0; i < outputs.count; ++i) {
+        worker->outputs[q->slots[outputs.tensors[i].name] - q->inputCount] = outputs.tensors[i].tensor;
+    }
+    MNN_NamedTensorList_Free(inputs);
+    MNN_NamedTensorList_Free(outputs);
+    return true;
+}
+
+// -------------------------- 接口实现 --------------------------
+struct MNN_RequestQueue* MNN_RequestQueue_create(struct MNN_Interpreter* net, const struct MNN_ScheduleConfig* config,
+                                                 const MNN_RequestQueueConfig* queueConfig) {
+    if (net == nullptr || queueConfig == nullptr || queueConfig->workers <= 0 || queueConfig->capacity <= 0) {
+        return nullptr;
+    }
+    auto q = new MNN_RequestQueue();
+    q->net = net;
+    q->config = *queueConfig;
+    size_t capacity = 2;
+    while (capacity < (size_t)queueConfig->capacity) {
+        capacity <<= 1;
+    }
+    if (q->config.maxDepth <= 0 || q->config.maxDepth > (int)capacity) {
+        q->config.maxDepth = (int)capacity;
+    }
+    q->cells.reset(new Cell[capacity]);
+    for (size_t i = 0; i < capacity; ++i) {
+        q->cells[i].sequence.store(i, std::memory_order_relaxed);
+        q->cells[i].request = nullptr;
+    }
+    q->mask = capacity - 1;
+    for (int i = 0; i < queueConfig->workers; ++i) {
+        auto worker = new Worker();
+        q->workers.push_back(worker);
+        if (!bindWorker(q, worker, config)) {
+            releaseAll(q);
+            return nullptr;
+        }
+    }
+    for (auto worker : q->workers) {
+        worker->thread = std::thread(workerLoop, q, worker);
+    }
+    return q;
+}
+
+void MNN_RequestQueue_destroy(struct MNN_RequestQueue* queue) {
+    if (queue == nullptr) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> guard(queue->sleepLock);
+        queue->stopping.store(true);
+    }
+    queue->wake.notify_all();
+    for (auto worker : queue->workers) {
+        worker->thread.join();
+    }
+    releaseAll(queue);
+}
+
+struct MNN_QueueRequest* MNN_RequestQueue_createRequest(struct MNN_RequestQueue* queue) {
+    if (queue == nullptr) {
+        return nullptr;
+    }
+    auto request = new MNN_QueueRequest();
+    request->queue = queue;
+    for (auto tensor : queue->templates) {
+        request->hosts.push_back(MNN_Tensor_CreateHostTensorFromDevice(tensor, 0));
+    }
+    return request;
+}
+
+void MNN_QueueRequest_destroy(struct MNN_QueueRequest* request) {
+    if (request == nullptr) {
+        return;
+    }
+    for (auto host : request->hosts) {
+        MNN_Tensor_Destroy(host);
+    }
+    delete request;
+}
+
+struct MNN_Tensor* MNN_QueueRequest_tensor(struct MNN_QueueRequest* request, const char* name) {
+    if (request == nullptr || name == nullptr) {
+        return nullptr;
+    }
+    auto iter = request->queue->slots.find(name);
+    return iter == request->queue->slots.end() ? nullptr : request->hosts[iter->second];
+}
+
+MNN_ErrorCode MNN_RequestQueue_submit(struct MNN_RequestQueue* queue, struct MNN_QueueRequest* request) {
+    if (queue == nullptr || request == nullptr || request->queue != queue) {
+        return MNN_INVALID_VALUE;
+    }
+    queue->submitted.fetch_add(1, std::memory_order_relaxed);
+    int depth = depthOf(queue);
+    if (depth >= queue->config.maxDepth) {
+        queue->rejectedFull.fetch_add(1, std::memory_order_relaxed);
+        return MNN_RESOURCE_EXHAUSTED;
+    }
+    if (queue->config.maxQueueAgeUs > 0 && depth > 0) {
+        // 已有积压时，按积压量估算的等待或最近一次实际排队时间超限都直接拒绝；
+        // 各工作线程并行执行，排在前面的请求要 ceil(depth / workers) 轮才能处理完
+        uint64_t limitNs = queue->config.maxQueueAgeUs * 1000;
+        uint64_t workers = queue->workers.size();
+        uint64_t estimateNs = queue->serviceNs.load(std::memory_order_relaxed) * ((depth + workers - 1) / workers);
+        if (estimateNs > limitNs || queue->lastQueueNs.load(std::memory_order_relaxed) > limitNs) {
+            queue->rejectedAge.fetch_add(1, std::memory_order_relaxed);
+            return MNN_RESOURCE_EXHAUSTED;
+        }
+    }
+    {
+        std::lock_guard<std::mutex> guard(request->lock);
+        request->done = false;
+        request->code = MNN_NO_ERROR;
+    }
+    request->queueNs = 0;
+    request->enqueuedNs = nowNs();
+    if (!enqueue(queue, request)) {
+        queue->rejectedFull.fetch_add(1, std::memory_order_relaxed);
+        return MNN_RESOURCE_EXHAUSTED;
+    }
+    // 入队（release 写）与读 sleepers 之间需要全屏障，否则可能读到旧值而漏唤醒
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (queue->sleepers.load() > 0) {
+        std::lock_guard<std::mutex> guard(queue->sleepLock);
+        queue->wake.notify_one();
+    }
+    return MNN_NO_ERROR;
+}
+
+MNN_ErrorCode MNN_QueueRequest_wait(struct MNN_QueueRequest* request) {
+    if (request == nullptr) {
+        return MNN_INVALID_VALUE;
+    }
+    std::unique_lock<std::mutex> guard(request->lock);
+    request->finished.wait(guard, [request]() { return request->done; });
+    return request->code;
+}
+
+double MNN_QueueRequest_queueUs(struct MNN_QueueRequest* request) {
+    return request == nullptr ? 0.0 : request->queueNs / 1e3;
+}
+
+void MNN_RequestQueue_getStats(struct MNN_RequestQueue* queue, MNN_RequestQueueStats* stats) {
+    if (queue == nullptr || stats == nullptr) {
+        return;
+    }
+    stats->submitted = queue->submitted.load(std::memory_order_relaxed);
+    stats->rejectedFull = queue->rejectedFull.load(std::memory_order_relaxed);
+    stats->rejectedAge = queue->rejectedAge.load(std::memory_order_relaxed);
+    stats->expired = queue->expired.load(std::memory_order_relaxed);
+    stats->completed = queue->completed.load(std::memory_order_relaxed);
+    stats->depth = depthOf(queue);
+    uint64_t dequeued = queue->dequeued.load(std::memory_order_relaxed);
+    stats->meanQueueUs = dequeued > 0 ? queue->totalQueueNs.load(std::memory_order_relaxed) / 1e3 / dequeued : 0.0;
+    stats->maxQueueUs = queue->maxQueueNs.load(std::memory_order_relaxed) / 1e3;
+    stats->lastQueueUs = queue->lastQueueNs.load(std::memory_order_relaxed) / 1e3;
+    stats->serviceUs = queue->serviceNs.load(std::memory_order_relaxed) / 1e3;
+}
@@ -0,0 +1,95 @@
+//
+//  RequestQueue_c.h
+//  MNN
+//
+//  原生请求队列：有界无锁多生产者多消费者环形队列（Vyukov 算法）接在一组 Session 工作线程前，
+//  请求携带输入输出的主机张量。入队时按队列深度与预计排队时间做准入控制，超出即快速拒绝，
+//  出队时丢弃排队过久的请求；排队时延在原生侧可见并通过统计暴露
+//
+
+#ifndef MNN_RequestQueue_c_h
+#define MNN_RequestQueue_c_h
+
+#include <stdint.h>
+#include "Interpreter_c.h"
+
+// 导出宏：Windows下导出，其他平台兼容
+#ifdef MNN_C_EXPORTS
+    // 仅当编译 libmnn.dll 时定义 MNN_C_EXPORTS，此时用 dllexport
+    #define MNN_C_API __declspec(dllexport)
+#else
+    #define MNN_C_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct MNN_RequestQueue MNN_RequestQueue;
+// 一次请求的载体，持有模型所有输入输出的主机张量，可反复提交
+typedef struct MNN_QueueRequest MNN_QueueRequest;
+
+typedef struct MNN_RequestQueueConfig {
+    int workers;            // 工作线程数，每个线程一个 Session
+    int capacity;           // 环形队列容量，向上取 2 的幂
+    int maxDepth;           // 排队数达到该值即拒绝，<= 0 时等于容量
+    uint64_t maxQueueAgeUs; // 预计或最近实际排队时间超过该值即拒绝，出队时超龄的请求直接失败；0 不限制
+} MNN_RequestQueueConfig;
+
+typedef struct MNN_RequestQueueStats {
+    uint64_t submitted;
+    uint64_t rejectedFull;      // 因深度拒绝
+    uint64_t rejectedAge;       // 因排队时间拒绝
+    uint64_t expired;           // 出队时已超龄
+    uint64_t completed;
+    int depth;
+    double meanQueueUs;         // 出队请求的平均排队时间
+    double maxQueueUs;
+    double lastQueueUs;
+    double serviceUs;           // 单次执行时间（含拷贝）的滑动平均
+} MNN_RequestQueueStats;
+
+/**
+ * @brief create one session per worker and start the workers.
+ * The first worker uses net, every other one its own replica of net (MNN_Interpreter_createReplica),
+ * owned by the queue, so that workers run in parallel; net's model must not be released.
+ * Shapes are fixed at creation: the first worker's session starts with the model's input shapes and every
+ * replica session is resized to them.
+ */
+MNN_C_API struct MNN_RequestQueue* MNN_RequestQueue_create(struct MNN_Interpreter* net, const struct MNN_ScheduleConfig* config,
+                                                           const MNN_RequestQueueConfig* queueConfig);
+/**
+ * @brief finish the requests already queued, stop the workers and release the sessions.
+ */
+MNN_C_API void MNN_RequestQueue_destroy(struct MNN_RequestQueue* queue);
+
+/**
+ * @brief create a request with host tensors for every model input and output.
+ */
+MNN_C_API struct MNN_QueueRequest* MNN_RequestQueue_createRequest(struct MNN_RequestQueue* queue);
+MNN_C_API void MNN_QueueRequest_destroy(struct MNN_QueueRequest* request);
+/**
+ * @brief host tensor of an input or output: fill inputs before submit, read outputs after wait.
+ */
+MNN_C_API struct MNN_Tensor* MNN_QueueRequest_tensor(struct MNN_QueueRequest* request, const char* name);
+/**
+ * @brief enqueue without blocking.
+ * @return MNN_NO_ERROR, or MNN_RESOURCE_EXHAUSTED when admission control rejects the request.
+ */
+MNN_C_API MNN_ErrorCode MNN_RequestQueue_submit(struct MNN_RequestQueue* queue, struct MNN_QueueRequest* request);
+/**
+ * @brief block until a submitted request has run.
+ * @return the run's result, or MNN_DEADLINE_EXCEEDED when it waited longer than maxQueueAgeUs.
+ */
+MNN_C_API MNN_ErrorCode MNN_QueueRequest_wait(struct MNN_QueueRequest* request);
+/**
+ * @brief time the request spent queued in its last submission, in microseconds.
+ */
+MNN_C_API double MNN_QueueRequest_queueUs(struct MNN_QueueRequest* request);
+MNN_C_API void MNN_RequestQueue_getStats(struct MNN_RequestQueue* queue, MNN_RequestQueueStats* stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MNN_RequestQueue_c_h */
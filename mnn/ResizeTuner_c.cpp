@@ -0,0 +1,295 @@
+//
+//  ResizeTuner_c.cpp
+//  MNN
+//
+
+#include "ResizeTuner_c.h"
+#include "Tensor_c.h"
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+namespace {
+
+// float32 输出按数值比较，其他类型按字节比较
+struct Output {
+    std::vector<float> values;
+    std::vector<uint8_t> bytes;
+};
+
+typedef std::vector<Output> Outputs;
+
+} // namespace
+
+// -------------------------- 内部工具 --------------------------
+static const float kTolerance = 1e-3f;
+// 非默认策略至少快这么多才会被选中，避免测量噪声导致来回切换
+static const double kMinGain = 0.03;
+
+static double msSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+static bool isFixed(MNN_ResizeStrategy strategy) {
+    return strategy == MNN_RESIZE_STRATEGY_FIXED || strategy == MNN_RESIZE_STRATEGY_FIXED_NO_REALLOC;
+}
+
+static bool isFloat32(const MNN_Tensor* host) {
+    halide_type_t type;
+    MNN_Tensor_GetHalideType(host, &type);
+    return type.code == halide_type_float && type.bits == 32;
+}
+
+// 每次都写入相同的确定性数据，各策略的输出才可比较
+static void fillInputs(MNN_Interpreter* net, MNN_Session* session) {
+    MNN_NamedTensorList list = MNN_Interpreter_GetSessionInputAll(net, session);
+    for (int i = 0; i < list.count; ++i) {
+        MNN_Tensor* host = MNN_Tensor_CreateHostTensorFromDevice(list.tensors[i].tensor, false);
+        if (host == nullptr) {
+            continue;
+        }
+        size_t size = (size_t)MNN_Tensor_Size(host);
+        void* data = MNN_Tensor_Host(host);
+        if (isFloat32(host)) {
+            float* values = static_cast<float*>(data);
+            for (size_t k = 0; k < size / sizeof(float); ++k) {
+                values[k] = (float)((k * 7919) % 251) / 251.0f - 0.5f;
+            }
+        } else {
+            memset(data, 0, size);
+        }
+        MNN_Tensor_CopyFromHostTensor(list.tensors[i].tensor, host);
+        MNN_Tensor_Destroy(host);
+    }
+    MNN_NamedTensorList_Free(list);
+}
+
+static Outputs capture(MNN_Interpreter* net, MNN_Session* session) {
+    Outputs outputs;
+    MNN_NamedTensorList list = MNN_Interpreter_GetSessionOutputAll(net, session);
+    outputs.resize(list.count);
+    for (int i = 0; i < list.count; ++i) {
+        MNN_Tensor* host = MNN_Tensor_CreateHostTensorFromDevice(list.tensors[i].tensor, true);
+        if (host == nullptr) {
+            continue;
+        }
+        size_t size = (size_t)MNN_Tensor_Size(host);
+        if (isFloat32(host)) {
+            const float* values = static_cast<const float*>(MNN_Tensor_Host(host));
+            outputs[i].values.assign(values, values + size / sizeof(float));
+        } else {
+            const uint8_t* bytes = static_cast<const uint8_t*>(MNN_Tensor_Host(host));
+            outputs[i].bytes.assign(bytes, bytes + size);
+        }
+        MNN_Tensor_Destroy(host);
+    }
+    MNN_NamedTensorList_Free(list);
+    return outputs;
+}
+
+static bool compare(const Outputs& reference, const Outputs& current, float* maxError) {
+    if (reference.size() != current.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < reference.size(); ++i) {
+        const Output& a = reference[i];
+        const Output& b = current[i];
+        if (a.values.size() != b.values.size() || a.bytes != b.bytes) {
+            return false;
+        }
+        float scale = 0.0f;
+        for (float v : a.values) {
+            scale = std::max(scale, fabsf(v));
+        }
+        scale = std::max(scale, 1e-6f);
+        for (size_t k = 0; k < a.values.size(); ++k) {
+            float error = fabsf(a.values[k] - b.values[k]) / scale;
+            *maxError = std::max(*maxError, error);
+            // NaN 也视为不一致
+            if (!(error <= kTolerance)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static double percentile(const std::vector<double>& sorted, double q) {
+    if (sorted.empty()) {
+        return 0.0;
+    }
+    size_t index = (size_t)(q * (sorted.size() - 1) + 0.5);
+    return sorted[std::min(index, sorted.size() - 1)];
+}
+
+// 过一遍形状序列；FIXED 策略在这一遍里打开追踪，结束时固定。
+// 模式作用于 net 上所有 Session，要追踪的 Session 都在同一个追踪窗口里过完
+static MNN_ErrorCode warmPass(MNN_Interpreter* net, MNN_Session* const* sessions, MNN_Tensor* const* tensors,
+                              int sessionCount, MNN_ResizeStrategy strategy, const MNN_ResizeShape* shapes,
+                              int shapeCount, bool fill) {
+    bool fixed = isFixed(strategy);
+    if (fixed) {
+        MNN_Interpreter_setSessionMode(net, MNN_SESSION_MODE_RESIZE_CHECK);
+    }
+    MNN_ErrorCode error = MNN_NO_ERROR;
+    for (int s = 0; s < sessionCount; ++s) {
+        for (int i = 0; i < shapeCount; ++i) {
+            MNN_Interpreter_resizeTensor(net, tensors[s], shapes[i].dims, shapes[i].dimCount);
+            MNN_ResizeStrategy_resize(net, sessions[s], strategy);
+            if (fill) {
+                fillInputs(net, sessions[s]);
+            }
+            MNN_ErrorCode code = MNN_Interpreter_runSession(net, sessions[s]);
+            if (code != MNN_NO_ERROR && error == MNN_NO_ERROR) {
+                error = code;
+            }
+        }
+    }
+    if (fixed) {
+        MNN_Interpreter_setSessionMode(net, MNN_SESSION_MODE_RESIZE_FIX);
+    }
+    return error;
+}
+
+// reference 由默认策略在第一轮填充，之后所有策略（包括默认策略自身）都与之比较
+static void runTrial(MNN_Interpreter* net, const MNN_ScheduleConfig* config, const char* input,
+                     const MNN_ResizeShape* shapes, int shapeCount, int rounds, MNN_ResizeTrial* trial,
+                     std::vector<Outputs>* reference) {
+    MNN_ResizeStrategy strategy = trial->strategy;
+    auto start = std::chrono::steady_clock::now();
+    MNN_Session* session = MNN_Interpreter_createSession(net, config);
+    if (session == nullptr) {
+        trial->error = MNN_INVALID_VALUE;
+        return;
+    }
+    MNN_Tensor* tensor = MNN_Interpreter_getSessionInput(net, session, input);
+    if (tensor == nullptr) {
+        trial->error = MNN_INVALID_VALUE;
+        MNN_Interpreter_releaseSession(net, session);
+        return;
+    }
+    trial->error = warmPass(net, &session, &tensor, 1, strategy, shapes, shapeCount, true);
+    trial->prepareMs = msSince(start);
+    trial->matched = true;
+    std::vector<double> resizeMs;
+    double runMs = 0.0;
+    for (int round = 0; round < rounds && trial->error == MNN_NO_ERROR; ++round) {
+        for (int i = 0; i < shapeCount; ++i) {
+            auto begin = std::chrono::steady_clock::now();
+            MNN_Interpreter_resizeTensor(net, tensor, shapes[i].dims, shapes[i].dimCount);
+            MNN_ResizeStrategy_resize(net, session, strategy);
+            resizeMs.push_back(msSince(begin));
+            fillInputs(net, session);
+            begin = std::chrono::steady_clock::now();
+            MNN_ErrorCode code = MNN_Interpreter_runSession(net, session);
+            runMs += msSince(begin);
+            if (code != MNN_NO_ERROR) {
+                trial->error = code;
+                break;
+            }
+            Outputs outputs = capture(net, session);
+            if (strategy == MNN_RESIZE_STRATEGY_DEFAULT && (int)reference->size() == i) {
+                reference->push_back(outputs);
+            } else if ((int)reference->size() <= i || !compare((*reference)[i], outputs, &trial->maxError)) {
+                trial->matched = false;
+            }
+        }
+    }
+    MNN_Interpreter_releaseSession(net, session);
+    if (trial->error != MNN_NO_ERROR) {
+        trial->matched = false;
+    }
+    if (resizeMs.empty()) {
+        return;
+    }
+    trial->resizes = (int)resizeMs.size();
+    trial->runMeanMs = runMs / resizeMs.size();
+    double sum = 0.0;
+    for (double v : resizeMs) {
+        sum += v;
+    }
+    trial->resizeMeanMs = sum / resizeMs.size();
+    std::sort(resizeMs.begin(), resizeMs.end());
+    trial->resizeP50Ms = percentile(resizeMs, 0.5);
+    trial->resizeP99Ms = percentile(resizeMs, 0.99);
+    trial->resizeMaxMs = resizeMs.back();
+}
+
+// -------------------------- 接口实现 --------------------------
+int MNN_ResizeTuner_tune(struct MNN_Interpreter* net, const struct MNN_ScheduleConfig* config, const char* input,
+                         const MNN_ResizeShape* shapes, int shapeCount, int rounds, MNN_ResizeTrial* trials) {
+    if (net == nullptr || config == nullptr || shapes == nullptr || shapeCount <= 0) {
+        return -1;
+    }
+    rounds = rounds > 0 ? rounds : 5;
+    MNN_ResizeTrial results[MNN_RESIZE_STRATEGY_COUNT];
+    std::vector<Outputs> reference;
+    for (int s = 0; s < MNN_RESIZE_STRATEGY_COUNT; ++s) {
+        memset(&results[s], 0, sizeof(results[s]));
+        results[s].strategy = (MNN_ResizeStrategy)s;
+        runTrial(net, config, input, shapes, shapeCount, rounds, &results[s], &reference);
+    }
+    if (trials != nullptr) {
+        memcpy(trials, results, sizeof(results));
+    }
+    double cost[MNN_RESIZE_STRATEGY_COUNT];
+    bool eligible[MNN_RESIZE_STRATEGY_COUNT];
+    for (int s = 0; s < MNN_RESIZE_STRATEGY_COUNT; ++s) {
+        const MNN_ResizeTrial& t = results[s];
+        eligible[s] = t.error == MNN_NO_ERROR && t.matched && t.resizes > 0;
+        cost[s] = t.resizeMeanMs + t.runMeanMs;
+    }
+    if (!eligible[MNN_RESIZE_STRATEGY_DEFAULT]) {
+        return -1;
+    }
+    int best = MNN_RESIZE_STRATEGY_DEFAULT;
+    double threshold = cost[MNN_RESIZE_STRATEGY_DEFAULT] * (1.0 - kMinGain);
+    for (int s = MNN_RESIZE_STRATEGY_DEFAULT + 1; s < MNN_RESIZE_STRATEGY_COUNT; ++s) {
+        if (eligible[s] && cost[s] < threshold && (best == MNN_RESIZE_STRATEGY_DEFAULT || cost[s] < cost[best])) {
+            best = s;
+        }
+    }
+    return best;
+}
+
+MNN_ErrorCode MNN_ResizeStrategy_prepare(struct MNN_Interpreter* net, struct MNN_Session* session,
+                                         MNN_ResizeStrategy strategy, const char* input,
+                                         const MNN_ResizeShape* shapes, int shapeCount) {
+    return MNN_ResizeStrategy_prepareAll(net, &session, 1, strategy, input, shapes, shapeCount);
+}
+
+MNN_ErrorCode MNN_ResizeStrategy_prepareAll(struct MNN_Interpreter* net, struct MNN_Session* const* sessions,
+                                            int sessionCount, MNN_ResizeStrategy strategy, const char* input,
+                                            const MNN_ResizeShape* shapes, int shapeCount) {
+    if (net == nullptr || sessions == nullptr || sessionCount <= 0 || (shapes == nullptr && shapeCount > 0)) {
+        return MNN_INVALID_VALUE;
+    }
+    std::vector<MNN_Tensor*> tensors(sessionCount, nullptr);
+    for (int s = 0; s < sessionCount; ++s) {
+        if (sessions[s] == nullptr) {
+            return MNN_INVALID_VALUE;
+        }
+        tensors[s] = MNN_Interpreter_getSessionInput(net, sessions[s], input);
+        if (tensors[s] == nullptr) {
+            return MNN_INVALID_VALUE;
+        }
+    }
+    if (!isFixed(strategy)) {
+        return MNN_NO_ERROR;
+    }
+    return warmPass(net, sessions, tensors.data(), sessionCount, strategy, shapes, shapeCount, false);
+}
+
+void MNN_ResizeStrategy_resize(struct MNN_Interpreter* net, struct MNN_Session* session,
+                               MNN_ResizeStrategy strategy) {
+    if (net == nullptr || session == nullptr) {
+        return;
+    }
+    if (strategy == MNN_RESIZE_STRATEGY_NO_REALLOC || strategy == MNN_RESIZE_STRATEGY_FIXED_NO_REALLOC) {
+        MNN_Interpreter_resizeSessionEx(net, session, 0);
+    } else {
+        MNN_Interpreter_resizeSession(net, session);
+    }
+}
@@ -0,0 +1,97 @@
+//
+//  ResizeTuner_c.h
+//  MNN
+//
+//  动态形状的 resize 策略调优：预热时对一段输入形状序列，分别测量
+//  普通 resizeSession、resizeSessionEx(needRelloc = 0)、以及先 RESIZE_CHECK 追踪再 RESIZE_FIX 的组合，
+//  以默认策略的输出为基准校验结果，选出 resize + run 最快的策略供后续 Session 使用
+//
+
+#ifndef MNN_ResizeTuner_c_h
+#define MNN_ResizeTuner_c_h
+
+#include "Interpreter_c.h"
+
+// 导出宏：Windows下导出，其他平台兼容
+#ifdef MNN_C_EXPORTS
+    // 仅当编译 libmnn.dll 时定义 MNN_C_EXPORTS，此时用 dllexport
+    #define MNN_C_API __declspec(dllexport)
+#else
+    #define MNN_C_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum MNN_ResizeStrategy {
+    MNN_RESIZE_STRATEGY_DEFAULT = 0,            // resizeSession
+    MNN_RESIZE_STRATEGY_NO_REALLOC = 1,         // resizeSessionEx(needRelloc = 0)：形状未变时不重新分配内存
+    MNN_RESIZE_STRATEGY_FIXED = 2,              // RESIZE_CHECK 追踪一遍形状序列后 RESIZE_FIX，再 resizeSession
+    MNN_RESIZE_STRATEGY_FIXED_NO_REALLOC = 3,   // 同上，再 resizeSessionEx(needRelloc = 0)
+    MNN_RESIZE_STRATEGY_COUNT = 4
+} MNN_ResizeStrategy;
+
+typedef struct MNN_ResizeShape {
+    const int* dims;
+    int dimCount;
+} MNN_ResizeShape;
+
+typedef struct MNN_ResizeTrial {
+    MNN_ResizeStrategy strategy;
+    MNN_ErrorCode error;        // 第一个失败的 runSession，成功为 MNN_NO_ERROR
+    MNN_BOOL matched;           // 每次运行的输出都与默认策略一致
+    float maxError;             // 相对默认策略输出的最大误差（相对其最大绝对值）
+    int resizes;                // 计时的 resize 次数
+    double prepareMs;           // 创建 Session 与追踪（或普通预热）一遍形状序列的耗时
+    double resizeMeanMs;        // resizeTensor + resizeSession
+    double resizeP50Ms;
+    double resizeP99Ms;
+    double resizeMaxMs;
+    double runMeanMs;
+} MNN_ResizeTrial;
+
+/**
+ * @brief measure every strategy on its own fresh session over the shape sequence of one input:
+ * one untimed pass (the trace for the FIXED strategies), then `rounds` timed passes, each step being
+ * resizeTensor + resize, filling the inputs with a fixed pattern and runSession.
+ * A strategy is only eligible when every run succeeds and its outputs match the default strategy;
+ * one that is not the default must also be at least 3% faster than it on resize + run.
+ * RESIZE_CHECK / RESIZE_FIX apply to every session of net, so tune before creating the serving sessions.
+ * @param input input name, NULL for the first input. The other inputs keep their shapes.
+ * @param rounds timed passes over the sequence, <= 0 means 5.
+ * @param trials optional, MNN_RESIZE_STRATEGY_COUNT entries indexed by strategy.
+ * @return the chosen strategy, or -1 when the default strategy itself fails.
+ */
+MNN_C_API int MNN_ResizeTuner_tune(struct MNN_Interpreter* net, const struct MNN_ScheduleConfig* config,
+                                   const char* input, const MNN_ResizeShape* shapes, int shapeCount, int rounds,
+                                   MNN_ResizeTrial* trials);
+/**
+ * @brief get new sessions ready for the strategy. For the FIXED strategies this sets RESIZE_CHECK,
+ * resizes and runs each session once per shape (inputs are not touched), then sets RESIZE_FIX;
+ * the sessions are left at the last shape. Other strategies need nothing.
+ * The session mode applies to every session of net, so pass all serving sessions of net in one call,
+ * before any of them serves: a session not passed here is fixed without having been traced, and a later
+ * prepare on the same net switches the sessions already serving back to RESIZE_CHECK.
+ * @return the first failed run, MNN_NO_ERROR otherwise.
+ */
+MNN_C_API MNN_ErrorCode MNN_ResizeStrategy_prepareAll(struct MNN_Interpreter* net, struct MNN_Session* const* sessions,
+                                                      int sessionCount, MNN_ResizeStrategy strategy, const char* input,
+                                                      const MNN_ResizeShape* shapes, int shapeCount);
+/**
+ * @brief MNN_ResizeStrategy_prepareAll for a single session; only valid when it is the only session of net.
+ */
+MNN_C_API MNN_ErrorCode MNN_ResizeStrategy_prepare(struct MNN_Interpreter* net, struct MNN_Session* session,
+                                                   MNN_ResizeStrategy strategy, const char* input,
+                                                   const MNN_ResizeShape* shapes, int shapeCount);
+/**
+ * @brief resize the session after resizeTensor the way the strategy does.
+ */
+MNN_C_API void MNN_ResizeStrategy_resize(struct MNN_Interpreter* net, struct MNN_Session* session,
+                                         MNN_ResizeStrategy strategy);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MNN_ResizeTuner_c_h */
@@ -0,0 +1,440 @@
+//
+//  ResultCache_c.cpp
+//  MNN
+//
+
+#include "ResultCache_c.h"
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+typedef std::chrono::steady_clock Clock;
+
+struct CachedOutput {
+    std::string name;
+    halide_type_t type;
+    MNN_DimensionType dimType;
+    std::vector<int> dims;
+    std::vector<uint8_t> data;
+};
+
+struct CacheEntry {
+    uint64_t key = 0;
+    std::vector<uint8_t> inputs;        // 键的完整内容，命中时逐字节比较，64 位哈希碰撞不会返回别人的结果
+    size_t bytes = 0;
+    Clock::time_point expiry;
+    std::vector<CachedOutput> outputs;
+};
+
+// 正在运行的请求，相同键的后来者等待它完成
+struct Pending {
+    std::mutex lock;
+    std::condition_variable done;
+    bool finished = false;
+    std::shared_ptr<CacheEntry> entry;  // 运行失败时为空
+};
+
+struct Shard {
+    std::mutex lock;
+    std::list<std::shared_ptr<CacheEntry>> lru;     // 表头为最近使用
+    std::unordered_map<uint64_t, std::list<std::shared_ptr<CacheEntry>>::iterator> index;
+    std::unordered_map<uint64_t, std::shared_ptr<Pending>> inflight;
+    size_t bytes = 0;
+    uint64_t evictions = 0;
+    uint64_t expired = 0;
+};
+
+struct MNN_ResultCache {
+    std::vector<std::unique_ptr<Shard>> shards;
+    size_t shardCapacity = 0;
+    uint32_t ttlMs = 0;
+    std::atomic<uint64_t> hits;
+    std::atomic<uint64_t> misses;
+    std::atomic<uint64_t> coalesced;
+
+    MNN_ResultCache() : hits(0), misses(0), coalesced(0) {
+    }
+};
+
+// -------------------------- 哈希 --------------------------
+// XXH64，只用于分片与查找，命中与否由完整的键比较决定
+static const uint64_t kPrime1 = 11400714785074694791ULL;
+static const uint64_t kPrime2 = 14029467366897019727ULL;
+static const uint64_t kPrime3 = 1609587929392839161ULL;
+static const uint64_t kPrime4 = 9650029242287828579ULL;
+static const uint64_t kPrime5 = 2870177450012600261ULL;
+
+static inline uint64_t rotl(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+static inline uint64_t read64(const uint8_t* p) {
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline uint32_t read32(const uint8_t* p) {
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline uint64_t round64(uint64_t acc, uint64_t input) {
+    acc += input * kPrime2;
+    acc = rotl(acc, 31);
+    return acc * kPrime1;
+}
+
+static inline uint64_t mergeRound(uint64_t acc, uint64_t value) {
+    acc ^= round64(0, value);
+    return acc * kPrime1 + kPrime4;
+}
+
+static uint64_t xxh64(const void* data, size_t length, uint64_t seed) {
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    const uint8_t* end = p + length;
+    uint64_t h;
+    if (length >= 32) {
+        uint64_t v1 = seed + kPrime1 + kPrime2;
+        uint64_t v2 = seed + kPrime2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - kPrime1;
+        const uint8_t* limit = end - 32;
+        do {
+            v1 = round64(v1, read64(p));
+            v2 = round64(v2, read64(p + 8));
+            v3 = round64(v3, read64(p + 16));
+            v4 = round64(v4, read64(p + 24));
+            p += 32;
+        } while (p <= limit);
+        h = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+        h = mergeRound(h, v1);
+        h = mergeRound(h, v2);
+        h = mergeRound(h, v3);
+        h = mergeRound(h, v4);
+    } else {
+        h = seed + kPrime5;
+    }
+    h += (uint64_t)length;
+    while (p + 8 <= end) {
+        h ^= round64(0, read64(p));
+        h = rotl(h, 27) * kPrime1 + kPrime4;
+        p += 8;
+    }
+    if (p + 4 <= end) {
+        h ^= (uint64_t)read32(p) * kPrime1;
+        h = rotl(h, 23) * kPrime2 + kPrime3;
+        p += 4;
+    }
+    while (p < end) {
+        h ^= (*p) * kPrime5;
+        h = rotl(h, 11) * kPrime1;
+        ++p;
+    }
+    h ^= h >> 33;
+    h *= kPrime2;
+    h ^= h >> 29;
+    h *= kPrime3;
+    h ^= h >> 32;
+    return h;
+}
+
+// -------------------------- 内部工具 --------------------------
+static void append(std::vector<uint8_t>& out, const void* data, size_t size) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    out.insert(out.end(), bytes, bytes + size);
+}
+
+// 键的内容：调用方的盐、模型标识（uuid 为空时用 Interpreter 指针）、各输入的名字、类型、形状与数据
+static bool keyInputs(MNN_Interpreter* net, MNN_Session* session, uint64_t salt, std::vector<uint8_t>* material,
+                      uint64_t* key) {
+    std::vector<uint8_t>& out = *material;
+    out.clear();
+    append(out, &salt, sizeof(salt));
+    const char* uuid = MNN_Interpreter_uuid(net);
+    if (uuid != nullptr && uuid[0] != '\0') {
+        out.push_back('U');
+        append(out, uuid, strlen(uuid) + 1);
+    } else {
+        out.push_back('P');
+        append(out, &net, sizeof(net));
+    }
+    MNN_NamedTensorList list = MNN_Interpreter_GetSessionInputAll(net, session);
+    bool ok = list.count > 0;
+    for (int i = 0; i < list.count && ok; ++i) {
+        MNN_Tensor* tensor = list.tensors[i].tensor;
+        halide_type_t type;
+        MNN_Tensor_GetHalideType(tensor, &type);
+        int dimCount = 0;
+        int* shape = MNN_Tensor_Shape(tensor, &dimCount);
+        append(out, list.tensors[i].name, strlen(list.tensors[i].name) + 1);
+        out.push_back((uint8_t)type.code);
+        out.push_back(type.bits);
+        out.push_back((uint8_t)dimCount);
+        append(out, shape, sizeof(int) * dimCount);
+        MNN_Tensor_FreeShape(shape);
+        uint32_t size = 0;
+        // CPU 上的非 NC4HW4 输入直接读其内存，其余先拷贝到主机并转换为连续布局
+        const void* host = MNN_Tensor_Host(tensor);
+        if (host != nullptr && MNN_Tensor_GetDimensionType(tensor) != MNN_CAFFE_C4) {
+            size = (uint32_t)MNN_Tensor_Size(tensor);
+            append(out, &size, sizeof(size));
+            append(out, host, size);
+        } else {
+            MNN_Tensor* copy = MNN_Tensor_CreateHostTensorFromDevice(tensor, true);
+            if (copy == nullptr) {
+                ok = false;
+                break;
+            }
+            size = (uint32_t)MNN_Tensor_Size(copy);
+            append(out, &size, sizeof(size));
+            append(out, MNN_Tensor_Host(copy), size);
+            MNN_Tensor_Destroy(copy);
+        }
+    }
+    MNN_NamedTensorList_Free(list);
+    *key = xxh64(out.data(), out.size(), 0);
+    return ok;
+}
+
+static std::shared_ptr<CacheEntry> captureOutputs(MNN_Interpreter* net, MNN_Session* session, uint64_t key,
+                                                  std::vector<uint8_t>&& material) {
+    auto entry = std::make_shared<CacheEntry>();
+    entry->key = key;
+    entry->inputs = std::move(material);
+    entry->bytes = entry->inputs.size();
+    MNN_NamedTensorList list = MNN_Interpreter_GetSessionOutputAll(net, session);
+    entry->outputs.resize(list.count);
+    for (int i = 0; i < list.count; ++i) {
+        MNN_Tensor* host = MNN_Tensor_CreateHostTensorFromDevice(list.tensors[i].tensor, true);
+        if (host == nullptr) {
+            entry = nullptr;
+            break;
+        }
+        CachedOutput& output = entry->outputs[i];
+        output.name = list.tensors[i].name;
+        MNN_Tensor_GetHalideType(host, &output.type);
+        output.dimType = MNN_Tensor_GetDimensionType(host);
+        int dimCount = 0;
+        int* shape = MNN_Tensor_Shape(host, &dimCount);
+        output.dims.assign(shape, shape + dimCount);
+        MNN_Tensor_FreeShape(shape);
+        const uint8_t* data = static_cast<const uint8_t*>(MNN_Tensor_Host(host));
+        output.data.assign(data, data + MNN_Tensor_Size(host));
+        entry->bytes += output.data.size() + output.name.size() + output.dims.size() * sizeof(int) + sizeof(CachedOutput);
+        MNN_Tensor_Destroy(host);
+    }
+    MNN_NamedTensorList_Free(list);
+    if (entry != nullptr && entry->outputs.empty()) {
+        return nullptr;
+    }
+    return entry;
+}
+
+static bool restoreOutputs(MNN_Interpreter* net, MNN_Session* session, const CacheEntry& entry) {
+    for (const CachedOutput& output : entry.outputs) {
+        MNN_Tensor* tensor = MNN_Interpreter_getSessionOutput(net, session, output.name.c_str());
+        if (tensor == nullptr) {
+            return false;
+        }
+        MNN_Tensor* host = MNN_Tensor_CreateHost(output.dims.data(), (int)output.dims.size(), output.type,
+                                                 const_cast<uint8_t*>(output.data.data()), output.dimType);
+        if (host == nullptr) {
+            return false;
+        }
+        bool ok = MNN_Tensor_CopyFromHostTensor(tensor, host);
+        MNN_Tensor_Destroy(host);
+        if (!ok) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// 调用方持有 shard->lock
+static void eraseLocked(Shard* shard, std::list<std::shared_ptr<CacheEntry>>::iterator iter) {
+    shard->bytes -= (*iter)->bytes;
+    shard->index.erase((*iter)->key);
+    shard->lru.erase(iter);
+}
+
+// 调用方持有 shard->lock
+static std::shared_ptr<CacheEntry> lookupLocked(MNN_ResultCache* cache, Shard* shard, uint64_t key,
+                                                const std::vector<uint8_t>& material) {
+    auto found = shard->index.find(key);
+    if (found == shard->index.end()) {
+        return nullptr;
+    }
+    auto iter = found->second;
+    if (cache->ttlMs > 0 && Clock::now() >= (*iter)->expiry) {
+        eraseLocked(shard, iter);
+        shard->expired += 1;
+        return nullptr;
+    }
+    // 哈希碰撞按未命中处理，运行后的结果会替换该条目
+    if ((*iter)->inputs != material) {
+        return nullptr;
+    }
+    shard->lru.splice(shard->lru.begin(), shard->lru, iter);
+    return *iter;
+}
+
+// 调用方持有 shard->lock
+static void insertLocked(MNN_ResultCache* cache, Shard* shard, const std::shared_ptr<CacheEntry>& entry) {
+    if (entry->bytes > cache->shardCapacity) {
+        return;
+    }
+    auto found = shard->index.find(entry->key);
+    if (found != shard->index.end()) {
+        eraseLocked(shard, found->second);
+    }
+    entry->expiry = Clock::now() + std::chrono::milliseconds(cache->ttlMs);
+    shard->lru.push_front(entry);
+    shard->index[entry->key] = shard->lru.begin();
+    shard->bytes += entry->bytes;
+    while (shard->bytes > cache->shardCapacity) {
+        eraseLocked(shard, std::prev(shard->lru.end()));
+        shard->evictions += 1;
+    }
+}
+
+// -------------------------- 接口实现 --------------------------
+struct MNN_ResultCache* MNN_ResultCache_create(const MNN_ResultCacheConfig* config) {
+    size_t capacity = config != nullptr && config->capacityBytes > 0 ? config->capacityBytes : (size_t)64 << 20;
+    int shards = config != nullptr && config->shards > 0 ? config->shards : 16;
+    auto cache = new MNN_ResultCache();
+    for (int i = 0; i < shards; ++i) {
+        cache->shards.emplace_back(new Shard());
+    }
+    cache->shardCapacity = capacity / shards;
+    cache->ttlMs = config != nullptr ? config->ttlMs : 0;
+    return cache;
+}
+
+void MNN_ResultCache_destroy(struct MNN_ResultCache* cache) {
+    delete cache;
+}
+
+MNN_ErrorCode MNN_ResultCache_run(struct MNN_ResultCache* cache, struct MNN_Interpreter* net,
+                                  struct MNN_Session* session, MNN_BOOL* hit) {
+    return MNN_ResultCache_runSalted(cache, net, session, 0, hit);
+}
+
+MNN_ErrorCode MNN_ResultCache_runSalted(struct MNN_ResultCache* cache, struct MNN_Interpreter* net,
+                                        struct MNN_Session* session, uint64_t salt, MNN_BOOL* hit) {
+    if (hit != nullptr) {
+        *hit = false;
+    }
+    if (cache == nullptr || net == nullptr || session == nullptr) {
+        return MNN_INVALID_VALUE;
+    }
+    uint64_t key = 0;
+    std::vector<uint8_t> material;
+    if (!keyInputs(net, session, salt, &material, &key)) {
+        cache->misses.fetch_add(1, std::memory_order_relaxed);
+        return MNN_Interpreter_runSession(net, session);
+    }
+    Shard* shard = cache->shards[(key >> 40) % cache->shards.size()].get();
+
+    std::shared_ptr<Pending> pending;
+    bool leader = false;
+    {
+        std::unique_lock<std::mutex> guard(shard->lock);
+        std::shared_ptr<CacheEntry> entry = lookupLocked(cache, shard, key, material);
+        if (entry != nullptr) {
+            // 拷贝在锁外进行，entry 由 shared_ptr 保活
+            guard.unlock();
+            if (restoreOutputs(net, session, *entry)) {
+                cache->hits.fetch_add(1, std::memory_order_relaxed);
+                if (hit != nullptr) {
+                    *hit = true;
+                }
+                return MNN_NO_ERROR;
+            }
+            guard.lock();
+        }
+        auto found = shard->inflight.find(key);
+        if (found != shard->inflight.end()) {
+            pending = found->second;
+        } else {
+            pending = std::make_shared<Pending>();
+            shard->inflight[key] = pending;
+            leader = true;
+        }
+    }
+
+    if (!leader) {
+        std::shared_ptr<CacheEntry> entry;
+        {
+            std::unique_lock<std::mutex> guard(pending->lock);
+            pending->done.wait(guard, [&pending]() { return pending->finished; });
+            entry = pending->entry;
+        }
+        if (entry != nullptr && entry->inputs == material && restoreOutputs(net, session, *entry)) {
+            cache->coalesced.fetch_add(1, std::memory_order_relaxed);
+            if (hit != nullptr) {
+                *hit = true;
+            }
+            return MNN_NO_ERROR;
+        }
+        // 领头的请求失败、键碰撞或输出不兼容时自己运行
+        cache->misses.fetch_add(1, std::memory_order_relaxed);
+        return MNN_Interpreter_runSession(net, session);
+    }
+
+    cache->misses.fetch_add(1, std::memory_order_relaxed);
+    MNN_ErrorCode code = MNN_Interpreter_runSession(net, session);
+    std::shared_ptr<CacheEntry> entry = code == MNN_NO_ERROR ? captureOutputs(net, session, key, std::move(material)) : nullptr;
+    {
+        std::lock_guard<std::mutex> guard(shard->lock);
+        shard->inflight.erase(key);
+        if (entry != nullptr) {
+            insertLocked(cache, shard, entry);
+        }
+    }
+    {
+        std::lock_guard<std::mutex> guard(pending->lock);
+        pending->entry = entry;
+        pending->finished = true;
+    }
+    pending->done.notify_all();
+    return code;
+}
+
+void MNN_ResultCache_clear(struct MNN_ResultCache* cache) {
+    if (cache == nullptr) {
+        return;
+    }
+    for (auto& shard : cache->shards) {
+        std::lock_guard<std::mutex> guard(shard->lock);
+        shard->lru.clear();
+        shard->index.clear();
+        shard->bytes = 0;
+    }
+}
+
+void MNN_ResultCache_getStats(struct MNN_ResultCache* cache, MNN_ResultCacheStats* stats) {
+    if (cache == nullptr || stats == nullptr) {
+        return;
+    }
+    memset(stats, 0, sizeof(*stats));
+    stats->hits = cache->hits.load(std::memory_order_relaxed);
+    stats->misses = cache->misses.load(std::memory_order_relaxed);
+    stats->coalesced = cache->coalesced.load(std::memory_order_relaxed);
+    for (auto& shard : cache->shards) {
+        std::lock_guard<std::mutex> guard(shard->lock);
+        stats->evictions += shard->evictions;
+        stats->expired += shard->expired;
+        stats->bytes += shard->bytes;
+        stats->entries += shard->lru.size();
+    }
+}
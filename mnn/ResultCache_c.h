@@ -0,0 +1,72 @@
+//
+//  ResultCache_c.h
+//  MNN
+//
+//  推理结果缓存：以调用方的盐、模型 uuid()（为空时用 Interpreter 指针）与全部输入张量的名字、类型、形状、数据为键，
+//  按其 64 位哈希查找并逐字节比较完整的键，命中时直接把缓存的输出拷回 Session 的输出张量，跳过 runSession；
+//  分片 LRU，按字节数限容，支持 TTL；并发的相同请求只运行一次，其余等待结果
+//
+
+#ifndef MNN_ResultCache_c_h
+#define MNN_ResultCache_c_h
+
+#include <stdint.h>
+#include "Interpreter_c.h"
+
+// 导出宏：Windows下导出，其他平台兼容
+#ifdef MNN_C_EXPORTS
+    // 仅当编译 libmnn.dll 时定义 MNN_C_EXPORTS，此时用 dllexport
+    #define MNN_C_API __declspec(dllexport)
+#else
+    #define MNN_C_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct MNN_ResultCache MNN_ResultCache;
+
+typedef struct MNN_ResultCacheConfig {
+    size_t capacityBytes;   // 所有分片输出数据的总上限，0 表示 64MB；单条超过分片容量的结果不缓存
+    int shards;             // 分片数，0 表示 16
+    uint32_t ttlMs;         // 条目存活时间，0 表示不过期
+} MNN_ResultCacheConfig;
+
+typedef struct MNN_ResultCacheStats {
+    uint64_t hits;
+    uint64_t misses;        // 实际执行了 runSession 的次数
+    uint64_t coalesced;     // 等待并发的相同请求而未执行的次数
+    uint64_t evictions;
+    uint64_t expired;
+    size_t bytes;
+    size_t entries;
+} MNN_ResultCacheStats;
+
+MNN_C_API struct MNN_ResultCache* MNN_ResultCache_create(const MNN_ResultCacheConfig* config);
+MNN_C_API void MNN_ResultCache_destroy(struct MNN_ResultCache* cache);
+/**
+ * @brief run session through the cache. Inputs must already be filled; on return the session's
+ * outputs hold the result whether it came from the cache, a concurrent identical run or runSession.
+ * One cache may serve many interpreters: the model uuid is part of the key, or the interpreter itself
+ * when the model has no uuid. A hit compares the stored inputs byte by byte, not just their hash.
+ * Equivalent to MNN_ResultCache_runSalted with salt 0.
+ * @param hit optional, set when runSession was skipped.
+ */
+MNN_C_API MNN_ErrorCode MNN_ResultCache_run(struct MNN_ResultCache* cache, struct MNN_Interpreter* net,
+                                            struct MNN_Session* session, MNN_BOOL* hit);
+/**
+ * @brief like MNN_ResultCache_run, with salt as part of the key. Sessions of one model whose outputs
+ * may differ for the same inputs (precision, backend, ...) must use different salts; sessions that
+ * share a salt share results.
+ */
+MNN_C_API MNN_ErrorCode MNN_ResultCache_runSalted(struct MNN_ResultCache* cache, struct MNN_Interpreter* net,
+                                                  struct MNN_Session* session, uint64_t salt, MNN_BOOL* hit);
+MNN_C_API void MNN_ResultCache_clear(struct MNN_ResultCache* cache);
+MNN_C_API void MNN_ResultCache_getStats(struct MNN_ResultCache* cache, MNN_ResultCacheStats* stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MNN_ResultCache_c_h */
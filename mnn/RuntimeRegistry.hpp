@@ -0,0 +1,31 @@
+//
+//  RuntimeRegistry.hpp
+//  MNN
+//
+//  RuntimeRegistry_c 的内部登记接口，供 Interpreter_c 在 Session 随 Interpreter 释放时退还线程预算
+//
+
+#ifndef MNN_RuntimeRegistry_hpp
+#define MNN_RuntimeRegistry_hpp
+
+#include <atomic>
+#include <vector>
+#include "RuntimeRegistry_c.h"
+
+namespace RuntimeRegistry {
+
+// 经共享运行时创建且尚未释放的 Session 数，为 0 时释放路径只多一次原子读
+extern std::atomic<int> gTracked;
+
+inline bool active() {
+    return gTracked.load(std::memory_order_relaxed) > 0;
+}
+
+// 摘下 (net, session) 的登记，session 为空时摘下 net 的全部登记；返回的运行时须在 MNN 释放 Session 后交给 drop
+std::vector<MNN_SharedRuntime*> claim(const MNN_Interpreter* net, const MNN_Session* session);
+// 每项退还一个 Session，句柄引用与 Session 都归零的运行时随之退还线程预算并释放
+void drop(const std::vector<MNN_SharedRuntime*>& runtimes);
+
+} // namespace RuntimeRegistry
+
+#endif /* MNN_RuntimeRegistry_hpp */
@@ -0,0 +1,305 @@
+//
+//  RuntimeRegistry_c.cpp
+//  MNN
+//
+
+#include "RuntimeRegistry_c.h"
+#include "RuntimeRegistry.hpp"
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+struct MNN_RuntimeRegistry;
+
+struct MNN_SharedRuntime {
+    MNN_RuntimeRegistry* registry = nullptr;
+    std::string name;
+    MNN_RuntimeInfo* info = nullptr;
+    MNNForwardType type = MNN_FORWARD_CPU;
+    int numThread = 1;
+    int charged = 0;        // 计入全局预算的线程数
+    int references = 0;     // 受 registry->lock 保护
+    int sessions = 0;       // 经本句柄创建且仍在 gSessions 中登记的 Session 数，受 registry->lock 保护
+    // 共享同一运行时的 Session 不能并发执行，创建/resize/运行都在此锁下串行
+    std::mutex runLock;
+};
+
+struct MNN_RuntimeRegistry {
+    std::mutex lock;
+    std::map<std::string, MNN_SharedRuntime*> runtimes;
+    int threadBudget = 0;
+    int threadsInUse = 0;
+    // 所有者持有 1，每个存活运行时再持有 1，归零时释放，保证先 destroy 注册表后 release 句柄也安全
+    int holders = 1;
+};
+
+// -------------------------- 内部工具 --------------------------
+typedef std::pair<const MNN_Interpreter*, const MNN_Session*> SessionKey;
+
+// 进程内所有经共享运行时创建的 Session 到其运行时的登记。不论 Session 经哪条路径释放（含随 Interpreter 销毁），
+// 都由摘下登记的一方退还一次，保证每个 Session 恰好退还一次
+static std::mutex gSessionLock;
+static std::map<SessionKey, MNN_SharedRuntime*> gSessions;
+
+std::atomic<int> RuntimeRegistry::gTracked(0);
+
+// 只有 CPU 后端（AUTO 在无其他后端时也会退化为 CPU）按 numThread 占用线程，其余后端只占一个宿主线程
+static int requestedThreads(const struct MNN_ScheduleConfig* config) {
+    if (config->type_ == MNN_FORWARD_CPU || config->type_ == MNN_FORWARD_AUTO) {
+        return config->numThread > 1 ? config->numThread : 1;
+    }
+    return 1;
+}
+
+static void setError(MNN_ErrorCode* error, MNN_ErrorCode code) {
+    if (error != nullptr) {
+        *error = code;
+    }
+}
+
+// 调用方持有 registry->lock，返回 true 表示注册表已无持有者，需在解锁后释放
+static bool dropHolderLocked(MNN_RuntimeRegistry* registry) {
+    registry->holders -= 1;
+    return registry->holders == 0;
+}
+
+// 调用方持有 registry->lock。句柄引用与 Session 都归零（Session 仍持有 MNN 的线程池）时才退还线程预算，
+// 返回 true 表示运行时需在解锁后释放；releaseRegistry 表示注册表也已无持有者
+static bool retireLocked(MNN_SharedRuntime* runtime, bool* releaseRegistry) {
+    if (runtime->references > 0 || runtime->sessions > 0) {
+        return false;
+    }
+    MNN_RuntimeRegistry* registry = runtime->registry;
+    registry->runtimes.erase(runtime->name);
+    registry->threadsInUse -= runtime->charged;
+    *releaseRegistry = dropHolderLocked(registry);
+    return true;
+}
+
+static void freeRuntime(MNN_SharedRuntime* runtime, bool releaseRegistry) {
+    MNN_RuntimeRegistry* registry = runtime->registry;
+    MNN_RuntimeInfo_destroy(runtime->info);
+    delete runtime;
+    if (releaseRegistry) {
+        delete registry;
+    }
+}
+
+static void dropSession(MNN_SharedRuntime* runtime) {
+    MNN_RuntimeRegistry* registry = runtime->registry;
+    bool retired = false;
+    bool releaseRegistry = false;
+    {
+        std::lock_guard<std::mutex> guard(registry->lock);
+        runtime->sessions -= 1;
+        retired = retireLocked(runtime, &releaseRegistry);
+    }
+    if (retired) {
+        freeRuntime(runtime, releaseRegistry);
+    }
+}
+
+std::vector<MNN_SharedRuntime*> RuntimeRegistry::claim(const MNN_Interpreter* net, const MNN_Session* session) {
+    std::vector<MNN_SharedRuntime*> claimed;
+    std::lock_guard<std::mutex> guard(gSessionLock);
+    if (session != nullptr) {
+        auto iter = gSessions.find(SessionKey(net, session));
+        if (iter != gSessions.end()) {
+            claimed.push_back(iter->second);
+            gSessions.erase(iter);
+        }
+    } else {
+        auto iter = gSessions.lower_bound(SessionKey(net, nullptr));
+        while (iter != gSessions.end() && iter->first.first == net) {
+            claimed.push_back(iter->second);
+            iter = gSessions.erase(iter);
+        }
+    }
+    gTracked.fetch_sub((int)claimed.size(), std::memory_order_relaxed);
+    return claimed;
+}
+
+void RuntimeRegistry::drop(const std::vector<MNN_SharedRuntime*>& runtimes) {
+    for (auto runtime : runtimes) {
+        dropSession(runtime);
+    }
+}
+
+// -------------------------- 注册表 --------------------------
+struct MNN_RuntimeRegistry* MNN_RuntimeRegistry_create(int threadBudget) {
+    auto registry = new MNN_RuntimeRegistry();
+    if (threadBudget <= 0) {
+        threadBudget = (int)std::thread::hardware_concurrency();
+    }
+    registry->threadBudget = threadBudget > 0 ? threadBudget : 1;
+    return registry;
+}
+
+void MNN_RuntimeRegistry_destroy(struct MNN_RuntimeRegistry* registry) {
+    if (registry == nullptr) {
+        return;
+    }
+    bool last = false;
+    {
+        std::lock_guard<std::mutex> guard(registry->lock);
+        last = dropHolderLocked(registry);
+    }
+    if (last) {
+        delete registry;
+    }
+}
+
+struct MNN_SharedRuntime* MNN_RuntimeRegistry_acquire(struct MNN_RuntimeRegistry* registry, const char* name,
+                                                      const struct MNN_ScheduleConfig* config, MNN_ErrorCode* error) {
+    if (registry == nullptr || name == nullptr || config == nullptr) {
+        setError(error, MNN_INVALID_VALUE);
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> guard(registry->lock);
+    auto iter = registry->runtimes.find(name);
+    if (iter != registry->runtimes.end()) {
+        iter->second->references += 1;
+        setError(error, MNN_NO_ERROR);
+        return iter->second;
+    }
+
+    const int left = registry->threadBudget - registry->threadsInUse;
+    if (left <= 0) {
+        setError(error, MNN_RESOURCE_EXHAUSTED);
+        return nullptr;
+    }
+    int charged = requestedThreads(config);
+    if (charged > left) {
+        charged = left;
+    }
+    struct MNN_ScheduleConfig runtimeConfig = *config;
+    if (config->type_ == MNN_FORWARD_CPU || config->type_ == MNN_FORWARD_AUTO) {
+        runtimeConfig.numThread = charged;
+    }
+    // 创建运行时会初始化线程池，但只在首次获取时发生，持锁创建可避免同名运行时被重复创建
+    MNN_RuntimeInfo* info = MNN_Interpreter_createRuntime(&runtimeConfig, 1);
+    if (info == nullptr) {
+        setError(error, MNN_NOT_SUPPORT);
+        return nullptr;
+    }
+
+    auto runtime = new MNN_SharedRuntime();
+    runtime->registry = registry;
+    runtime->name = name;
+    runtime->info = info;
+    runtime->type = runtimeConfig.type_;
+    runtime->numThread = runtimeConfig.numThread;
+    runtime->charged = charged;
+    runtime->references = 1;
+    registry->runtimes[runtime->name] = runtime;
+    registry->threadsInUse += charged;
+    registry->holders += 1;
+    setError(error, MNN_NO_ERROR);
+    return runtime;
+}
+
+void MNN_RuntimeRegistry_getStats(struct MNN_RuntimeRegistry* registry, MNN_RuntimeRegistryStats* stats) {
+    if (registry == nullptr || stats == nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> guard(registry->lock);
+    stats->threadBudget = registry->threadBudget;
+    stats->threadsInUse = registry->threadsInUse;
+    stats->runtimeCount = (int)registry->runtimes.size();
+    int references = 0;
+    for (auto& iter : registry->runtimes) {
+        references += iter.second->references;
+    }
+    stats->references = references;
+}
+
+// -------------------------- 共享运行时 --------------------------
+void MNN_SharedRuntime_release(struct MNN_SharedRuntime* runtime) {
+    if (runtime == nullptr) {
+        return;
+    }
+    MNN_RuntimeRegistry* registry = runtime->registry;
+    bool retired = false;
+    bool releaseRegistry = false;
+    {
+        std::lock_guard<std::mutex> guard(registry->lock);
+        runtime->references -= 1;
+        retired = retireLocked(runtime, &releaseRegistry);
+    }
+    if (retired) {
+        freeRuntime(runtime, releaseRegistry);
+    }
+}
+
+const char* MNN_SharedRuntime_name(const struct MNN_SharedRuntime* runtime) {
+    return runtime == nullptr ? nullptr : runtime->name.c_str();
+}
+
+int MNN_SharedRuntime_numThread(const struct MNN_SharedRuntime* runtime) {
+    return runtime == nullptr ? 0 : runtime->numThread;
+}
+
+const MNN_RuntimeInfo* MNN_SharedRuntime_info(const struct MNN_SharedRuntime* runtime) {
+    return runtime == nullptr ? nullptr : runtime->info;
+}
+
+struct MNN_Session* MNN_SharedRuntime_createSession(struct MNN_SharedRuntime* runtime, struct MNN_Interpreter* net,
+                                                    const struct MNN_ScheduleConfig* config) {
+    if (runtime == nullptr || net == nullptr || config == nullptr) {
+        return nullptr;
+    }
+    struct MNN_ScheduleConfig sessionConfig = *config;
+    sessionConfig.type_ = runtime->type;
+    sessionConfig.numThread = runtime->numThread;
+    MNN_Session* session = nullptr;
+    {
+        std::lock_guard<std::mutex> guard(runtime->runLock);
+        session = MNN_Interpreter_createSessionWithRuntime(net, &sessionConfig, runtime->info);
+    }
+    if (session != nullptr) {
+        {
+            std::lock_guard<std::mutex> guard(runtime->registry->lock);
+            runtime->sessions += 1;
+        }
+        std::lock_guard<std::mutex> guard(gSessionLock);
+        gSessions[SessionKey(net, session)] = runtime;
+        RuntimeRegistry::gTracked.fetch_add(1, std::memory_order_relaxed);
+    }
+    return session;
+}
+
+MNN_ErrorCode MNN_SharedRuntime_runSession(struct MNN_SharedRuntime* runtime, const struct MNN_Interpreter* net,
+                                           struct MNN_Session* session) {
+    if (runtime == nullptr || net == nullptr || session == nullptr) {
+        return MNN_INVALID_VALUE;
+    }
+    std::lock_guard<std::mutex> guard(runtime->runLock);
+    return MNN_Interpreter_runSession(net, session);
+}
+
+void MNN_SharedRuntime_resizeSession(struct MNN_SharedRuntime* runtime, struct MNN_Interpreter* net,
+                                     struct MNN_Session* session) {
+    if (runtime == nullptr || net == nullptr || session == nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> guard(runtime->runLock);
+    MNN_Interpreter_resizeSession(net, session);
+}
+
+MNN_BOOL MNN_SharedRuntime_releaseSession(struct MNN_SharedRuntime* runtime, struct MNN_Interpreter* net,
+                                          struct MNN_Session* session) {
+    if (runtime == nullptr || net == nullptr || session == nullptr) {
+        return 0;
+    }
+    // 先摘下登记，MNN_Interpreter_releaseSession 便不会重复退还；运行时可能在退还后被释放，须在 runLock 外退还
+    auto claimed = RuntimeRegistry::claim(net, session);
+    MNN_BOOL released = 0;
+    {
+        std::lock_guard<std::mutex> guard(runtime->runLock);
+        released = MNN_Interpreter_releaseSession(net, session);
+    }
+    RuntimeRegistry::drop(claimed);
+    return released;
+}
@@ -0,0 +1,96 @@
+//
+//  RuntimeRegistry_c.h
+//  MNN
+//
+//  多模型共享运行时注册表：
+//  不同模型的 Interpreter 按名字挂到同一个 MNN_RuntimeInfo 上，共用线程池，
+//  所有运行时的 CPU 线程数之和受全局线程预算约束，运行时按引用计数释放
+//
+
+#ifndef MNN_RuntimeRegistry_c_h
+#define MNN_RuntimeRegistry_c_h
+
+#include "Interpreter_c.h"
+
+// 导出宏：Windows下导出，其他平台兼容
+#ifdef MNN_C_EXPORTS
+    // 仅当编译 libmnn.dll 时定义 MNN_C_EXPORTS，此时用 dllexport
+    #define MNN_C_API __declspec(dllexport)
+#else
+    #define MNN_C_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct MNN_RuntimeRegistry;
+// 注册表中的一个命名运行时（引用计数句柄）
+struct MNN_SharedRuntime;
+
+typedef struct MNN_RuntimeRegistryStats {
+    int threadBudget;       // 全局线程预算
+    int threadsInUse;       // 已分配给存活运行时的线程数
+    int runtimeCount;       // 存活运行时个数
+    int references;         // 所有运行时的引用总数
+} MNN_RuntimeRegistryStats;
+
+/**
+ * @brief create a registry.
+ * @param threadBudget total CPU threads all runtimes may use, <= 0 means the number of online cores.
+ */
+MNN_C_API struct MNN_RuntimeRegistry* MNN_RuntimeRegistry_create(int threadBudget);
+/**
+ * @brief destroy the registry. Handles still held by callers stay valid until released.
+ */
+MNN_C_API void MNN_RuntimeRegistry_destroy(struct MNN_RuntimeRegistry* registry);
+
+/**
+ * @brief get the runtime registered under name, creating it from config on first use.
+ * The first caller's config decides the backend and thread count; later callers share it as-is.
+ * A CPU runtime is charged config->numThread threads (other backends one host thread).
+ * If the budget cannot cover the request the thread count is reduced to what is left;
+ * with nothing left MNN_RESOURCE_EXHAUSTED is reported and NULL returned.
+ * @param error optional, receives the error code.
+ * @return a handle holding one reference, release with MNN_SharedRuntime_release.
+ */
+MNN_C_API struct MNN_SharedRuntime* MNN_RuntimeRegistry_acquire(struct MNN_RuntimeRegistry* registry, const char* name,
+                                                                const struct MNN_ScheduleConfig* config, MNN_ErrorCode* error);
+MNN_C_API void MNN_RuntimeRegistry_getStats(struct MNN_RuntimeRegistry* registry, MNN_RuntimeRegistryStats* stats);
+
+/**
+ * @brief drop one reference. Sessions created through the handle keep MNN's thread pool alive, so the
+ * runtime and its thread budget are only freed once the last reference is dropped and the last of those
+ * sessions is released (by any release call or with its interpreter); until then the handle stays valid for that
+ * call and a new acquire under the same name shares the runtime again.
+ */
+MNN_C_API void MNN_SharedRuntime_release(struct MNN_SharedRuntime* runtime);
+MNN_C_API const char* MNN_SharedRuntime_name(const struct MNN_SharedRuntime* runtime);
+MNN_C_API int MNN_SharedRuntime_numThread(const struct MNN_SharedRuntime* runtime);
+MNN_C_API const MNN_RuntimeInfo* MNN_SharedRuntime_info(const struct MNN_SharedRuntime* runtime);
+
+/**
+ * @brief create a session of net on the shared runtime. config->numThread and type_ are taken from the runtime.
+ */
+MNN_C_API struct MNN_Session* MNN_SharedRuntime_createSession(struct MNN_SharedRuntime* runtime, struct MNN_Interpreter* net,
+                                                              const struct MNN_ScheduleConfig* config);
+/**
+ * @brief run a session created on this runtime. Sessions sharing one MNN runtime must not run concurrently,
+ * so runs (and session creation/resize through this handle) are serialized per runtime.
+ */
+MNN_C_API MNN_ErrorCode MNN_SharedRuntime_runSession(struct MNN_SharedRuntime* runtime, const struct MNN_Interpreter* net,
+                                                     struct MNN_Session* session);
+MNN_C_API void MNN_SharedRuntime_resizeSession(struct MNN_SharedRuntime* runtime, struct MNN_Interpreter* net,
+                                               struct MNN_Session* session);
+/**
+ * @brief release a session created through this handle, serialized with its runs. Sessions released with
+ * MNN_Interpreter_releaseSession or freed with their interpreter are refunded to the thread budget as well.
+ */
+MNN_C_API MNN_BOOL MNN_SharedRuntime_releaseSession(struct MNN_SharedRuntime* runtime, struct MNN_Interpreter* net,
+                                                    struct MNN_Session* session);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MNN_RuntimeRegistry_c_h */
@@ -0,0 +1,98 @@
+//
+//  ScheduleConfigCopy.hpp
+//  MNN
+//
+//  MNN_ScheduleConfig 的深拷贝：调用方传入的字符串数组与 backendConfig 只在调用期间有效，
+//  需要在之后重新创建 Session（重载、重建）的模块用它保存一份自有的配置
+//
+
+#ifndef MNN_ScheduleConfigCopy_hpp
+#define MNN_ScheduleConfigCopy_hpp
+
+#include <string.h>
+#include <string>
+#include <vector>
+#include "Interpreter_c.h"
+
+class ScheduleConfigCopy {
+public:
+    ScheduleConfigCopy() {
+        memset(&mConfig, 0, sizeof(mConfig));
+        mConfig.type_ = MNN_FORWARD_CPU;
+        mConfig.numThread = 4;
+        mConfig.backupType = MNN_FORWARD_CPU;
+    }
+    explicit ScheduleConfigCopy(const struct MNN_ScheduleConfig& config) {
+        assign(config);
+    }
+    ScheduleConfigCopy(const ScheduleConfigCopy& other) {
+        assign(other.mConfig);
+    }
+    ScheduleConfigCopy& operator=(const ScheduleConfigCopy& other) {
+        if (this != &other) {
+            assign(other.mConfig);
+        }
+        return *this;
+    }
+
+    void assign(const struct MNN_ScheduleConfig& config) {
+        mConfig = config;
+        copyStrings(config.saveTensors, mSaveTensors, mSaveTensorPtrs, mConfig.saveTensors);
+        copyStrings(config.path.inputs, mInputs, mInputPtrs, mConfig.path.inputs);
+        copyStrings(config.path.outputs, mOutputs, mOutputPtrs, mConfig.path.outputs);
+        if (config.backendConfig != nullptr) {
+            mBackendConfig = *config.backendConfig;
+            mConfig.backendConfig = &mBackendConfig;
+        } else {
+            mConfig.backendConfig = nullptr;
+        }
+    }
+
+    // 追加一个需要保留的中间张量，已存在时忽略
+    void addSaveTensor(const char* name) {
+        for (auto& item : mSaveTensors) {
+            if (item == name) {
+                return;
+            }
+        }
+        mSaveTensors.emplace_back(name);
+        mSaveTensorPtrs.clear();
+        for (auto& item : mSaveTensors) {
+            mSaveTensorPtrs.push_back(item.c_str());
+        }
+        mConfig.saveTensors.data = mSaveTensorPtrs.data();
+        mConfig.saveTensors.size = mSaveTensorPtrs.size();
+    }
+
+    // 返回的指针在本对象下一次 assign 或析构前有效
+    const struct MNN_ScheduleConfig* get() const {
+        return &mConfig;
+    }
+    struct MNN_ScheduleConfig* get() {
+        return &mConfig;
+    }
+
+private:
+    static void copyStrings(const StringArray& source, std::vector<std::string>& storage,
+                            std::vector<const char*>& pointers, StringArray& target) {
+        storage.clear();
+        pointers.clear();
+        for (size_t i = 0; source.data != nullptr && i < source.size; ++i) {
+            if (source.data[i] != nullptr) {
+                storage.emplace_back(source.data[i]);
+            }
+        }
+        for (auto& item : storage) {
+            pointers.push_back(item.c_str());
+        }
+        target.data = pointers.empty() ? nullptr : pointers.data();
+        target.size = pointers.size();
+    }
+
+    struct MNN_ScheduleConfig mConfig;
+    struct MNN_BackendConfig mBackendConfig;
+    std::vector<std::string> mSaveTensors, mInputs, mOutputs;
+    std::vector<const char*> mSaveTensorPtrs, mInputPtrs, mOutputPtrs;
+};
+
+#endif /* MNN_ScheduleConfigCopy_hpp */
@@ -0,0 +1,475 @@
+//
+//  Scheduler_c.cpp
+//  MNN
+//
+
+#include "Scheduler_c.h"
+#include "Tensor_c.h"
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <vector>
+
+struct SchedulerSlot {
+    // MNN 对同一 Interpreter 的运行加锁串行，每个 Session 在各自的 Interpreter 上：
+    // 第一个用调用方的 net，其余各持有一个副本
+    MNN_Interpreter* net = nullptr;
+    MNN_Session* session = nullptr;
+    bool busy = false;
+    // 已分配但等待方还没换成租约时为空
+    MNN_SchedulerLease* holder = nullptr;
+    // 分配时预扣的虚拟时间
+    double charged = 0.0;
+};
+
+struct SchedulerWaiter {
+    int cls = 0;
+    std::condition_variable cv;
+    SchedulerSlot* slot = nullptr;
+};
+
+struct SchedulerClassState {
+    float weight = 1.0f;
+    bool preemptible = false;
+    std::deque<SchedulerWaiter*> queue;
+    int holding = 0;
+    // 虚拟时间：累计占用时长 / 权重，最小者优先
+    double pass = 0.0;
+    // 分配时先按平均占用时长预扣，释放时按实际时长修正，避免一次性把空闲 Session 全分给同一类
+    double meanHoldNs = 1e6;
+    uint64_t granted = 0;
+    uint64_t preempted = 0;
+    uint64_t timeouts = 0;
+    double totalWaitNs = 0.0;
+    double maxWaitNs = 0.0;
+};
+
+struct MNN_Scheduler {
+    MNN_Interpreter* net = nullptr;
+    MNN_SchedulerConfig config;
+    std::vector<SchedulerSlot> slots;
+    std::vector<SchedulerClassState> classes;
+    std::mutex lock;
+    int preemptsInFlight = 0;
+};
+
+struct MNN_SchedulerLease {
+    MNN_Scheduler* scheduler = nullptr;
+    int cls = 0;
+    SchedulerSlot* slot = nullptr;
+    MNN_CancelToken* token = nullptr;
+    std::chrono::steady_clock::time_point grantedAt;
+    std::chrono::steady_clock::time_point runStart;
+    bool running = false;
+    bool preemptRequested = false;
+};
+
+struct SavedInput {
+    std::string name;
+    MNN_Tensor* host = nullptr;
+};
+
+// -------------------------- 内部工具 --------------------------
+static double elapsedNs(std::chrono::steady_clock::time_point since) {
+    return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - since).count();
+}
+
+static bool eligible(MNN_Scheduler* s, int cls) {
+    if (s->classes[cls].queue.empty()) {
+        return false;
+    }
+    if (cls == 0) {
+        return true;
+    }
+    int nonHigh = 0;
+    for (size_t i = 1; i < s->classes.size(); ++i) {
+        nonHigh += s->classes[i].holding;
+    }
+    return nonHigh < (int)s->slots.size() - s->config.reservedHigh;
+}
+
+static SchedulerSlot* freeSlot(MNN_Scheduler* s) {
+    for (auto& slot : s->slots) {
+        if (!slot.busy) {
+            return &slot;
+        }
+    }
+    return nullptr;
+}
+
+// 空闲后重新变为活跃的类从当前最小虚拟时间起步，不能用闲置期间“攒下”的份额
+static void activate(MNN_Scheduler* s, int cls) {
+    SchedulerClassState& state = s->classes[cls];
+    if (!state.queue.empty() || state.holding > 0) {
+        return;
+    }
+    bool found = false;
+    double minPass = 0.0;
+    for (size_t i = 0; i < s->classes.size(); ++i) {
+        const SchedulerClassState& other = s->classes[i];
+        if ((int)i == cls || (other.queue.empty() && other.holding == 0)) {
+            continue;
+        }
+        if (!found || other.pass < minPass) {
+            minPass = other.pass;
+            found = true;
+        }
+    }
+    if (found) {
+        state.pass = std::max(state.pass, minPass);
+    }
+}
+
+static void grant(MNN_Scheduler* s, int cls, SchedulerSlot* slot) {
+    SchedulerClassState& state = s->classes[cls];
+    SchedulerWaiter* waiter = state.queue.front();
+    state.queue.pop_front();
+    state.holding++;
+    slot->charged = state.meanHoldNs / state.weight;
+    state.pass += slot->charged;
+    slot->busy = true;
+    waiter->slot = slot;
+    waiter->cv.notify_one();
+}
+
+static void dispatchLocked(MNN_Scheduler* s) {
+    for (;;) {
+        SchedulerSlot* slot = freeSlot(s);
+        if (slot == nullptr) {
+            return;
+        }
+        int pick = -1;
+        if (s->config.strictHigh && eligible(s, 0)) {
+            pick = 0;
+        } else {
+            for (int i = 0; i < (int)s->classes.size(); ++i) {
+                if (eligible(s, i) && (pick < 0 || s->classes[i].pass < s->classes[pick].pass)) {
+                    pick = i;
+                }
+            }
+        }
+        if (pick < 0) {
+            return;
+        }
+        grant(s, pick, slot);
+    }
+}
+
+// 类 0 排队数多于已发出的抢占请求时，抢占最近开始运行的可抢占租约，损失的计算最少
+static void preemptLocked(MNN_Scheduler* s) {
+    if (!s->config.preempt || freeSlot(s) != nullptr) {
+        return;
+    }
+    while ((int)s->classes[0].queue.size() > s->preemptsInFlight) {
+        MNN_SchedulerLease* victim = nullptr;
+        for (auto& slot : s->slots) {
+            MNN_SchedulerLease* lease = slot.holder;
+            if (lease == nullptr || lease->slot != &slot || !lease->running || lease->preemptRequested ||
+                !s->classes[lease->cls].preemptible) {
+                continue;
+            }
+            if (victim == nullptr || lease->runStart > victim->runStart) {
+                victim = lease;
+            }
+        }
+        if (victim == nullptr) {
+            return;
+        }
+        victim->preemptRequested = true;
+        s->preemptsInFlight++;
+        MNN_CancelToken_cancel(victim->token);
+    }
+}
+
+static void chargeRelease(MNN_Scheduler* s, MNN_SchedulerLease* lease) {
+    SchedulerClassState& state = s->classes[lease->cls];
+    double held = elapsedNs(lease->grantedAt);
+    state.pass += held / state.weight - lease->slot->charged;
+    state.meanHoldNs = state.meanHoldNs * 0.9 + held * 0.1;
+    state.holding--;
+    lease->slot->busy = false;
+    lease->slot->holder = nullptr;
+    lease->slot = nullptr;
+}
+
+// 等待直到拿到 Session；timeoutUs 为 0 时不超时。调用时持有锁，waiter 已入队
+static SchedulerSlot* waitGranted(MNN_Scheduler* s, std::unique_lock<std::mutex>& guard, SchedulerWaiter& waiter,
+                                  uint64_t timeoutUs) {
+    if (timeoutUs == 0) {
+        waiter.cv.wait(guard, [&]() { return waiter.slot != nullptr; });
+        return waiter.slot;
+    }
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(timeoutUs);
+    if (waiter.cv.wait_until(guard, deadline, [&]() { return waiter.slot != nullptr; })) {
+        return waiter.slot;
+    }
+    auto& queue = s->classes[waiter.cls].queue;
+    queue.erase(std::find(queue.begin(), queue.end(), &waiter));
+    return nullptr;
+}
+
+static void saveInputs(MNN_Interpreter* net, MNN_Session* session, std::vector<SavedInput>& saved) {
+    MNN_NamedTensorList list = MNN_Interpreter_GetSessionInputAll(net, session);
+    for (int i = 0; i < list.count; ++i) {
+        SavedInput input;
+        input.name = list.tensors[i].name;
+        input.host = MNN_Tensor_CreateHostTensorFromDevice(list.tensors[i].tensor, true);
+        saved.push_back(input);
+    }
+    MNN_NamedTensorList_Free(list);
+}
+
+static bool restoreInputs(MNN_Interpreter* net, MNN_Session* session, const std::vector<SavedInput>& saved) {
+    std::vector<MNN_Tensor*> tensors;
+    bool changed = false;
+    for (const auto& input : saved) {
+        MNN_Tensor* tensor = MNN_Interpreter_getSessionInput(net, session, input.name.c_str());
+        if (tensor == nullptr || input.host == nullptr) {
+            return false;
+        }
+        int savedCount = 0, currentCount = 0;
+        int* savedShape = MNN_Tensor_Shape(input.host, &savedCount);
+        int* currentShape = MNN_Tensor_Shape(tensor, &currentCount);
+        bool same = savedShape != nullptr && currentShape != nullptr && savedCount == currentCount &&
+                    std::equal(savedShape, savedShape + savedCount, currentShape);
+        if (!same && savedShape != nullptr) {
+            MNN_Interpreter_resizeTensor(net, tensor, savedShape, savedCount);
+            changed = true;
+        }
+        MNN_Tensor_FreeShape(savedShape);
+        MNN_Tensor_FreeShape(currentShape);
+        tensors.push_back(tensor);
+    }
+    if (changed) {
+        MNN_Interpreter_resizeSession(net, session);
+    }
+    for (size_t i = 0; i < saved.size(); ++i) {
+        if (!MNN_Tensor_CopyFromHostTensor(tensors[i], saved[i].host)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void freeInputs(std::vector<SavedInput>& saved) {
+    for (auto& input : saved) {
+        MNN_Tensor_Destroy(input.host);
+    }
+    saved.clear();
+}
+
+// 被抢占：保存输入，把 Session 直接交给排队的类 0，自己排到本类队首，重新拿到 Session 后恢复输入
+static MNN_ErrorCode yieldAndReacquire(MNN_SchedulerLease* lease, std::unique_lock<std::mutex>& guard) {
+    MNN_Scheduler* s = lease->scheduler;
+    SchedulerSlot* old = lease->slot;
+    guard.unlock();
+    std::vector<SavedInput> saved;
+    saveInputs(old->net, old->session, saved);
+    guard.lock();
+    s->classes[lease->cls].preempted++;
+    s->preemptsInFlight--;
+    activate(s, lease->cls);
+    SchedulerWaiter waiter;
+    waiter.cls = lease->cls;
+    s->classes[lease->cls].queue.push_front(&waiter);
+    chargeRelease(s, lease);
+    if (!s->classes[0].queue.empty()) {
+        grant(s, 0, old);
+    }
+    dispatchLocked(s);
+    SchedulerSlot* slot = waitGranted(s, guard, waiter, 0);
+    slot->holder = lease;
+    lease->slot = slot;
+    lease->grantedAt = std::chrono::steady_clock::now();
+    lease->preemptRequested = false;
+    guard.unlock();
+    bool restored = restoreInputs(slot->net, slot->session, saved);
+    freeInputs(saved);
+    guard.lock();
+    return restored ? MNN_NO_ERROR : MNN_INVALID_VALUE;
+}
+
+// -------------------------- 接口实现 --------------------------
+struct MNN_Scheduler* MNN_Scheduler_create(struct MNN_Interpreter* net, const struct MNN_ScheduleConfig* config,
+                                           const MNN_SchedulerConfig* schedulerConfig) {
+    if (net == nullptr || schedulerConfig == nullptr || schedulerConfig->sessions <= 0 ||
+        schedulerConfig->classCount <= 0 || schedulerConfig->classCount > MNN_SCHEDULER_MAX_CLASSES ||
+        schedulerConfig->reservedHigh < 0 || schedulerConfig->reservedHigh > schedulerConfig->sessions) {
+        return nullptr;
+    }
+    auto scheduler = new MNN_Scheduler();
+    scheduler->net = net;
+    scheduler->config = *schedulerConfig;
+    scheduler->classes.resize(schedulerConfig->classCount);
+    for (int i = 0; i < schedulerConfig->classCount; ++i) {
+        const MNN_SchedulerClass& cls = schedulerConfig->classes[i];
+        scheduler->classes[i].weight = cls.weight > 0.0f ? cls.weight : 1.0f;
+        scheduler->classes[i].preemptible = i > 0 && cls.preemptible;
+    }
+    scheduler->slots.resize(schedulerConfig->sessions);
+    for (size_t i = 0; i < scheduler->slots.size(); ++i) {
+        SchedulerSlot& slot = scheduler->slots[i];
+        slot.net = i == 0 ? net : MNN_Interpreter_createReplica(net);
+        if (slot.net != nullptr) {
+            slot.session = MNN_Interpreter_createSession(slot.net, config);
+        }
+        if (slot.session == nullptr) {
+            MNN_Scheduler_destroy(scheduler);
+            return nullptr;
+        }
+    }
+    return scheduler;
+}
+
+void MNN_Scheduler_destroy(struct MNN_Scheduler* scheduler) {
+    if (scheduler == nullptr) {
+        return;
+    }
+    for (auto& slot : scheduler->slots) {
+        if (slot.session != nullptr) {
+            MNN_Interpreter_releaseSession(slot.net, slot.session);
+        }
+        if (slot.net != nullptr && slot.net != scheduler->net) {
+            MNN_Interpreter_destroy(slot.net);
+        }
+    }
+    delete scheduler;
+}
+
+struct MNN_SchedulerLease* MNN_Scheduler_acquire(struct MNN_Scheduler* scheduler, int cls, uint64_t timeoutUs,
+                                                 MNN_ErrorCode* error) {
+    if (error != nullptr) {
+        *error = MNN_NO_ERROR;
+    }
+    if (scheduler == nullptr || cls < 0 || cls >= (int)scheduler->classes.size()) {
+        if (error != nullptr) {
+            *error = MNN_INVALID_VALUE;
+        }
+        return nullptr;
+    }
+    auto start = std::chrono::steady_clock::now();
+    std::unique_lock<std::mutex> guard(scheduler->lock);
+    SchedulerClassState& state = scheduler->classes[cls];
+    activate(scheduler, cls);
+    SchedulerWaiter waiter;
+    waiter.cls = cls;
+    state.queue.push_back(&waiter);
+    dispatchLocked(scheduler);
+    if (cls == 0) {
+        preemptLocked(scheduler);
+    }
+    SchedulerSlot* slot = waitGranted(scheduler, guard, waiter, timeoutUs);
+    if (slot == nullptr) {
+        state.timeouts++;
+        if (error != nullptr) {
+            *error = MNN_DEADLINE_EXCEEDED;
+        }
+        return nullptr;
+    }
+    auto lease = new MNN_SchedulerLease();
+    lease->scheduler = scheduler;
+    lease->cls = cls;
+    lease->slot = slot;
+    lease->token = MNN_CancelToken_create();
+    lease->grantedAt = std::chrono::steady_clock::now();
+    slot->holder = lease;
+    double waited = elapsedNs(start);
+    state.granted++;
+    state.totalWaitNs += waited;
+    state.maxWaitNs = std::max(state.maxWaitNs, waited);
+    return lease;
+}
+
+struct MNN_Session* MNN_SchedulerLease_session(struct MNN_SchedulerLease* lease) {
+    if (lease == nullptr) {
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> guard(lease->scheduler->lock);
+    return lease->slot->session;
+}
+
+struct MNN_Interpreter* MNN_SchedulerLease_interpreter(struct MNN_SchedulerLease* lease) {
+    if (lease == nullptr) {
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> guard(lease->scheduler->lock);
+    return lease->slot->net;
+}
+
+struct MNN_Interpreter* MNN_Scheduler_interpreter(const struct MNN_Scheduler* scheduler, int index) {
+    if (scheduler == nullptr || index < 0 || index >= (int)scheduler->slots.size()) {
+        return nullptr;
+    }
+    return scheduler->slots[index].net;
+}
+
+MNN_ErrorCode MNN_SchedulerLease_run(struct MNN_SchedulerLease* lease) {
+    if (lease == nullptr) {
+        return MNN_INVALID_VALUE;
+    }
+    MNN_Scheduler* s = lease->scheduler;
+    std::unique_lock<std::mutex> guard(s->lock);
+    for (;;) {
+        MNN_CancelToken_reset(lease->token);
+        lease->running = true;
+        lease->runStart = std::chrono::steady_clock::now();
+        // 类 0 已在排队而此前没有可抢占的运行，轮到本租约时立即让出
+        preemptLocked(s);
+        MNN_Interpreter* net = lease->slot->net;
+        MNN_Session* session = lease->slot->session;
+        guard.unlock();
+        MNN_ErrorCode code = MNN_Interpreter_runSessionWithDeadline(net, session, 0, lease->token);
+        guard.lock();
+        lease->running = false;
+        if (!lease->preemptRequested) {
+            return code;
+        }
+        if (code != MNN_CANCELLED) {
+            // 运行先于抢占结束，抢占请求作废，再为排队的类 0 另找目标
+            lease->preemptRequested = false;
+            s->preemptsInFlight--;
+            preemptLocked(s);
+            return code;
+        }
+        MNN_ErrorCode restored = yieldAndReacquire(lease, guard);
+        if (restored != MNN_NO_ERROR) {
+            return restored;
+        }
+    }
+}
+
+void MNN_SchedulerLease_release(struct MNN_SchedulerLease* lease) {
+    if (lease == nullptr) {
+        return;
+    }
+    MNN_Scheduler* s = lease->scheduler;
+    {
+        std::lock_guard<std::mutex> guard(s->lock);
+        chargeRelease(s, lease);
+        dispatchLocked(s);
+    }
+    MNN_CancelToken_destroy(lease->token);
+    delete lease;
+}
+
+int MNN_Scheduler_getStats(struct MNN_Scheduler* scheduler, MNN_SchedulerClassStats* stats, int capacity) {
+    if (scheduler == nullptr) {
+        return 0;
+    }
+    std::lock_guard<std::mutex> guard(scheduler->lock);
+    int count = (int)scheduler->classes.size();
+    for (int i = 0; i < count && i < capacity && stats != nullptr; ++i) {
+        const SchedulerClassState& state = scheduler->classes[i];
+        stats[i].granted = state.granted;
+        stats[i].preempted = state.preempted;
+        stats[i].timeouts = state.timeouts;
+        stats[i].waiting = (int)state.queue.size();
+        stats[i].holding = state.holding;
+        stats[i].meanWaitMs = state.granted > 0 ? state.totalWaitNs / state.granted / 1e6 : 0.0;
+        stats[i].maxWaitMs = state.maxWaitNs / 1e6;
+    }
+    return count;
+}
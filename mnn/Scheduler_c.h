@@ -0,0 +1,105 @@
+//
+//  Scheduler_c.h
+//  MNN
+//
+//  带优先级的 Session 池调度：同一模型的若干 Session 由多个优先级类共享，
+//  类之间按权重做加权公平排队（按实际占用时长计费的步幅调度），
+//  可为最高优先级类（类 0）预留 Session，并可在算子边界抢占可抢占类的运行，
+//  被抢占的运行保存输入后重新排队，拿到 Session 后恢复输入并从头执行
+//
+
+#ifndef MNN_Scheduler_c_h
+#define MNN_Scheduler_c_h
+
+#include <stdint.h>
+#include "Interpreter_c.h"
+
+// 导出宏：Windows下导出，其他平台兼容
+#ifdef MNN_C_EXPORTS
+    // 仅当编译 libmnn.dll 时定义 MNN_C_EXPORTS，此时用 dllexport
+    #define MNN_C_API __declspec(dllexport)
+#else
+    #define MNN_C_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MNN_SCHEDULER_MAX_CLASSES 8
+
+typedef struct MNN_Scheduler MNN_Scheduler;
+typedef struct MNN_SchedulerLease MNN_SchedulerLease;
+
+typedef struct MNN_SchedulerClass {
+    float weight;           // 公平份额权重，<= 0 按 1 处理
+    MNN_BOOL preemptible;   // 运行中可被类 0 抢占
+} MNN_SchedulerClass;
+
+typedef struct MNN_SchedulerConfig {
+    int sessions;           // Session 池大小
+    int classCount;         // 1..MNN_SCHEDULER_MAX_CLASSES，类 0 为最高优先级
+    MNN_SchedulerClass classes[MNN_SCHEDULER_MAX_CLASSES];
+    int reservedHigh;       // 只有类 0 能使用的 Session 数
+    MNN_BOOL strictHigh;    // 类 0 有等待时总是先于其他类分配
+    MNN_BOOL preempt;       // 类 0 等待且无空闲 Session 时抢占可抢占类的运行
+} MNN_SchedulerConfig;
+
+typedef struct MNN_SchedulerClassStats {
+    uint64_t granted;
+    uint64_t preempted;     // 该类运行被抢占的次数
+    uint64_t timeouts;      // acquire 超时次数
+    int waiting;
+    int holding;
+    double meanWaitMs;
+    double maxWaitMs;
+} MNN_SchedulerClassStats;
+
+/**
+ * @brief create sessions of net and a scheduler in front of them. The first session is created on net,
+ * every other one on its own replica of net (MNN_Interpreter_createReplica), owned by the scheduler,
+ * so that leases run in parallel; net's model must not be released, and hints or modes set on net
+ * do not reach the replicas.
+ */
+MNN_C_API struct MNN_Scheduler* MNN_Scheduler_create(struct MNN_Interpreter* net, const struct MNN_ScheduleConfig* config,
+                                                     const MNN_SchedulerConfig* schedulerConfig);
+/**
+ * @brief release the sessions. All leases must have been released.
+ */
+MNN_C_API void MNN_Scheduler_destroy(struct MNN_Scheduler* scheduler);
+/**
+ * @brief wait for a session for priority class cls.
+ * @param timeoutUs 0 waits forever; on timeout returns NULL with MNN_DEADLINE_EXCEEDED.
+ */
+MNN_C_API struct MNN_SchedulerLease* MNN_Scheduler_acquire(struct MNN_Scheduler* scheduler, int cls, uint64_t timeoutUs,
+                                                           MNN_ErrorCode* error);
+/**
+ * @brief the leased session. A preempted run moves the lease to another session, so fetch it again
+ * after MNN_SchedulerLease_run before reading outputs.
+ */
+MNN_C_API struct MNN_Session* MNN_SchedulerLease_session(struct MNN_SchedulerLease* lease);
+/**
+ * @brief the interpreter owning the leased session, to fill its inputs and read its outputs.
+ * Like the session, it changes when a preempted run moves the lease.
+ */
+MNN_C_API struct MNN_Interpreter* MNN_SchedulerLease_interpreter(struct MNN_SchedulerLease* lease);
+/**
+ * @brief the interpreter of session index of the pool, 0 being net itself.
+ */
+MNN_C_API struct MNN_Interpreter* MNN_Scheduler_interpreter(const struct MNN_Scheduler* scheduler, int index);
+/**
+ * @brief run the leased session; preemption is handled inside and retried until the run completes.
+ */
+MNN_C_API MNN_ErrorCode MNN_SchedulerLease_run(struct MNN_SchedulerLease* lease);
+MNN_C_API void MNN_SchedulerLease_release(struct MNN_SchedulerLease* lease);
+/**
+ * @brief per-class statistics.
+ * @return number of classes, which may exceed capacity.
+ */
+MNN_C_API int MNN_Scheduler_getStats(struct MNN_Scheduler* scheduler, MNN_SchedulerClassStats* stats, int capacity);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MNN_Scheduler_c_h */
@@ -0,0 +1,30 @@
+//
+//  ShapeCopy.hpp
+//  MNN
+//
+//  把一个张量的形状抄到另一个 Session 的张量上：副本 Interpreter 新建的 Session 只有模型默认形状，
+//  需要和首个 Session 对齐的模块用它逐个输入 resize
+//
+
+#ifndef MNN_ShapeCopy_hpp
+#define MNN_ShapeCopy_hpp
+
+#include <algorithm>
+#include "Interpreter_c.h"
+#include "Tensor_c.h"
+
+// 把 net 上的 target 改成 source 的形状，返回是否改动；改动后调用方需对 target 所在 Session 再 resizeSession
+inline bool copyShape(struct MNN_Interpreter* net, const struct MNN_Tensor* source, struct MNN_Tensor* target) {
+    int sourceCount = 0, targetCount = 0;
+    int* sourceShape = MNN_Tensor_Shape(source, &sourceCount);
+    int* targetShape = MNN_Tensor_Shape(target, &targetCount);
+    bool changed = sourceCount != targetCount || !std::equal(sourceShape, sourceShape + sourceCount, targetShape);
+    if (changed) {
+        MNN_Interpreter_resizeTensor(net, target, sourceShape, sourceCount);
+    }
+    MNN_Tensor_FreeShape(sourceShape);
+    MNN_Tensor_FreeShape(targetShape);
+    return changed;
+}
+
+#endif /* MNN_ShapeCopy_hpp */
@@ -0,0 +1,133 @@
+//
+//  Tap_c.cpp
+//  MNN
+//
+
+#include "Tap_c.h"
+#include <string.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct TapState {
+    std::string op;
+    int outputIndex = 0;
+    void* buffer = nullptr;
+    size_t capacity = 0;
+    MNN_TapResult result;
+};
+
+struct MNN_TapSet {
+    std::vector<TapState> taps;
+    // 算子名 -> 该算子上的抽头下标，回调里每个算子只做一次查找
+    std::unordered_map<std::string, std::vector<int>> byOp;
+};
+
+// -------------------------- 内部工具 --------------------------
+// 以目标缓冲为存储创建主机张量，由 MNN 完成拷贝与布局转换
+static void capture(TapState& tap, const MNN_Tensor* tensor) {
+    MNN_TapResult& result = tap.result;
+    MNN_Tensor_GetHalideType(tensor, &result.type);
+    MNN_DimensionType dimType = MNN_Tensor_GetDimensionType(tensor);
+    result.dimType = dimType == MNN_CAFFE_C4 ? MNN_CAFFE : dimType;
+    int dimCount = 0;
+    int* shape = MNN_Tensor_Shape(tensor, &dimCount);
+    if (shape == nullptr || dimCount > MNN_TAP_MAX_DIMS) {
+        MNN_Tensor_FreeShape(shape);
+        return;
+    }
+    size_t elements = 1;
+    for (int i = 0; i < dimCount; ++i) {
+        result.dims[i] = shape[i];
+        elements *= (size_t)shape[i];
+    }
+    result.dimCount = dimCount;
+    result.size = elements * ((result.type.bits + 7) / 8);
+    if (result.size > tap.capacity || tap.buffer == nullptr) {
+        result.truncated = true;
+        MNN_Tensor_FreeShape(shape);
+        return;
+    }
+    MNN_Tensor* host = MNN_Tensor_CreateHost(shape, dimCount, result.type, tap.buffer, result.dimType);
+    MNN_Tensor_FreeShape(shape);
+    if (host == nullptr) {
+        return;
+    }
+    result.captured = MNN_Tensor_CopyToHostTensor(tensor, host);
+    MNN_Tensor_Destroy(host);
+}
+
+static int beforeOp(const MNN_Tensor**, size_t, const char*, void*) {
+    return 1;
+}
+
+static int afterOp(const MNN_Tensor** tensors, size_t tensorCount, const char* opName, void* userData) {
+    auto taps = static_cast<MNN_TapSet*>(userData);
+    if (opName == nullptr) {
+        return 1;
+    }
+    auto iter = taps->byOp.find(opName);
+    if (iter == taps->byOp.end()) {
+        return 1;
+    }
+    for (int index : iter->second) {
+        TapState& tap = taps->taps[index];
+        if (tap.outputIndex < (int)tensorCount) {
+            capture(tap, tensors[tap.outputIndex]);
+        }
+    }
+    return 1;
+}
+
+// -------------------------- 接口实现 --------------------------
+struct MNN_TapSet* MNN_TapSet_create(const MNN_Tap* taps, int count) {
+    if (taps == nullptr || count <= 0) {
+        return nullptr;
+    }
+    auto set = new MNN_TapSet();
+    set->taps.resize(count);
+    for (int i = 0; i < count; ++i) {
+        if (taps[i].op == nullptr || taps[i].outputIndex < 0) {
+            delete set;
+            return nullptr;
+        }
+        TapState& tap = set->taps[i];
+        tap.op = taps[i].op;
+        tap.outputIndex = taps[i].outputIndex;
+        tap.buffer = taps[i].buffer;
+        tap.capacity = taps[i].capacity;
+        memset(&tap.result, 0, sizeof(tap.result));
+        set->byOp[tap.op].push_back(i);
+    }
+    return set;
+}
+
+void MNN_TapSet_destroy(struct MNN_TapSet* taps) {
+    delete taps;
+}
+
+void MNN_TapSet_setBuffer(struct MNN_TapSet* taps, int index, void* buffer, size_t capacity) {
+    if (taps == nullptr || index < 0 || index >= (int)taps->taps.size()) {
+        return;
+    }
+    taps->taps[index].buffer = buffer;
+    taps->taps[index].capacity = capacity;
+}
+
+MNN_ErrorCode MNN_TapSet_run(struct MNN_TapSet* taps, struct MNN_Interpreter* net, struct MNN_Session* session) {
+    if (taps == nullptr || net == nullptr || session == nullptr) {
+        return MNN_INVALID_VALUE;
+    }
+    for (auto& tap : taps->taps) {
+        memset(&tap.result, 0, sizeof(tap.result));
+    }
+    return MNN_Interpreter_runSessionWithCallBack(net, session, beforeOp, afterOp, true, taps);
+}
+
+MNN_BOOL MNN_TapSet_result(struct MNN_TapSet* taps, int index, MNN_TapResult* result) {
+    if (taps == nullptr || result == nullptr || index < 0 || index >= (int)taps->taps.size()) {
+        return false;
+    }
+    *result = taps->taps[index].result;
+    return taps->taps[index].result.captured;
+}
@@ -0,0 +1,67 @@
+//
+//  Tap_c.h
+//  MNN
+//
+//  中间张量抽头：按算子名登记目标缓冲，张量一产生就在 after 回调里直接拷贝（含布局转换）到缓冲，
+//  不需要把张量放进 saveTensors，因此不改变 Session 的内存复用规划；
+//  一次运行即可同时得到中间层特征与最终输出
+//
+
+#ifndef MNN_Tap_c_h
+#define MNN_Tap_c_h
+
+#include "Interpreter_c.h"
+
+// 导出宏：Windows下导出，其他平台兼容
+#ifdef MNN_C_EXPORTS
+    // 仅当编译 libmnn.dll 时定义 MNN_C_EXPORTS，此时用 dllexport
+    #define MNN_C_API __declspec(dllexport)
+#else
+    #define MNN_C_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MNN_TAP_MAX_DIMS 8
+
+typedef struct MNN_TapSet MNN_TapSet;
+
+typedef struct MNN_Tap {
+    const char* op;         // 产生该张量的算子名
+    int outputIndex;        // 算子的第几个输出，通常为 0
+    void* buffer;           // 目标缓冲，由调用方持有
+    size_t capacity;        // 缓冲字节数
+} MNN_Tap;
+
+typedef struct MNN_TapResult {
+    MNN_BOOL captured;      // 本次运行是否已拷贝
+    MNN_BOOL truncated;     // 张量大于缓冲而未拷贝
+    size_t size;            // 张量字节数
+    struct halide_type_t type;
+    enum MNN_DimensionType dimType;     // 缓冲中的布局，NC4HW4 张量按 NCHW 输出
+    int dims[MNN_TAP_MAX_DIMS];
+    int dimCount;
+} MNN_TapResult;
+
+/**
+ * @brief register taps. One tap set must not be used by two runs at the same time.
+ */
+MNN_C_API struct MNN_TapSet* MNN_TapSet_create(const MNN_Tap* taps, int count);
+MNN_C_API void MNN_TapSet_destroy(struct MNN_TapSet* taps);
+/**
+ * @brief change the destination of one tap between runs.
+ */
+MNN_C_API void MNN_TapSet_setBuffer(struct MNN_TapSet* taps, int index, void* buffer, size_t capacity);
+/**
+ * @brief run session to completion, copying every tapped tensor out as soon as its op finishes.
+ */
+MNN_C_API MNN_ErrorCode MNN_TapSet_run(struct MNN_TapSet* taps, struct MNN_Interpreter* net, struct MNN_Session* session);
+MNN_C_API MNN_BOOL MNN_TapSet_result(struct MNN_TapSet* taps, int index, MNN_TapResult* result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MNN_Tap_c_h */
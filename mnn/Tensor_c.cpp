@@ -8,6 +8,7 @@
 
 #include <MNN/Tensor.hpp>
 #include <Tensor_c.h>
+#include "Metrics.hpp"
 #include <vector>
 
 using namespace MNN;
@@ -51,13 +52,25 @@ MNN_PUBLIC void MNN_Tensor_Destroy(struct MNN_Tensor* tensor) {
 MNN_PUBLIC MNN_BOOL MNN_Tensor_CopyFromHostTensor(struct MNN_Tensor* tensor, const struct MNN_Tensor* hostTensor) {
     Tensor* cppTensor = reinterpret_cast<Tensor*>(tensor);
     const Tensor* cppHostTensor = reinterpret_cast<const Tensor*>(hostTensor);
-    return cppTensor->copyFromHostTensor(cppHostTensor);
+    if (!Metrics::enabled()) {
+        return cppTensor->copyFromHostTensor(cppHostTensor);
+    }
+    uint64_t begin = Metrics::nowNs();
+    bool result = cppTensor->copyFromHostTensor(cppHostTensor);
+    Metrics::recordCurrent(MNN_METRIC_OP_COPY_IN, Metrics::nowNs() - begin);
+    return result;
 }
 
 MNN_PUBLIC MNN_BOOL MNN_Tensor_CopyToHostTensor(const struct MNN_Tensor* tensor, struct MNN_Tensor* hostTensor) {
     const Tensor* cppTensor = reinterpret_cast<const Tensor*>(tensor);
     Tensor* cppHostTensor = reinterpret_cast<Tensor*>(hostTensor);
-    return cppTensor->copyToHostTensor(cppHostTensor);
+    if (!Metrics::enabled()) {
+        return cppTensor->copyToHostTensor(cppHostTensor);
+    }
+    uint64_t begin = Metrics::nowNs();
+    bool result = cppTensor->copyToHostTensor(cppHostTensor);
+    Metrics::recordCurrent(MNN_METRIC_OP_COPY_OUT, Metrics::nowNs() - begin);
+    return result;
 }
 
 MNN_PUBLIC struct MNN_Tensor* MNN_Tensor_CreateHostTensorFromDevice(const struct MNN_Tensor* deviceTensor, MNN_BOOL copyData) {
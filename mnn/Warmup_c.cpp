@@ -0,0 +1,161 @@
+//
+//  Warmup_c.cpp
+//  MNN
+//
+
+#include "Warmup_c.h"
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+// -------------------------- 内部工具 --------------------------
+// 确定性的合成输入：浮点填充 [-1, 1) 的伪随机数，整数填 0（对索引类输入总是合法）
+static void fillSynthetic(struct MNN_Tensor* host) {
+    struct halide_type_t type;
+    MNN_Tensor_GetHalideType(host, &type);
+    void* data = MNN_Tensor_Host(host);
+    const int bytes = MNN_Tensor_Size(host);
+    if (data == nullptr || bytes <= 0) {
+        return;
+    }
+    if (type.code != halide_type_float || type.bits != 32) {
+        memset(data, 0, bytes);
+        return;
+    }
+    float* values = static_cast<float*>(data);
+    const int count = bytes / (int)sizeof(float);
+    uint32_t state = 0x9E3779B9u;
+    for (int i = 0; i < count; ++i) {
+        state = state * 1664525u + 1013904223u;
+        values[i] = (float)(state >> 8) * (2.0f / 16777216.0f) - 1.0f;
+    }
+}
+
+static void fillInputs(struct MNN_Interpreter* net, struct MNN_Session* session) {
+    MNN_NamedTensorList inputs = MNN_Interpreter_GetSessionInputAll(net, session);
+    for (int i = 0; i < inputs.count; ++i) {
+        struct MNN_Tensor* input = inputs.tensors[i].tensor;
+        struct MNN_Tensor* host = MNN_Tensor_CreateHostTensorFromDevice(input, 0);
+        if (host == nullptr) {
+            continue;
+        }
+        fillSynthetic(host);
+        MNN_Tensor_CopyFromHostTensor(input, host);
+        MNN_Tensor_Destroy(host);
+    }
+    MNN_NamedTensorList_Free(inputs);
+}
+
+static MNN_ErrorCode applyBucket(struct MNN_Interpreter* net, struct MNN_Session* session, const MNN_WarmupBucket& bucket) {
+    if (bucket.shapeCount <= 0) {
+        return MNN_NO_ERROR;
+    }
+    for (int i = 0; i < bucket.shapeCount; ++i) {
+        const MNN_WarmupShape& shape = bucket.shapes[i];
+        struct MNN_Tensor* input = MNN_Interpreter_getSessionInput(net, session, shape.input);
+        if (input == nullptr || shape.dims == nullptr || shape.dimCount <= 0) {
+            return MNN_INVALID_VALUE;
+        }
+        MNN_Interpreter_resizeTensor(net, input, shape.dims, shape.dimCount);
+    }
+    MNN_Interpreter_resizeSession(net, session);
+    return MNN_NO_ERROR;
+}
+
+static bool closeEnough(double a, double b, float tolerance) {
+    return fabs(a - b) <= tolerance * std::max(a, b);
+}
+
+static double timedRun(struct MNN_Interpreter* net, struct MNN_Session* session, MNN_ErrorCode* code) {
+    auto begin = std::chrono::steady_clock::now();
+    *code = MNN_Interpreter_runSession(net, session);
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - begin).count();
+}
+
+static void warmBucket(struct MNN_Interpreter* net, struct MNN_Session* session, const MNN_WarmupBucket& bucket,
+                       const MNN_WarmupConfig& config, MNN_WarmupResult* result) {
+    memset(result, 0, sizeof(*result));
+    result->code = applyBucket(net, session, bucket);
+    if (result->code != MNN_NO_ERROR) {
+        return;
+    }
+    fillInputs(net, session);
+
+    const int minRuns = std::max(config.minRuns, 2);
+    const int maxRuns = std::max(config.maxRuns, minRuns);
+    std::vector<double> steady;
+    double previous = -1.0;
+    for (int run = 0; run < maxRuns; ++run) {
+        MNN_ErrorCode code;
+        double ms = timedRun(net, session, &code);
+        result->runs = run + 1;
+        if (code != MNN_NO_ERROR) {
+            result->code = code;
+            return;
+        }
+        if (run == 0) {
+            result->firstMs = ms;
+            continue;
+        }
+        steady.push_back(ms);
+        result->lastMs = ms;
+        // 首次之后的第一次运行只作为比较基准
+        bool stable = previous > 0.0 && closeEnough(ms, previous, config.tolerance);
+        previous = ms;
+        if (stable) {
+            result->converged = 1;
+            if (result->runs >= minRuns) {
+                break;
+            }
+        } else {
+            result->converged = 0;
+        }
+    }
+    std::sort(steady.begin(), steady.end());
+    result->minMs = steady.front();
+    result->steadyMs = steady[steady.size() / 2];
+}
+
+// -------------------------- 接口实现 --------------------------
+MNN_ErrorCode MNN_Warmup_run(struct MNN_Interpreter* net, struct MNN_Session* session,
+                             const MNN_WarmupBucket* buckets, int bucketCount,
+                             const MNN_WarmupConfig* config, MNN_WarmupResult* results) {
+    if (net == nullptr || session == nullptr || (bucketCount > 0 && buckets == nullptr)) {
+        return MNN_INVALID_VALUE;
+    }
+    MNN_WarmupConfig warmupConfig;
+    if (config != nullptr) {
+        warmupConfig = *config;
+    } else {
+        warmupConfig.minRuns = 3;
+        warmupConfig.maxRuns = 20;
+        warmupConfig.tolerance = 0.1f;
+        warmupConfig.updateCache = 1;
+    }
+    // 未声明桶时按当前形状预热一次
+    MNN_WarmupBucket current = {nullptr, 0};
+    if (bucketCount <= 0) {
+        buckets = &current;
+        bucketCount = 1;
+        results = nullptr;
+    }
+
+    MNN_ErrorCode first = MNN_NO_ERROR;
+    for (int i = 0; i < bucketCount; ++i) {
+        MNN_WarmupResult result;
+        warmBucket(net, session, buckets[i], warmupConfig, &result);
+        if (results != nullptr) {
+            results[i] = result;
+        }
+        if (first == MNN_NO_ERROR) {
+            first = result.code;
+        }
+    }
+    if (first != MNN_NO_ERROR || !warmupConfig.updateCache) {
+        return first;
+    }
+    return MNN_Interpreter_updateCacheFile(net, session, 0);
+}
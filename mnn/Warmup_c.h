@@ -0,0 +1,72 @@
+//
+//  Warmup_c.h
+//  MNN
+//
+//  预热与调优：按声明的输入形状分桶依次 resize，用合成输入运行 Session，
+//  触发算子选择、内存规划与调优，直到延迟稳定，最后调用 updateCacheFile 持久化调优缓存
+//
+
+#ifndef MNN_Warmup_c_h
+#define MNN_Warmup_c_h
+
+#include "Interpreter_c.h"
+
+// 导出宏：Windows下导出，其他平台兼容
+#ifdef MNN_C_EXPORTS
+    // 仅当编译 libmnn.dll 时定义 MNN_C_EXPORTS，此时用 dllexport
+    #define MNN_C_API __declspec(dllexport)
+#else
+    #define MNN_C_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 一个输入的形状
+typedef struct MNN_WarmupShape {
+    const char* input;      // 输入名，NULL 表示模型的默认输入
+    const int* dims;
+    int dimCount;
+} MNN_WarmupShape;
+
+// 一个形状桶：同时生效的一组输入形状，shapeCount 为 0 表示保持当前形状
+typedef struct MNN_WarmupBucket {
+    const MNN_WarmupShape* shapes;
+    int shapeCount;
+} MNN_WarmupBucket;
+
+typedef struct MNN_WarmupConfig {
+    int minRuns;            // 每个桶至少运行的次数（含首次），至少为 2
+    int maxRuns;            // 延迟未稳定时最多运行的次数
+    float tolerance;        // 最近两次运行相差不超过该比例即视为稳定，例如 0.1
+    MNN_BOOL updateCache;   // 全部桶完成后调用 MNN_Interpreter_updateCacheFile
+} MNN_WarmupConfig;
+
+typedef struct MNN_WarmupResult {
+    MNN_ErrorCode code;     // 该桶 resize / 运行的结果
+    int runs;
+    double firstMs;         // resize 后首次运行，包含调优耗时
+    double steadyMs;        // 除首次外运行延迟的中位数
+    double minMs;
+    double lastMs;
+    MNN_BOOL converged;     // 是否在 maxRuns 内达到稳定
+} MNN_WarmupResult;
+
+/**
+ * @brief warm session over every bucket. Inputs are filled with deterministic synthetic data
+ * (floats in [-1, 1), integers 0). The session is left resized to the last bucket.
+ * Call MNN_Interpreter_setCacheFile before creating the session for updateCache to persist anything.
+ * @param config NULL means minRuns 3, maxRuns 20, tolerance 0.1, updateCache on.
+ * @param results bucketCount entries, may be NULL.
+ * @return the first bucket error, otherwise the updateCacheFile result.
+ */
+MNN_C_API MNN_ErrorCode MNN_Warmup_run(struct MNN_Interpreter* net, struct MNN_Session* session,
+                                       const MNN_WarmupBucket* buckets, int bucketCount,
+                                       const MNN_WarmupConfig* config, MNN_WarmupResult* results);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MNN_Warmup_c_h */
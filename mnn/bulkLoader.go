@@ -0,0 +1,79 @@
+package mnn
+
+/*
+#include <stdlib.h>
+#include "BulkLoader_c.h"
+*/
+import "C"
+import (
+	"runtime"
+	"unsafe"
+)
+
+// BulkLoadItem describes one model to load
+type BulkLoadItem struct {
+	File             string
+	Config           *ScheduleConfig // nil for the default config (CPU, 4 threads)
+	InitThreadNumber int             // > 0 sets HintModeInitThreadNumber for this model
+}
+
+// BulkLoadResult is the outcome of one item; Interpreter and Session are nil on failure
+type BulkLoadResult struct {
+	Interpreter *Interpreter
+	Session     *Session
+	Code        ErrorCode
+	FileSize    int64
+	QueueMs     float64
+	LoadMs      float64
+	SessionMs   float64
+}
+
+// BulkLoad loads models concurrently on at most maxConcurrency threads (<= 0 for the number of cores),
+// prefetching all files first; it returns the first failing item's code
+func BulkLoad(items []BulkLoadItem, maxConcurrency int) ([]BulkLoadResult, ErrorCode) {
+	if len(items) == 0 {
+		return nil, ErrorCode(C.MNN_NO_ERROR)
+	}
+	var pinner runtime.Pinner
+	defer pinner.Unpin()
+	cItems := make([]C.MNN_BulkLoadItem, len(items))
+	// 同一个 ScheduleConfig 只转换一次，重复转换会释放上一次生成的字符串数组
+	cConfigs := make(map[*ScheduleConfig]*C.MNN_ScheduleConfig)
+	for i, item := range items {
+		cItems[i].file = C.CString(item.File)
+		defer C.free(unsafe.Pointer(cItems[i].file))
+		cItems[i].initThreadNumber = C.int(item.InitThreadNumber)
+		if item.Config == nil {
+			continue
+		}
+		cConfig, ok := cConfigs[item.Config]
+		if !ok {
+			converted := item.Config.ToCScheduleConfig()
+			defer item.Config.Unpin()
+			cConfig = &converted
+			pinner.Pin(cConfig)
+			cConfigs[item.Config] = cConfig
+		}
+		cItems[i].config = cConfig
+	}
+
+	cResults := make([]C.MNN_BulkLoadResult, len(items))
+	code := C.MNN_BulkLoader_load(&cItems[0], C.int(len(items)), C.int(maxConcurrency), &cResults[0])
+
+	results := make([]BulkLoadResult, len(items))
+	for i, r := range cResults {
+		results[i] = BulkLoadResult{
+			Code:      ErrorCode(r.code),
+			FileSize:  int64(r.fileSize),
+			QueueMs:   float64(r.queueMs),
+			LoadMs:    float64(r.loadMs),
+			SessionMs: float64(r.sessionMs),
+		}
+		if r.net != nil {
+			net := &Interpreter{c: r.net}
+			results[i].Interpreter = net
+			results[i].Session = &Session{c: r.session, Interpreter: net}
+		}
+	}
+	return results, ErrorCode(code)
+}
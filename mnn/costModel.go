@@ -0,0 +1,100 @@
+package mnn
+
+/*
+#include "CostModel_c.h"
+*/
+import "C"
+
+// CostEstimate is the predicted cost of one run of a candidate
+type CostEstimate struct {
+	PredictedMs  float64 // < 0 when unknown
+	CompletionMs float64 // including the runs already in flight on the candidate
+	MFlops       float64
+	QPS          float64 // throughput of one session running back to back
+	QPSPerCore   float64
+	Threads      int
+	Samples      uint64
+	Intercept    float64 // fit: latency = Intercept + MsPerMFlop * MFlops
+	MsPerMFlop   float64
+}
+
+// CostModel calibrates measured latency against session FLOPs and routes requests by SLO
+type CostModel struct {
+	c *C.struct_MNN_CostModel
+}
+
+// NewCostModel creates a cost model; decay is the per-sample forgetting factor, <= 0 for 0.99
+func NewCostModel(decay float64) *CostModel {
+	return &CostModel{c: C.MNN_CostModel_create(C.double(decay))}
+}
+
+// Close frees the model; the sessions stay owned by the caller
+func (m *CostModel) Close() {
+	if m != nil && m.c != nil {
+		C.MNN_CostModel_destroy(m.c)
+		m.c = nil
+	}
+}
+
+// AddCandidate registers a session (model variant, thread count or replica) and returns its index
+func (m *CostModel) AddCandidate(session *Session) int {
+	return int(C.MNN_CostModel_addCandidate(m.c, session.Interpreter.c, session.c))
+}
+
+// Observe records a latency measured for the candidate's current shape
+func (m *CostModel) Observe(candidate int, latencyMs float64) {
+	C.MNN_CostModel_observe(m.c, C.int(candidate), C.double(latencyMs))
+}
+
+// Run runs the candidate's session, timing and recording it
+func (m *CostModel) Run(candidate int) ErrorCode {
+	return ErrorCode(C.MNN_CostModel_run(m.c, C.int(candidate)))
+}
+
+// Refresh reads the candidate's current shape and FLOPs again; call it after resizing the session
+func (m *CostModel) Refresh(candidate int) bool {
+	return B2Go(C.MNN_CostModel_refresh(m.c, C.int(candidate)))
+}
+
+// Predict estimates a run of the candidate for the first input's dims; nil dims uses the current shape
+func (m *CostModel) Predict(candidate int, dims []int) (CostEstimate, bool) {
+	var e C.MNN_CostEstimate
+	cDims, count := costDims(dims)
+	ok := B2Go(C.MNN_CostModel_predict(m.c, C.int(candidate), cDims, count, &e))
+	return toCostEstimate(&e), ok
+}
+
+// Select picks the candidate with the fewest core-milliseconds that meets sloMs (<= 0 for no SLO).
+// When none meets it the earliest completing candidate is returned with meetsSlo false; -1 without candidates.
+func (m *CostModel) Select(dims []int, sloMs float64) (candidate int, meetsSlo bool, estimate CostEstimate) {
+	var e C.MNN_CostEstimate
+	var cMeets C.MNN_BOOL
+	cDims, count := costDims(dims)
+	candidate = int(C.MNN_CostModel_select(m.c, cDims, count, C.double(sloMs), &cMeets, &e))
+	return candidate, B2Go(cMeets), toCostEstimate(&e)
+}
+
+func costDims(dims []int) (*C.int, C.int) {
+	if len(dims) == 0 {
+		return nil, 0
+	}
+	cDims := make([]C.int, len(dims))
+	for i, d := range dims {
+		cDims[i] = C.int(d)
+	}
+	return &cDims[0], C.int(len(dims))
+}
+
+func toCostEstimate(e *C.MNN_CostEstimate) CostEstimate {
+	return CostEstimate{
+		PredictedMs:  float64(e.predictedMs),
+		CompletionMs: float64(e.completionMs),
+		MFlops:       float64(e.mflops),
+		QPS:          float64(e.qps),
+		QPSPerCore:   float64(e.qpsPerCore),
+		Threads:      int(e.threads),
+		Samples:      uint64(e.samples),
+		Intercept:    float64(e.intercept),
+		MsPerMFlop:   float64(e.msPerMFlop),
+	}
+}
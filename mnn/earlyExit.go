@@ -0,0 +1,69 @@
+package mnn
+
+/*
+#include <stdlib.h>
+#include "EarlyExit_c.h"
+*/
+import "C"
+import "unsafe"
+
+// ExitPoint declares an intermediate tensor that can end the run early.
+// The run stops when the max probability over the last dimension is at least Threshold for every sample.
+type ExitPoint struct {
+	Tensor    string
+	Threshold float32
+	Logits    bool // apply softmax over the last dimension first
+}
+
+// EarlyExit owns a session that stops at the first confident exit point
+type EarlyExit struct {
+	c   *C.struct_MNN_EarlyExit
+	net *Interpreter
+}
+
+// NewEarlyExit creates a session of net that keeps the exit tensors readable after an early exit
+func NewEarlyExit(net *Interpreter, config *ScheduleConfig, exits []ExitPoint) *EarlyExit {
+	if len(exits) == 0 {
+		return nil
+	}
+	cConfig := config.ToCScheduleConfig()
+	defer config.Unpin()
+	cExits := make([]C.MNN_ExitPoint, len(exits))
+	for i, exit := range exits {
+		cExits[i].tensor = C.CString(exit.Tensor)
+		defer C.free(unsafe.Pointer(cExits[i].tensor))
+		cExits[i].threshold = C.float(exit.Threshold)
+		cExits[i].logits = B2C(exit.Logits)
+	}
+	c := C.MNN_EarlyExit_create(net.c, &cConfig, &cExits[0], C.int(len(cExits)))
+	if c == nil {
+		return nil
+	}
+	return &EarlyExit{c: c, net: net}
+}
+
+// Close releases the session
+func (e *EarlyExit) Close() {
+	if e != nil && e.c != nil {
+		C.MNN_EarlyExit_destroy(e.c)
+		e.c = nil
+	}
+}
+
+// Session returns the session, for filling inputs and reading outputs or exit tensors
+func (e *EarlyExit) Session() *Session {
+	return &Session{c: C.MNN_EarlyExit_session(e.c), Interpreter: e.net}
+}
+
+// SetThreshold changes the threshold of one exit point
+func (e *EarlyExit) SetThreshold(index int, threshold float32) {
+	C.MNN_EarlyExit_setThreshold(e.c, C.int(index), C.float(threshold))
+}
+
+// Run runs the session; exitIndex is -1 when the whole graph ran
+func (e *EarlyExit) Run() (exitIndex int, score float32, code ErrorCode) {
+	var cIndex C.int
+	var cScore C.float
+	code = ErrorCode(C.MNN_EarlyExit_run(e.c, &cIndex, &cScore))
+	return int(cIndex), float32(cScore), code
+}
@@ -34,4 +34,9 @@ const (
 	FILE_SEEK_FAILED   ErrorCode = C.MNN_FILE_SEEK_FAILED
 	FILE_NOT_EXIST     ErrorCode = C.MNN_FILE_NOT_EXIST
 	FILE_UNMAP_FAILED  ErrorCode = C.MNN_FILE_UNMAP_FAILED
+
+	// Binding resource error
+	RESOURCE_EXHAUSTED ErrorCode = C.MNN_RESOURCE_EXHAUSTED
+	DEADLINE_EXCEEDED  ErrorCode = C.MNN_DEADLINE_EXCEEDED
+	CANCELLED          ErrorCode = C.MNN_CANCELLED
 )
@@ -0,0 +1,95 @@
+package mnn
+
+/*
+#include "Executor_c.h"
+*/
+import "C"
+import (
+	"runtime"
+	"unsafe"
+)
+
+// ExecutorStats holds executor statistics
+type ExecutorStats struct {
+	Threads          int
+	PermitsInUse     int
+	PeakPermitsInUse int
+	Tasks            uint64
+	Steals           uint64
+	PermitWaits      uint64
+}
+
+// Executor is a work-stealing executor whose thread budget is shared by preprocessing and session runs
+type Executor struct {
+	c *C.struct_MNN_Executor
+}
+
+// TaskGroup collects tasks to wait for; it must not be used from two goroutines at the same time
+type TaskGroup struct {
+	c      *C.struct_MNN_TaskGroup
+	pinner runtime.Pinner
+}
+
+// NewExecutor starts the workers; threads <= 0 uses the number of online cores
+func NewExecutor(threads int) *Executor {
+	return &Executor{c: C.MNN_Executor_create(C.int(threads))}
+}
+
+// Close finishes the submitted tasks and stops the workers
+func (e *Executor) Close() {
+	if e != nil && e.c != nil {
+		C.MNN_Executor_destroy(e.c)
+		e.c = nil
+	}
+}
+
+// Stats returns executor statistics
+func (e *Executor) Stats() ExecutorStats {
+	var s C.MNN_ExecutorStats
+	C.MNN_Executor_getStats(e.c, &s)
+	return ExecutorStats{
+		Threads:          int(s.threads),
+		PermitsInUse:     int(s.permitsInUse),
+		PeakPermitsInUse: int(s.peakPermitsInUse),
+		Tasks:            uint64(s.tasks),
+		Steals:           uint64(s.steals),
+		PermitWaits:      uint64(s.permitWaits),
+	}
+}
+
+// NewGroup creates a task group
+func (e *Executor) NewGroup() *TaskGroup {
+	return &TaskGroup{c: C.MNN_Executor_createGroup(e.c)}
+}
+
+// Close frees the group after Wait
+func (g *TaskGroup) Close() {
+	if g != nil && g.c != nil {
+		C.MNN_TaskGroup_destroy(g.c)
+		g.c = nil
+		g.pinner.Unpin()
+	}
+}
+
+// Convert queues process.Convert as a single-thread task; source stays pinned until Wait.
+// One ImageProcess must not be used by two tasks at the same time.
+func (g *TaskGroup) Convert(process *ImageProcess, source []byte, iw, ih, stride int, dest *Tensor) {
+	if len(source) == 0 {
+		return
+	}
+	g.pinner.Pin(&source[0])
+	C.MNN_TaskGroup_submitConvert(g.c, process.c, (*C.uint8_t)(unsafe.Pointer(&source[0])), C.int(iw), C.int(ih),
+		C.int(stride), dest.c)
+}
+
+// Run queues a session run holding as many threads of the budget as the session uses
+func (g *TaskGroup) Run(session *Session) {
+	C.MNN_TaskGroup_submitRun(g.c, session.Interpreter.c, session.c)
+}
+
+// Wait blocks until every queued task has finished and returns the first error
+func (g *TaskGroup) Wait() ErrorCode {
+	code := ErrorCode(C.MNN_TaskGroup_wait(g.c))
+	g.pinner.Unpin()
+	return code
+}
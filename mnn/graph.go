@@ -0,0 +1,70 @@
+package mnn
+
+/*
+#include <stdlib.h>
+#include "Graph_c.h"
+*/
+import "C"
+import "unsafe"
+
+// GraphEdgeMode tells how an edge was transferred in the last run
+type GraphEdgeMode int
+
+const (
+	GRAPH_EDGE_NONE    GraphEdgeMode = C.MNN_GRAPH_EDGE_NONE
+	GRAPH_EDGE_MEMCPY  GraphEdgeMode = C.MNN_GRAPH_EDGE_MEMCPY  // same type, layout and size on host memory
+	GRAPH_EDGE_CONVERT GraphEdgeMode = C.MNN_GRAPH_EDGE_CONVERT // converted or uploaded by MNN
+	GRAPH_EDGE_STAGED  GraphEdgeMode = C.MNN_GRAPH_EDGE_STAGED  // device source, copied through a host tensor
+)
+
+// Graph runs sessions wired output-to-input by name, handing tensors over without leaving C++
+type Graph struct {
+	c *C.struct_MNN_Graph
+}
+
+// NewGraph creates an empty graph
+func NewGraph() *Graph {
+	return &Graph{c: C.MNN_Graph_create()}
+}
+
+// Close frees the graph; the sessions stay owned by the caller
+func (g *Graph) Close() {
+	if g != nil && g.c != nil {
+		C.MNN_Graph_destroy(g.c)
+		g.c = nil
+	}
+}
+
+// AddNode adds a session and returns its node index, or -1
+func (g *Graph) AddNode(session *Session) int {
+	return int(C.MNN_Graph_addNode(g.c, session.Interpreter.c, session.c))
+}
+
+// Connect feeds output of node from into input of node to and returns the edge index, or -1
+func (g *Graph) Connect(from int, output string, to int, input string) int {
+	cOutput := C.CString(output)
+	defer C.free(unsafe.Pointer(cOutput))
+	cInput := C.CString(input)
+	defer C.free(unsafe.Pointer(cInput))
+	return int(C.MNN_Graph_connect(g.c, C.int(from), cOutput, C.int(to), cInput))
+}
+
+// Prepare checks the graph is acyclic and resizes every input to its producer's shape
+func (g *Graph) Prepare() ErrorCode {
+	return ErrorCode(C.MNN_Graph_prepare(g.c))
+}
+
+// Run runs every node once, independent branches concurrently
+func (g *Graph) Run() ErrorCode {
+	return ErrorCode(C.MNN_Graph_run(g.c))
+}
+
+// NodeStatus returns the result of a node in the last run
+func (g *Graph) NodeStatus(node int) ErrorCode {
+	return ErrorCode(C.MNN_Graph_nodeStatus(g.c, C.int(node)))
+}
+
+// EdgeMode returns how an edge was transferred in the last run
+func (g *Graph) EdgeMode(edge int) GraphEdgeMode {
+	return GraphEdgeMode(C.MNN_Graph_edgeMode(g.c, C.int(edge)))
+}
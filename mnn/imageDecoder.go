@@ -0,0 +1,146 @@
+package mnn
+
+/*
+#include "ImageDecoder_c.h"
+#include "ImageProcess_c.h"
+#include "Tensor_c.h"
+#include "Matrix_c.h"
+#include "ErrorCode_c.h"
+*/
+import "C"
+import (
+	"unsafe"
+)
+
+// ImageCodec is the compressed image container type
+type ImageCodec C.MNN_ImageCodec
+
+const (
+	ImageCodecUnknown ImageCodec = C.MNN_IMAGE_CODEC_UNKNOWN
+	ImageCodecJPEG    ImageCodec = C.MNN_IMAGE_CODEC_JPEG
+	ImageCodecPNG     ImageCodec = C.MNN_IMAGE_CODEC_PNG
+)
+
+// ImageInfo holds the header information of a compressed image
+type ImageInfo struct {
+	Codec    ImageCodec
+	Width    int
+	Height   int
+	Channels int
+}
+
+// DecodedImage holds decoded pixels; Pixels aliases the decoder's internal buffer and is valid until the next call on the same decoder
+type DecodedImage struct {
+	Pixels     []byte
+	Width      int
+	Height     int
+	Stride     int
+	Format     ImageFormat
+	ScaleDenom int
+}
+
+// ImageDecodeResult describes a DecodeConvert call
+type ImageDecodeResult struct {
+	Info          ImageInfo
+	DecodedWidth  int
+	DecodedHeight int
+	ScaleDenom    int
+	Transform     Matrix9 // dest tensor coordinates -> original image coordinates
+}
+
+// ImageDecoder decodes JPEG/PNG and converts straight into a tensor, reusing its buffers across calls.
+// It is not safe for concurrent use; create one per goroutine.
+type ImageDecoder struct {
+	c *C.struct_MNN_ImageDecoder
+}
+
+func fromCImageInfo(c *C.MNN_ImageInfo) ImageInfo {
+	return ImageInfo{
+		Codec:    ImageCodec(c.codec),
+		Width:    int(c.width),
+		Height:   int(c.height),
+		Channels: int(c.channels),
+	}
+}
+
+// GetImageInfo parses only the image header
+func GetImageInfo(data []byte) (ImageInfo, ErrorCode) {
+	if len(data) == 0 {
+		return ImageInfo{}, ErrorCode(C.MNN_INVALID_VALUE)
+	}
+	var cInfo C.MNN_ImageInfo
+	code := C.MNN_ImageDecoder_getInfo((*C.uint8_t)(unsafe.Pointer(&data[0])), C.size_t(len(data)), &cInfo)
+	if code != C.MNN_NO_ERROR {
+		return ImageInfo{}, ErrorCode(code)
+	}
+	return fromCImageInfo(&cInfo), ErrorCode(code)
+}
+
+// NewImageDecoder creates a new ImageDecoder
+func NewImageDecoder() *ImageDecoder {
+	return &ImageDecoder{c: C.MNN_ImageDecoder_create()}
+}
+
+// Close releases the decoder and its buffers
+func (decoder *ImageDecoder) Close() {
+	if decoder != nil && decoder.c != nil {
+		C.MNN_ImageDecoder_destroy(decoder.c)
+		decoder.c = nil
+	}
+}
+
+// Decode decodes the image; JPEG is downscaled in the DCT domain as far as possible while staying at least minWidth x minHeight (0 for full size)
+func (decoder *ImageDecoder) Decode(data []byte, minWidth, minHeight int) (DecodedImage, ErrorCode) {
+	if decoder == nil || decoder.c == nil || len(data) == 0 {
+		return DecodedImage{}, ErrorCode(C.MNN_INVALID_VALUE)
+	}
+	var cImage C.MNN_DecodedImage
+	code := C.MNN_ImageDecoder_decode(
+		decoder.c,
+		(*C.uint8_t)(unsafe.Pointer(&data[0])),
+		C.size_t(len(data)),
+		C.int(minWidth),
+		C.int(minHeight),
+		&cImage,
+	)
+	if code != C.MNN_NO_ERROR {
+		return DecodedImage{}, ErrorCode(code)
+	}
+	return DecodedImage{
+		Pixels:     unsafe.Slice((*byte)(unsafe.Pointer(cImage.pixels)), int(cImage.stride)*int(cImage.height)),
+		Width:      int(cImage.width),
+		Height:     int(cImage.height),
+		Stride:     int(cImage.stride),
+		Format:     ImageFormat(cImage.format),
+		ScaleDenom: int(cImage.scaleDenom),
+	}, ErrorCode(code)
+}
+
+// DecodeConvert decodes the image at the smallest resolution that still covers dest and converts it into dest in one pass.
+// config.SourceFormat is ignored; fit selects stretching (kFill_ScaleToFit) or aspect-preserving placement, in which case
+// config.Wrap should normally be ZERO.
+func (decoder *ImageDecoder) DecodeConvert(data []byte, config *ImageProcessConfig, fit MNN_Matrix_ScaleToFit, dest *Tensor) (ImageDecodeResult, ErrorCode) {
+	if decoder == nil || decoder.c == nil || len(data) == 0 || config == nil || dest == nil {
+		return ImageDecodeResult{}, ErrorCode(C.MNN_INVALID_VALUE)
+	}
+	var cResult C.MNN_ImageDecodeResult
+	code := C.MNN_ImageDecoder_decodeConvert(
+		decoder.c,
+		(*C.uint8_t)(unsafe.Pointer(&data[0])),
+		C.size_t(len(data)),
+		config.ToC(),
+		C.MNN_Matrix_ScaleToFit(fit),
+		dest.c,
+		&cResult,
+	)
+	if code != C.MNN_NO_ERROR {
+		return ImageDecodeResult{}, ErrorCode(code)
+	}
+	return ImageDecodeResult{
+		Info:          fromCImageInfo(&cResult.info),
+		DecodedWidth:  int(cResult.decodedWidth),
+		DecodedHeight: int(cResult.decodedHeight),
+		ScaleDenom:    int(cResult.scaleDenom),
+		Transform:     fromCMatrix9(cResult.transform),
+	}, ErrorCode(code)
+}
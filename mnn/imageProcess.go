@@ -160,6 +160,13 @@ func (process *ImageProcess) SetMatrix(matrix *Matrix) {
 	}
 }
 
+// SetMatrix9 sets the transform from a value-type matrix (dest coordinates -> source coordinates) without heap allocation
+func (process *ImageProcess) SetMatrix9(matrix Matrix9) {
+	if process != nil && process.c != nil {
+		C.MNN_ImageProcess_setMatrix9(process.c, matrix.toC())
+	}
+}
+
 // Convert converts the source image data to the destination tensor
 func (process *ImageProcess) Convert(source []byte, iw, ih, stride int, dest *Tensor) ErrorCode {
 	cSource := (*C.uint8_t)(unsafe.Pointer(&source[0]))
@@ -203,6 +210,38 @@ func (process *ImageProcess) ConvertV2(source []byte, iw, ih, stride int, dest [
 	return ErrorCode(result)
 }
 
+// ConvertQuant converts the source image straight to a low-precision destination (float16, or int8/uint8 quantized
+// as round(v/scale)+zeroPoint) in the same pass as resize and normalization. outputStride is in elements (0 for packed rows).
+// It shifts the process matrix per tile, so the process must not be used from another goroutine meanwhile.
+func (process *ImageProcess) ConvertQuant(source []byte, iw, ih, stride int, dest []byte, ow, oh, outputBpp, outputStride int, dataType HalideType, scale float32, zeroPoint int) ErrorCode {
+	if process == nil || process.c == nil || len(source) == 0 || len(dest) == 0 {
+		return ErrorCode(C.MNN_INVALID_VALUE)
+	}
+	cType := C.halide_type_t{
+		code:  C.halide_type_code_t(C.uint8_t(dataType.Code)),
+		bits:  C.uint8_t(dataType.Bits),
+		lanes: C.uint16_t(dataType.Lanes),
+	}
+
+	result := C.MNN_ImageProcess_convertQuant(
+		process.c,
+		(*C.uint8_t)(unsafe.Pointer(&source[0])),
+		C.int(iw),
+		C.int(ih),
+		C.int(stride),
+		unsafe.Pointer(&dest[0]),
+		C.int(ow),
+		C.int(oh),
+		C.int(outputBpp),
+		C.int(outputStride),
+		cType,
+		C.float(scale),
+		C.int(zeroPoint),
+	)
+
+	return ErrorCode(result)
+}
+
 // CreateImageTensor creates a new tensor for image data
 func CreateImageTensor(dataType HalideType, w, h, bpp int, p unsafe.Pointer) *Tensor {
 	cType := C.halide_type_t{
@@ -73,8 +73,10 @@ extern void set_go_info_callbacks(
 */
 import "C"
 import (
+	"context"
 	"fmt"
 	"runtime"
+	"time"
 	"unsafe"
 )
 
@@ -352,6 +354,18 @@ func CreateInterpreterFromBuffer(buffer []byte) *Interpreter {
 	return &Interpreter{c: cInterpreter}
 }
 
+// CreateReplica creates an independent interpreter from the model buffer of i, so its sessions do not
+// serialize with the sessions of i. Session modes, hints, cache and external files are not copied.
+// Returns nil when the model of i was released.
+func (i *Interpreter) CreateReplica() *Interpreter {
+	cInterpreter := C.MNN_Interpreter_createReplica(i.c)
+	if cInterpreter == nil {
+		return nil
+	}
+
+	return &Interpreter{c: cInterpreter}
+}
+
 // Destroy destroys the interpreter
 func (i *Interpreter) Close() {
 	if i.c != nil {
@@ -461,6 +475,89 @@ func (i *Interpreter) RunSession(session *Session) ErrorCode {
 	return ErrorCode(C.MNN_Interpreter_runSession(i.c, session.c))
 }
 
+// CancelToken stops a running session at the next op boundary when cancelled
+type CancelToken struct {
+	c *C.MNN_CancelToken
+}
+
+// NewCancelToken creates a token
+func NewCancelToken() *CancelToken {
+	return &CancelToken{c: C.MNN_CancelToken_create()}
+}
+
+// Close frees the token; it must not be in use by a running session
+func (t *CancelToken) Close() {
+	if t != nil && t.c != nil {
+		C.MNN_CancelToken_destroy(t.c)
+		t.c = nil
+	}
+}
+
+// Cancel may be called from any goroutine
+func (t *CancelToken) Cancel() {
+	C.MNN_CancelToken_cancel(t.c)
+}
+
+// Cancelled reports whether Cancel was called since creation or the last Reset
+func (t *CancelToken) Cancelled() bool {
+	return B2Go(C.MNN_CancelToken_isCancelled(t.c))
+}
+
+// Reset clears the token for reuse
+func (t *CancelToken) Reset() {
+	C.MNN_CancelToken_reset(t.c)
+}
+
+// RunSessionWithDeadline runs session, returning DEADLINE_EXCEEDED or CANCELLED if stopped early.
+// A zero timeout means no deadline; token may be nil.
+func (i *Interpreter) RunSessionWithDeadline(session *Session, timeout time.Duration, token *CancelToken) ErrorCode {
+	var cToken *C.MNN_CancelToken
+	if token != nil {
+		cToken = token.c
+	}
+	var timeoutUs C.uint64_t
+	if timeout > 0 {
+		timeoutUs = C.uint64_t(timeout / time.Microsecond)
+		if timeoutUs == 0 {
+			timeoutUs = 1
+		}
+	}
+	return ErrorCode(C.MNN_Interpreter_runSessionWithDeadline(i.c, session.c, timeoutUs, cToken))
+}
+
+// RunSessionContext runs session until it completes, ctx's deadline passes or ctx is cancelled
+func (i *Interpreter) RunSessionContext(ctx context.Context, session *Session) ErrorCode {
+	var timeout time.Duration
+	if deadline, ok := ctx.Deadline(); ok {
+		timeout = time.Until(deadline)
+		if timeout <= 0 {
+			return DEADLINE_EXCEEDED
+		}
+	}
+	if ctx.Done() == nil {
+		return i.RunSessionWithDeadline(session, timeout, nil)
+	}
+	token := NewCancelToken()
+	defer token.Close()
+	stop := make(chan struct{})
+	watched := make(chan struct{})
+	go func() {
+		defer close(watched)
+		select {
+		case <-ctx.Done():
+			token.Cancel()
+		case <-stop:
+		}
+	}()
+	code := i.RunSessionWithDeadline(session, timeout, token)
+	close(stop)
+	<-watched
+	if code == CANCELLED && ctx.Err() == context.DeadlineExceeded {
+		return DEADLINE_EXCEEDED
+	}
+	return code
+}
+
 // GetSessionInput gets session input tensor
 func (i *Interpreter) GetSessionInput(session *Session, name string) *Tensor {
 	var cName *C.char
@@ -544,65 +544,50 @@ func (m *Matrix) SetAffine(affine [6]float32) {
 
 // MapPoints 映射点数组
 func (m *Matrix) MapPoints(src []Point) (dst []Point) {
-	/*if len(src) == 0 {
-		return nil
-	}
-	count := len(src)
-	cSrc := make([]C.MNN_Point, count)
-	for i := 0; i < count; i++ {
-		cSrc[i] = C.MNN_Point{x: C.float(src[i].X), y: C.float(src[i].Y)}
-	}
-	cDst := make([]C.MNN_Point, count)
-	C.MNN_Matrix_mapPoints(m.UnsafeC(), &cDst[0], &cSrc[0], C.int(count))
-	dst := make([]Point, count)
-	for i := 0; i < count; i++ {
-		dst[i] = Point{X: float32(cDst[i].x), Y: float32(cDst[i].y)}
-	}
-	return dst*/
+	dst = make([]Point, len(src))
+	m.MapPointsTo(dst, src) // dst 与 src 等长，不会出错
+	return dst
+}
 
-	for i, p := range src {
-		dst[i] = m.MapXY(p.X, p.Y)
+// MapPointsTo 映射点数组到调用方提供的 dst（len(dst) 须不小于 len(src)），避免每帧分配
+func (m *Matrix) MapPointsTo(dst, src []Point) error {
+	if len(dst) < len(src) {
+		return errors.New("dst is shorter than src")
 	}
-	return dst
+	if len(src) == 0 {
+		return nil
+	}
+	C.MNN_Matrix_mapPoints(m.UnsafeC(), dst[0].UnsafeC(), src[0].UnsafeC(), C.int(len(src)))
+	return nil
 }
 
 // MapPointsInPlace 原地映射点数组
 func (m *Matrix) MapPointsInPlace(pts []Point) {
-	/*if len(pts) == 0 {
+	if len(pts) == 0 {
 		return
 	}
-	count := len(pts)
-	cPts := make([]C.MNN_Point, count)
-	for i := 0; i < count; i++ {
-		cPts[i] = C.MNN_Point{x: C.float(pts[i].X), y: C.float(pts[i].Y)}
-	}
-	C.MNN_Matrix_mapPointsInPlace(m.UnsafeC(), &cPts[0], C.int(count))
-	for i := 0; i < count; i++ {
-		pts[i] = Point{X: float32(cPts[i].x), Y: float32(cPts[i].y)}
-	}*/
+	C.MNN_Matrix_mapPointsInPlace(m.UnsafeC(), pts[0].UnsafeC(), C.int(len(pts)))
+}
 
-	// 直接遍历切片下标，原地修改原切片的每个元素
-	for i := range pts {
-		// 对 pts[i] 执行矩阵坐标变换，结果直接写回原位置
-		pts[i] = m.MapXY(pts[i].X, pts[i].Y) // 替换成你实际的单点映射方法
+// MapFloat32s 映射扁平坐标数组 {x0, y0, x1, y1, ...}（如关键点输出），dst 与 src 可以是同一切片
+func (m *Matrix) MapFloat32s(dst, src []float32) error {
+	if len(src)%2 != 0 {
+		return errors.New("point array length must be even")
 	}
+	if len(dst) < len(src) {
+		return errors.New("dst is shorter than src")
+	}
+	if len(src) == 0 {
+		return nil
+	}
+	C.MNN_Matrix_mapPointsFloat(m.UnsafeC(), (*C.float)(unsafe.Pointer(&dst[0])), (*C.float)(unsafe.Pointer(&src[0])), C.int(len(src)/2))
+	return nil
 }
 
 // MapXY 映射单个点
 func (m *Matrix) MapXY(x, y float32) Point {
-	/*cP := C.MNN_Matrix_mapXY(m.UnsafeC(), C.float(x), C.float(y))
-	return Point{X: float32(cP.x), Y: float32(cP.y)}*/
-
-	mat := m.fMat
-	// 齐次坐标计算
-	w := mat[6]*x + mat[7]*y + mat[8]
-	if w == 0 {
-		return Point{0, 0}
-	}
-
-	nx := (mat[0]*x + mat[1]*y + mat[2]) / w
-	ny := (mat[3]*x + mat[4]*y + mat[5]) / w
-	return Point{nx, ny}
+	cP := C.MNN_Matrix_mapXY(m.UnsafeC(), C.float(x), C.float(y))
+	return Point{X: float32(cP.x), Y: float32(cP.y)}
 }
 
 // MapRect 映射矩形
@@ -806,3 +791,112 @@ func (m *Matrix) String() string {
 		m.fMat[6], m.fMat[7], m.fMat[8],
 	)
 }
+
+// -------------------------- 值类型矩阵（无堆分配） --------------------------
+
+// Matrix9 值类型矩阵，与C的MNN_Matrix9内存布局一致；按值传递，无需Close
+type Matrix9 struct {
+	M [9]float32 // [scaleX, skewX, transX, skewY, scaleY, transY, persp0, persp1, persp2]
+}
+
+// Letterbox 等比缩放+居中填充变换（与C的MNN_Letterbox内存布局一致）
+type Letterbox struct {
+	Forward Matrix9 // 源图像坐标 -> 模型输入坐标
+	Inverse Matrix9 // 模型输入坐标 -> 源图像坐标（传给ImageProcess.SetMatrix9，或把检测结果映射回源图）
+	Scale   float32 // 等比缩放系数
+	PadX    float32 // 左侧填充
+	PadY    float32 // 顶部填充
+}
+
+// Go -> C 值转换
+func (m Matrix9) toC() C.MNN_Matrix9 {
+	return *(*C.MNN_Matrix9)(unsafe.Pointer(&m))
+}
+
+// C -> Go 值转换
+func fromCMatrix9(c C.MNN_Matrix9) Matrix9 {
+	return *(*Matrix9)(unsafe.Pointer(&c))
+}
+
+// Matrix9Identity 单位矩阵
+func Matrix9Identity() Matrix9 {
+	return fromCMatrix9(C.MNN_Matrix9_Identity())
+}
+
+// Matrix9MakeScale 缩放矩阵
+func Matrix9MakeScale(sx, sy float32) Matrix9 {
+	return fromCMatrix9(C.MNN_Matrix9_MakeScale(C.float(sx), C.float(sy)))
+}
+
+// Matrix9MakeTrans 平移矩阵
+func Matrix9MakeTrans(dx, dy float32) Matrix9 {
+	return fromCMatrix9(C.MNN_Matrix9_MakeTrans(C.float(dx), C.float(dy)))
+}
+
+// Matrix9MakeScaleTranslate 缩放+平移矩阵
+func Matrix9MakeScaleTranslate(sx, sy, tx, ty float32) Matrix9 {
+	return fromCMatrix9(C.MNN_Matrix9_MakeScaleTranslate(C.float(sx), C.float(sy), C.float(tx), C.float(ty)))
+}
+
+// Matrix9MakeRectToRect 矩形映射矩阵
+func Matrix9MakeRectToRect(src, dst Rect, stf MNN_Matrix_ScaleToFit) Matrix9 {
+	return fromCMatrix9(C.MNN_Matrix9_MakeRectToRect(*src.UnsafeC(), *dst.UnsafeC(), C.MNN_Matrix_ScaleToFit(stf)))
+}
+
+// Matrix9Letterbox 计算把 srcW x srcH 图像等比缩放并居中放入 dstW x dstH 输入的正/逆变换
+func Matrix9Letterbox(srcW, srcH, dstW, dstH int) Letterbox {
+	c := C.MNN_Matrix9_Letterbox(C.int(srcW), C.int(srcH), C.int(dstW), C.int(dstH))
+	return *(*Letterbox)(unsafe.Pointer(&c))
+}
+
+// Concat 返回 m*other（先应用other，再应用m）
+func (m Matrix9) Concat(other Matrix9) Matrix9 {
+	return fromCMatrix9(C.MNN_Matrix9_Concat(m.toC(), other.toC()))
+}
+
+// Invert 矩阵求逆，不可逆时返回false
+func (m Matrix9) Invert() (Matrix9, bool) {
+	var inv C.MNN_Matrix9
+	ok := C.MNN_Matrix9_Invert(m.toC(), &inv)
+	return fromCMatrix9(inv), bool(ok)
+}
+
+// GetType 获取矩阵类型掩码
+func (m Matrix9) GetType() MNN_Matrix_TypeMask {
+	return MNN_Matrix_TypeMask(C.MNN_Matrix9_getType(m.toC()))
+}
+
+// MapXY 映射单个点
+func (m Matrix9) MapXY(x, y float32) Point {
+	cP := C.MNN_Matrix9_MapXY(m.toC(), C.float(x), C.float(y))
+	return Point{X: float32(cP.x), Y: float32(cP.y)}
+}
+
+// MapRect 映射矩形（取四个顶点映射后的包围盒）
+func (m Matrix9) MapRect(src Rect) Rect {
+	cDst := C.MNN_Matrix9_MapRect(m.toC(), *src.UnsafeC())
+	return *FromCRect(&cDst)
+}
+
+// MapFloat32s 映射扁平坐标数组 {x0, y0, x1, y1, ...}，dst 与 src 可以是同一切片
+func (m Matrix9) MapFloat32s(dst, src []float32) error {
+	if len(src)%2 != 0 {
+		return errors.New("point array length must be even")
+	}
+	if len(dst) < len(src) {
+		return errors.New("dst is shorter than src")
+	}
+	if len(src) == 0 {
+		return nil
+	}
+	cM := m.toC()
+	C.MNN_Matrix9_MapPoints(&cM, (*C.float)(unsafe.Pointer(&dst[0])), (*C.float)(unsafe.Pointer(&src[0])), C.int(len(src)/2))
+	return nil
+}
+
+// ToMatrix 转换为需要Close的堆矩阵（兼容旧接口）
+func (m Matrix9) ToMatrix() *Matrix {
+	mat := NewMatrix()
+	mat.Set9(m.M)
+	return mat
+}
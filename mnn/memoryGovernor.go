@@ -0,0 +1,120 @@
+package mnn
+
+/*
+#include "MemoryGovernor_c.h"
+*/
+import "C"
+
+// MemoryGovernorConfig sets the process-wide session memory budget
+type MemoryGovernorConfig struct {
+	BudgetMB     float32
+	CollectFirst bool // try a MEMORY_COLLECT resize before releasing a session
+}
+
+// MemoryGovernorStats is a snapshot of the governor's accounting
+type MemoryGovernorStats struct {
+	BudgetMB  float32
+	UsedMB    float32
+	Sessions  int
+	Resident  int
+	Evictions uint64
+	Recreates uint64
+	Collects  uint64
+}
+
+// MemoryGovernor keeps managed sessions under a memory budget, evicting idle ones in LRU order
+type MemoryGovernor struct {
+	c *C.struct_MNN_MemoryGovernor
+}
+
+// GovernedSession is a session that may be evicted and transparently recreated
+type GovernedSession struct {
+	c   *C.struct_MNN_GovernedSession
+	net *Interpreter
+}
+
+// NewMemoryGovernor creates a governor
+func NewMemoryGovernor(config MemoryGovernorConfig) *MemoryGovernor {
+	cConfig := C.MNN_MemoryGovernorConfig{
+		budgetMB:     C.float(config.BudgetMB),
+		collectFirst: B2C(config.CollectFirst),
+	}
+	return &MemoryGovernor{c: C.MNN_MemoryGovernor_create(&cConfig)}
+}
+
+// Close releases every session still managed
+func (g *MemoryGovernor) Close() {
+	if g != nil && g.c != nil {
+		C.MNN_MemoryGovernor_destroy(g.c)
+		g.c = nil
+	}
+}
+
+// SetBudget changes the budget and evicts as needed
+func (g *MemoryGovernor) SetBudget(budgetMB float32) {
+	C.MNN_MemoryGovernor_setBudget(g.c, C.float(budgetMB))
+}
+
+// Enforce evicts idle sessions; RESOURCE_EXHAUSTED means still over budget
+func (g *MemoryGovernor) Enforce() ErrorCode {
+	return ErrorCode(C.MNN_MemoryGovernor_enforce(g.c))
+}
+
+// Stats returns the current accounting
+func (g *MemoryGovernor) Stats() MemoryGovernorStats {
+	var cStats C.MNN_MemoryGovernorStats
+	C.MNN_MemoryGovernor_getStats(g.c, &cStats)
+	return MemoryGovernorStats{
+		BudgetMB:  float32(cStats.budgetMB),
+		UsedMB:    float32(cStats.usedMB),
+		Sessions:  int(cStats.sessions),
+		Resident:  int(cStats.resident),
+		Evictions: uint64(cStats.evictions),
+		Recreates: uint64(cStats.recreates),
+		Collects:  uint64(cStats.collects),
+	}
+}
+
+// Register creates a managed session of net; the model must not be released with ReleaseModel
+func (g *MemoryGovernor) Register(net *Interpreter, config *ScheduleConfig) *GovernedSession {
+	cConfig := config.ToCScheduleConfig()
+	defer config.Unpin()
+	cSession := C.MNN_MemoryGovernor_register(g.c, net.c, &cConfig)
+	if cSession == nil {
+		return nil
+	}
+	return &GovernedSession{c: cSession, net: net}
+}
+
+// Close releases the session and stops managing it, waiting until every Acquire has been released
+func (s *GovernedSession) Close() {
+	if s != nil && s.c != nil {
+		C.MNN_GovernedSession_unregister(s.c)
+		s.c = nil
+	}
+}
+
+// Acquire pins the session, recreating it if it was evicted; the Session is valid until Release
+func (s *GovernedSession) Acquire() (*Session, ErrorCode) {
+	var code C.MNN_ErrorCode
+	cSession := C.MNN_GovernedSession_acquire(s.c, &code)
+	if cSession == nil {
+		return nil, ErrorCode(code)
+	}
+	return &Session{c: cSession, Interpreter: s.net}, ErrorCode(code)
+}
+
+// Release unpins the session, re-measures it and enforces the budget
+func (s *GovernedSession) Release() {
+	C.MNN_GovernedSession_release(s.c)
+}
+
+// FootprintMB returns the last measured footprint, 0 while evicted
+func (s *GovernedSession) FootprintMB() float32 {
+	return float32(C.MNN_GovernedSession_footprintMB(s.c))
+}
+
+// Resident reports whether the session is currently in memory
+func (s *GovernedSession) Resident() bool {
+	return B2Go(C.MNN_GovernedSession_resident(s.c))
+}
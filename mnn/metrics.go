@@ -0,0 +1,100 @@
+package mnn
+
+/*
+#include "Metrics_c.h"
+#include <stdlib.h>
+*/
+import "C"
+import "unsafe"
+
+// MetricOp 指标记录的操作类型
+type MetricOp int
+
+const (
+	METRIC_OP_RUN            MetricOp = C.MNN_METRIC_OP_RUN
+	METRIC_OP_RESIZE         MetricOp = C.MNN_METRIC_OP_RESIZE
+	METRIC_OP_COPY_IN        MetricOp = C.MNN_METRIC_OP_COPY_IN
+	METRIC_OP_COPY_OUT       MetricOp = C.MNN_METRIC_OP_COPY_OUT
+	METRIC_OP_CALLBACK       MetricOp = C.MNN_METRIC_OP_CALLBACK
+	METRIC_OP_CREATE_SESSION MetricOp = C.MNN_METRIC_OP_CREATE_SESSION
+)
+
+// MetricSeries is the latency summary of one (model, session, op)
+type MetricSeries struct {
+	Model   string
+	BizCode string
+	Session int // index among the model's live sessions, reused after release
+	Op      MetricOp
+	Count   uint64
+	SumMs   float64
+	P50Ms   float64
+	P90Ms   float64
+	P99Ms   float64
+	P999Ms  float64
+	MaxMs   float64
+}
+
+// SetMetricsEnabled turns native latency recording on or off for the whole process
+func SetMetricsEnabled(enabled bool) {
+	C.MNN_Metrics_setEnabled(B2C(enabled))
+}
+
+// MetricsEnabled reports whether native latency recording is on
+func MetricsEnabled() bool {
+	return B2Go(C.MNN_Metrics_isEnabled())
+}
+
+// ResetMetrics zeroes all counters
+func ResetMetrics() {
+	C.MNN_Metrics_reset()
+}
+
+// MetricsSnapshot returns every series that has recorded at least one sample
+func MetricsSnapshot() []MetricSeries {
+	count := int(C.MNN_Metrics_snapshot(nil, 0))
+	for count > 0 {
+		cSeries := make([]C.MNN_MetricSeries, count)
+		n := int(C.MNN_Metrics_snapshot(&cSeries[0], C.int(count)))
+		if n > count {
+			// 快照期间出现了新的序列，按新数量重取
+			count = n
+			continue
+		}
+		series := make([]MetricSeries, n)
+		for i := 0; i < n; i++ {
+			c := &cSeries[i]
+			series[i] = MetricSeries{
+				Model:   C.GoString(&c.model[0]),
+				BizCode: C.GoString(&c.bizCode[0]),
+				Session: int(c.session),
+				Op:      MetricOp(c.op),
+				Count:   uint64(c.count),
+				SumMs:   float64(c.sumMs),
+				P50Ms:   float64(c.p50Ms),
+				P90Ms:   float64(c.p90Ms),
+				P99Ms:   float64(c.p99Ms),
+				P999Ms:  float64(c.p999Ms),
+				MaxMs:   float64(c.maxMs),
+			}
+		}
+		return series
+	}
+	return nil
+}
+
+// MetricsPrometheus renders all series in Prometheus text exposition format
+func MetricsPrometheus() string {
+	size := C.MNN_Metrics_prometheus(nil, 0)
+	for {
+		buffer := (*C.char)(C.malloc(size + 1))
+		n := C.MNN_Metrics_prometheus(buffer, size+1)
+		if n > size {
+			C.free(unsafe.Pointer(buffer))
+			size = n
+			continue
+		}
+		text := C.GoStringN(buffer, C.int(n))
+		C.free(unsafe.Pointer(buffer))
+		return text
+	}
+}
@@ -0,0 +1,122 @@
+package mnn
+
+/*
+#include <stdlib.h>
+#include "ModelHandle_c.h"
+*/
+import "C"
+import (
+	"unsafe"
+)
+
+// ModelHandle is a versioned model that can be reloaded without dropping in-flight requests
+type ModelHandle struct {
+	c *C.struct_MNN_ModelHandle
+}
+
+// ModelLease is exclusive use of one session of one model version
+type ModelLease struct {
+	c       *C.struct_MNN_ModelLease
+	session *Session
+}
+
+// NewModelHandle creates an empty handle; sessionCount sessions are created per version, each on its own interpreter
+// so they run concurrently, and each is run warmupRuns times before publishing
+func NewModelHandle(config *ScheduleConfig, sessionCount, warmupRuns int) *ModelHandle {
+	cConfig := config.ToCScheduleConfig()
+	defer config.Unpin()
+	cHandle := C.MNN_ModelHandle_create(&cConfig, C.int(sessionCount), C.int(warmupRuns))
+	if cHandle == nil {
+		return nil
+	}
+	return &ModelHandle{c: cHandle}
+}
+
+// Close destroys the handle; leased versions are released with their last lease
+func (h *ModelHandle) Close() {
+	if h != nil && h.c != nil {
+		C.MNN_ModelHandle_destroy(h.c)
+		h.c = nil
+	}
+}
+
+// SetSessionHint applies hint to the interpreters of every version loaded afterwards
+func (h *ModelHandle) SetSessionHint(hint HintMode, value int) {
+	C.MNN_ModelHandle_setSessionHint(h.c, C.enum_MNN_HintMode(hint), C.int(value))
+}
+
+// SetSessionMode applies mode to the interpreters of every version loaded afterwards
+func (h *ModelHandle) SetSessionMode(mode SessionMode) {
+	C.MNN_ModelHandle_setSessionMode(h.c, C.enum_MNN_SessionMode(mode))
+}
+
+// LoadFile builds, warms and publishes a new version from file; requests keep using the current version meanwhile
+func (h *ModelHandle) LoadFile(file string) (uint64, ErrorCode) {
+	cFile := C.CString(file)
+	defer C.free(unsafe.Pointer(cFile))
+	var version C.uint64_t
+	code := C.MNN_ModelHandle_loadFile(h.c, cFile, &version)
+	return uint64(version), ErrorCode(code)
+}
+
+// LoadBuffer builds, warms and publishes a new version from a model buffer
+func (h *ModelHandle) LoadBuffer(buffer []byte) (uint64, ErrorCode) {
+	if len(buffer) == 0 {
+		return 0, ErrorCode(C.MNN_INVALID_VALUE)
+	}
+	var version C.uint64_t
+	code := C.MNN_ModelHandle_loadBuffer(h.c, unsafe.Pointer(&buffer[0]), C.size_t(len(buffer)), &version)
+	return uint64(version), ErrorCode(code)
+}
+
+// ReloadFile loads file in the background; the channel receives the result once the new version is published or has failed
+func (h *ModelHandle) ReloadFile(file string) <-chan ErrorCode {
+	done := make(chan ErrorCode, 1)
+	go func() {
+		_, code := h.LoadFile(file)
+		done <- code
+	}()
+	return done
+}
+
+// Version returns the published version number, 0 before the first load
+func (h *ModelHandle) Version() uint64 {
+	return uint64(C.MNN_ModelHandle_version(h.c))
+}
+
+// Acquire leases a free session of the current version, blocking while all are leased; nil before the first load
+func (h *ModelHandle) Acquire() *ModelLease {
+	cLease := C.MNN_ModelHandle_acquire(h.c)
+	if cLease == nil {
+		return nil
+	}
+	net := &Interpreter{c: C.MNN_ModelLease_interpreter(cLease)}
+	return &ModelLease{
+		c:       cLease,
+		session: &Session{c: C.MNN_ModelLease_session(cLease), Interpreter: net},
+	}
+}
+
+// Session returns the leased session; it is owned by the handle and must not be closed
+func (l *ModelLease) Session() *Session {
+	return l.session
+}
+
+// Version returns the model version the lease belongs to
+func (l *ModelLease) Version() uint64 {
+	return uint64(C.MNN_ModelLease_version(l.c))
+}
+
+// Run runs the leased session
+func (l *ModelLease) Run() ErrorCode {
+	return ErrorCode(C.MNN_ModelLease_run(l.c))
+}
+
+// Release returns the session; the last lease of a replaced version hands it to a background thread to free
+func (l *ModelLease) Release() {
+	if l != nil && l.c != nil {
+		C.MNN_ModelLease_release(l.c)
+		l.c = nil
+		l.session = nil
+	}
+}
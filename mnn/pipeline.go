@@ -0,0 +1,107 @@
+package mnn
+
+/*
+#include <stdlib.h>
+#include "Pipeline_c.h"
+*/
+import "C"
+import (
+	"runtime"
+	"unsafe"
+)
+
+// PipelineStage is one segment of the model, cut at the named tensors
+type PipelineStage struct {
+	Inputs    []string // model inputs or outputs of earlier stages
+	Outputs   []string // cut tensors or model outputs
+	Cores     []int    // logical CPUs the stage is pinned to, may be empty
+	NumThread int      // <= 0 for len(Cores), or config.NumThread when Cores is empty too
+}
+
+// Pipeline streams requests through model stages running on their own threads
+type Pipeline struct {
+	c *C.struct_MNN_Pipeline
+}
+
+// PipelineFrame carries one request through the pipeline
+type PipelineFrame struct {
+	c *C.struct_MNN_PipelineFrame
+}
+
+// NewPipeline splits net into stages; depth is the number of requests in flight (<= 0 for the stage count).
+// Shapes are fixed at creation: later stages take their input shapes from the stages before them.
+func NewPipeline(net *Interpreter, stages []PipelineStage, config *ScheduleConfig, depth int) *Pipeline {
+	if net == nil || len(stages) == 0 || config == nil {
+		return nil
+	}
+	var pinner runtime.Pinner
+	defer pinner.Unpin()
+	cStages := make([]C.MNN_PipelineStage, len(stages))
+	for i, stage := range stages {
+		cStages[i].inputs = ToCStringArray(stage.Inputs)
+		defer FreeCStringArray(&cStages[i].inputs)
+		cStages[i].outputs = ToCStringArray(stage.Outputs)
+		defer FreeCStringArray(&cStages[i].outputs)
+		if len(stage.Cores) > 0 {
+			cores := make([]C.int, len(stage.Cores))
+			for j, core := range stage.Cores {
+				cores[j] = C.int(core)
+			}
+			pinner.Pin(&cores[0])
+			cStages[i].cores = &cores[0]
+			cStages[i].coreCount = C.int(len(cores))
+		}
+		cStages[i].numThread = C.int(stage.NumThread)
+	}
+	cConfig := config.ToCScheduleConfig()
+	defer config.Unpin()
+	cPipeline := C.MNN_Pipeline_create(net.c, &cStages[0], C.int(len(stages)), &cConfig, C.int(depth))
+	if cPipeline == nil {
+		return nil
+	}
+	return &Pipeline{c: cPipeline}
+}
+
+// Close finishes the frames already submitted and releases the stage sessions
+func (p *Pipeline) Close() {
+	if p != nil && p.c != nil {
+		C.MNN_Pipeline_destroy(p.c)
+		p.c = nil
+	}
+}
+
+// AcquireFrame takes a free frame, blocking while all frames are in flight
+func (p *Pipeline) AcquireFrame() *PipelineFrame {
+	cFrame := C.MNN_Pipeline_acquireFrame(p.c)
+	if cFrame == nil {
+		return nil
+	}
+	return &PipelineFrame{c: cFrame}
+}
+
+// Submit pushes the frame into the first stage and returns immediately
+func (p *Pipeline) Submit(frame *PipelineFrame) {
+	C.MNN_Pipeline_submit(p.c, frame.c)
+}
+
+// ReleaseFrame returns a finished frame to the pipeline
+func (p *Pipeline) ReleaseFrame(frame *PipelineFrame) {
+	C.MNN_Pipeline_releaseFrame(p.c, frame.c)
+	frame.c = nil
+}
+
+// Tensor returns the frame's host tensor for name: fill inputs before Submit, read outputs after Wait
+func (f *PipelineFrame) Tensor(name string) *Tensor {
+	cName := C.CString(name)
+	defer C.free(unsafe.Pointer(cName))
+	cTensor := C.MNN_PipelineFrame_tensor(f.c, cName)
+	if cTensor == nil {
+		return nil
+	}
+	return &Tensor{c: cTensor}
+}
+
+// Wait blocks until the frame has passed the last stage or a stage failed
+func (f *PipelineFrame) Wait() ErrorCode {
+	return ErrorCode(C.MNN_PipelineFrame_wait(f.c))
+}
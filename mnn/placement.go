@@ -0,0 +1,138 @@
+package mnn
+
+/*
+#include "Placement_c.h"
+*/
+import "C"
+import (
+	"unsafe"
+)
+
+// PlacementConfig controls how cores are partitioned into sets
+type PlacementConfig struct {
+	ThreadsPerSet int  // threads per core set, <= 0 for one set per NUMA node
+	UseSmt        bool // also use SMT sibling threads
+}
+
+// CoreSetInfo describes one core set
+type CoreSetInfo struct {
+	Node      int
+	Socket    int
+	CoreCount int
+	Load      int
+}
+
+// Placement partitions the machine's CPUs into node-local core sets discovered from sysfs
+type Placement struct {
+	c *C.struct_MNN_Placement
+}
+
+// PlacedModel holds one session of a model per core set of a Placement
+type PlacedModel struct {
+	c    *C.struct_MNN_PlacedModel
+	nets []*Interpreter // per core set; owned by the C model, never closed here
+}
+
+// NewPlacement discovers the CPU topology; config may be nil for one set per NUMA node without SMT siblings
+func NewPlacement(config *PlacementConfig) *Placement {
+	if config == nil {
+		return &Placement{c: C.MNN_Placement_create(nil)}
+	}
+	cConfig := C.MNN_PlacementConfig{
+		threadsPerSet: C.int(config.ThreadsPerSet),
+		useSmt:        B2C(config.UseSmt),
+	}
+	return &Placement{c: C.MNN_Placement_create(&cConfig)}
+}
+
+// Close destroys the placement; all PlacedModels must be closed first
+func (p *Placement) Close() {
+	if p != nil && p.c != nil {
+		C.MNN_Placement_destroy(p.c)
+		p.c = nil
+	}
+}
+
+// SetCount returns the number of core sets
+func (p *Placement) SetCount() int {
+	return int(C.MNN_Placement_setCount(p.c))
+}
+
+// NodeCount returns the number of NUMA nodes covered by the sets
+func (p *Placement) NodeCount() int {
+	return int(C.MNN_Placement_nodeCount(p.c))
+}
+
+// SetInfo returns the description and current load of a core set
+func (p *Placement) SetInfo(index int) (CoreSetInfo, bool) {
+	var cInfo C.MNN_CoreSetInfo
+	if !B2Go(C.MNN_Placement_getSetInfo(p.c, C.int(index), &cInfo)) {
+		return CoreSetInfo{}, false
+	}
+	return CoreSetInfo{
+		Node:      int(cInfo.node),
+		Socket:    int(cInfo.socket),
+		CoreCount: int(cInfo.coreCount),
+		Load:      int(cInfo.load),
+	}, true
+}
+
+// SetCores returns the logical CPU ids of a core set (empty when nothing is pinned)
+func (p *Placement) SetCores(index int) []int {
+	count := int(C.MNN_Placement_getSetCores(p.c, C.int(index), nil, 0))
+	if count <= 0 {
+		return nil
+	}
+	cores := make([]C.int, count)
+	C.MNN_Placement_getSetCores(p.c, C.int(index), (*C.int)(unsafe.Pointer(&cores[0])), C.int(count))
+	result := make([]int, count)
+	for i, core := range cores {
+		result[i] = int(core)
+	}
+	return result
+}
+
+// NewPlacedModel creates one session per core set, each pinned through the CPU_CORE_IDS hint.
+// The first set uses net, the others own replicas of it so that sets run in parallel; net's model must not be released.
+func (p *Placement) NewPlacedModel(net *Interpreter, config *ScheduleConfig) *PlacedModel {
+	cConfig := config.ToCScheduleConfig()
+	defer config.Unpin()
+	cModel := C.MNN_PlacedModel_create(p.c, net.c, &cConfig)
+	if cModel == nil {
+		return nil
+	}
+	model := &PlacedModel{c: cModel, nets: []*Interpreter{net}}
+	for i := 1; i < p.SetCount(); i++ {
+		model.nets = append(model.nets, &Interpreter{c: C.MNN_PlacedModel_interpreter(cModel, C.int(i))})
+	}
+	return model
+}
+
+// Close releases the sessions of the model
+func (m *PlacedModel) Close() {
+	if m != nil && m.c != nil {
+		C.MNN_PlacedModel_destroy(m.c)
+		m.c = nil
+	}
+}
+
+// Acquire leases the session of the least loaded core set, blocking while this model's session there is busy.
+// Fill inputs on the returned session, then call Run and Release with the returned set index.
+func (m *PlacedModel) Acquire() (*Session, int) {
+	var setIndex C.int
+	cSession := C.MNN_PlacedModel_acquire(m.c, &setIndex)
+	if cSession == nil {
+		return nil, -1
+	}
+	return &Session{c: cSession, Interpreter: m.nets[int(setIndex)]}, int(setIndex)
+}
+
+// Run runs the leased session with the calling thread pinned to its core set
+func (m *PlacedModel) Run(setIndex int) ErrorCode {
+	return ErrorCode(C.MNN_PlacedModel_run(m.c, C.int(setIndex)))
+}
+
+// Release returns the lease taken by Acquire; releasing twice is ignored
+func (m *PlacedModel) Release(setIndex int) {
+	C.MNN_PlacedModel_release(m.c, C.int(setIndex))
+}
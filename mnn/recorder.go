@@ -0,0 +1,105 @@
+package mnn
+
+/*
+#include <stdlib.h>
+#include "Recorder_c.h"
+*/
+import "C"
+import "unsafe"
+
+// Recorder captures a sample of runSession calls (inputs and latency) to an append-only file
+type Recorder struct {
+	c *C.struct_MNN_Recorder
+}
+
+// RecordReader reads a capture file written by Recorder
+type RecordReader struct {
+	c      *C.struct_MNN_RecordReader
+	record C.MNN_Record
+}
+
+// Record is one captured run; it is valid until the next call to Next
+type Record struct {
+	TimestampNs uint64 // wall clock at capture
+	LatencyNs   uint64 // runSession latency at capture
+	Model       string
+	reader      *RecordReader
+}
+
+// NewRecorder opens path for appending; sampleRate is the captured fraction in (0, 1]
+func NewRecorder(path string, sampleRate float32) *Recorder {
+	cPath := C.CString(path)
+	defer C.free(unsafe.Pointer(cPath))
+	c := C.MNN_Recorder_open(cPath, C.float(sampleRate))
+	if c == nil {
+		return nil
+	}
+	return &Recorder{c: c}
+}
+
+// Close detaches from every interpreter and closes the file
+func (r *Recorder) Close() {
+	if r != nil && r.c != nil {
+		C.MNN_Recorder_close(r.c)
+		r.c = nil
+	}
+}
+
+// SetSampleRate changes the captured fraction
+func (r *Recorder) SetSampleRate(sampleRate float32) {
+	C.MNN_Recorder_setSampleRate(r.c, C.float(sampleRate))
+}
+
+// Attach captures runs of every session of net
+func (r *Recorder) Attach(net *Interpreter) {
+	C.MNN_Recorder_attach(r.c, net.c)
+}
+
+// Detach stops capturing runs of net
+func (r *Recorder) Detach(net *Interpreter) {
+	C.MNN_Recorder_detach(r.c, net.c)
+}
+
+// Count returns the number of records written since open
+func (r *Recorder) Count() uint64 {
+	return uint64(C.MNN_Recorder_count(r.c))
+}
+
+// OpenRecordReader opens a capture file
+func OpenRecordReader(path string) *RecordReader {
+	cPath := C.CString(path)
+	defer C.free(unsafe.Pointer(cPath))
+	c := C.MNN_RecordReader_open(cPath)
+	if c == nil {
+		return nil
+	}
+	return &RecordReader{c: c}
+}
+
+// Close closes the file
+func (r *RecordReader) Close() {
+	if r != nil && r.c != nil {
+		C.MNN_RecordReader_close(r.c)
+		r.c = nil
+	}
+}
+
+// Next reads the next record; false at end of file
+func (r *RecordReader) Next() (*Record, bool) {
+	if !B2Go(C.MNN_RecordReader_next(r.c, &r.record)) {
+		return nil, false
+	}
+	return &Record{
+		TimestampNs: uint64(r.record.timestampNs),
+		LatencyNs:   uint64(r.record.latencyNs),
+		Model:       C.GoString(r.record.model),
+		reader:      r,
+	}, true
+}
+
+// Apply copies the recorded inputs into session, resizing it when a shape differs
+func (rec *Record) Apply(session *Session) (resized bool, code ErrorCode) {
+	var cResized C.MNN_BOOL
+	code = ErrorCode(C.MNN_Record_apply(session.Interpreter.c, session.c, &rec.reader.record, &cResized))
+	return B2Go(cResized), code
+}
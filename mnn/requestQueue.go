@@ -0,0 +1,132 @@
+package mnn
+
+/*
+#include <stdlib.h>
+#include "RequestQueue_c.h"
+*/
+import "C"
+import (
+	"time"
+	"unsafe"
+)
+
+// RequestQueueConfig configures a RequestQueue
+type RequestQueueConfig struct {
+	Workers     int           // worker threads, one session each
+	Capacity    int           // ring size, rounded up to a power of two
+	MaxDepth    int           // reject when this many requests are queued, <= 0 for Capacity
+	MaxQueueAge time.Duration // reject when the expected or recent queueing time exceeds it; 0 for no limit
+}
+
+// RequestQueueStats holds queue metrics
+type RequestQueueStats struct {
+	Submitted    uint64
+	RejectedFull uint64
+	RejectedAge  uint64
+	Expired      uint64 // queued longer than MaxQueueAge and failed at dequeue
+	Completed    uint64
+	Depth        int
+	MeanQueue    time.Duration
+	MaxQueue     time.Duration
+	LastQueue    time.Duration
+	Service      time.Duration // moving average of one run including copies
+}
+
+// RequestQueue is a native bounded MPMC queue in front of session workers
+type RequestQueue struct {
+	c *C.struct_MNN_RequestQueue
+}
+
+// QueueRequest carries host tensors for all model inputs and outputs; it can be submitted again after Wait
+type QueueRequest struct {
+	c *C.struct_MNN_QueueRequest
+}
+
+// NewRequestQueue creates one session per worker and starts the workers. The first worker uses net,
+// the others own replicas of it so that workers run in parallel; net's model must not be released.
+// Shapes are fixed at creation: every replica takes the first worker's input shapes.
+func NewRequestQueue(net *Interpreter, config *ScheduleConfig, cfg RequestQueueConfig) *RequestQueue {
+	cConfig := config.ToCScheduleConfig()
+	defer config.Unpin()
+	cCfg := C.MNN_RequestQueueConfig{
+		workers:       C.int(cfg.Workers),
+		capacity:      C.int(cfg.Capacity),
+		maxDepth:      C.int(cfg.MaxDepth),
+		maxQueueAgeUs: C.uint64_t(cfg.MaxQueueAge / time.Microsecond),
+	}
+	c := C.MNN_RequestQueue_create(net.c, &cConfig, &cCfg)
+	if c == nil {
+		return nil
+	}
+	return &RequestQueue{c: c}
+}
+
+// Close finishes the queued requests and releases the sessions
+func (q *RequestQueue) Close() {
+	if q != nil && q.c != nil {
+		C.MNN_RequestQueue_destroy(q.c)
+		q.c = nil
+	}
+}
+
+// NewRequest creates a request with host tensors for the model inputs and outputs
+func (q *RequestQueue) NewRequest() *QueueRequest {
+	c := C.MNN_RequestQueue_createRequest(q.c)
+	if c == nil {
+		return nil
+	}
+	return &QueueRequest{c: c}
+}
+
+// Submit enqueues the request without blocking; RESOURCE_EXHAUSTED means admission control rejected it
+func (q *RequestQueue) Submit(request *QueueRequest) ErrorCode {
+	return ErrorCode(C.MNN_RequestQueue_submit(q.c, request.c))
+}
+
+// Stats returns the queue metrics
+func (q *RequestQueue) Stats() RequestQueueStats {
+	var s C.MNN_RequestQueueStats
+	C.MNN_RequestQueue_getStats(q.c, &s)
+	us := func(v C.double) time.Duration { return time.Duration(float64(v) * float64(time.Microsecond)) }
+	return RequestQueueStats{
+		Submitted:    uint64(s.submitted),
+		RejectedFull: uint64(s.rejectedFull),
+		RejectedAge:  uint64(s.rejectedAge),
+		Expired:      uint64(s.expired),
+		Completed:    uint64(s.completed),
+		Depth:        int(s.depth),
+		MeanQueue:    us(s.meanQueueUs),
+		MaxQueue:     us(s.maxQueueUs),
+		LastQueue:    us(s.lastQueueUs),
+		Service:      us(s.serviceUs),
+	}
+}
+
+// Close frees the request's host tensors
+func (r *QueueRequest) Close() {
+	if r != nil && r.c != nil {
+		C.MNN_QueueRequest_destroy(r.c)
+		r.c = nil
+	}
+}
+
+// Tensor returns the host tensor for name: fill inputs before Submit, read outputs after Wait
+func (r *QueueRequest) Tensor(name string) *Tensor {
+	cName := C.CString(name)
+	defer C.free(unsafe.Pointer(cName))
+	cTensor := C.MNN_QueueRequest_tensor(r.c, cName)
+	if cTensor == nil {
+		return nil
+	}
+	return &Tensor{c: cTensor}
+}
+
+// Wait blocks until the submitted request has run; DEADLINE_EXCEEDED means it expired in the queue
+func (r *QueueRequest) Wait() ErrorCode {
+	return ErrorCode(C.MNN_QueueRequest_wait(r.c))
+}
+
+// QueueTime returns how long the request waited in the queue in its last submission
+func (r *QueueRequest) QueueTime() time.Duration {
+	return time.Duration(float64(C.MNN_QueueRequest_queueUs(r.c)) * float64(time.Microsecond))
+}
@@ -0,0 +1,131 @@
+package mnn
+
+/*
+#include <stdlib.h>
+#include "ResizeTuner_c.h"
+*/
+import "C"
+import (
+	"runtime"
+	"unsafe"
+)
+
+// ResizeStrategy tells how a session is resized after its input shapes change
+type ResizeStrategy int
+
+const (
+	RESIZE_STRATEGY_DEFAULT          ResizeStrategy = C.MNN_RESIZE_STRATEGY_DEFAULT          // resizeSession
+	RESIZE_STRATEGY_NO_REALLOC       ResizeStrategy = C.MNN_RESIZE_STRATEGY_NO_REALLOC       // resizeSessionEx(needRelloc = 0)
+	RESIZE_STRATEGY_FIXED            ResizeStrategy = C.MNN_RESIZE_STRATEGY_FIXED            // RESIZE_CHECK trace, then RESIZE_FIX
+	RESIZE_STRATEGY_FIXED_NO_REALLOC ResizeStrategy = C.MNN_RESIZE_STRATEGY_FIXED_NO_REALLOC // both
+	RESIZE_STRATEGY_COUNT                           = int(C.MNN_RESIZE_STRATEGY_COUNT)
+)
+
+// ResizeTrial is the measurement of one strategy over the shape sequence
+type ResizeTrial struct {
+	Strategy     ResizeStrategy
+	Error        ErrorCode // first failed run
+	Matched      bool      // every output matched the default strategy
+	MaxError     float32   // relative to the largest absolute value of the default outputs
+	Resizes      int
+	PrepareMs    float64 // session creation and the untimed (trace) pass
+	ResizeMeanMs float64 // resizeTensor + resize
+	ResizeP50Ms  float64
+	ResizeP99Ms  float64
+	ResizeMaxMs  float64
+	RunMeanMs    float64
+}
+
+// resizeShapes converts shapes to C, pinning the dims until pinner is unpinned
+func resizeShapes(shapes [][]int, pinner *runtime.Pinner) (*C.MNN_ResizeShape, C.int) {
+	if len(shapes) == 0 {
+		return nil, 0
+	}
+	cShapes := make([]C.MNN_ResizeShape, len(shapes))
+	for i, shape := range shapes {
+		if len(shape) == 0 {
+			continue
+		}
+		dims := make([]C.int, len(shape))
+		for k, d := range shape {
+			dims[k] = C.int(d)
+		}
+		pinner.Pin(&dims[0])
+		cShapes[i].dims = &dims[0]
+		cShapes[i].dimCount = C.int(len(dims))
+	}
+	return &cShapes[0], C.int(len(cShapes))
+}
+
+// TuneResize measures every strategy on a fresh session of net over the shape sequence of one input
+// (empty name for the first input) and returns the fastest one whose outputs match the default strategy,
+// with the trials indexed by strategy; -1 when the default strategy fails. Call it before creating the
+// serving sessions: RESIZE_CHECK / RESIZE_FIX apply to every session of net.
+func TuneResize(net *Interpreter, config *ScheduleConfig, input string, shapes [][]int, rounds int) (ResizeStrategy, []ResizeTrial) {
+	var pinner runtime.Pinner
+	defer pinner.Unpin()
+	cShapes, count := resizeShapes(shapes, &pinner)
+	var cInput *C.char
+	if input != "" {
+		cInput = C.CString(input)
+		defer C.free(unsafe.Pointer(cInput))
+	}
+	cConfig := config.ToCScheduleConfig()
+	defer config.Unpin()
+	var cTrials [C.MNN_RESIZE_STRATEGY_COUNT]C.MNN_ResizeTrial
+	best := C.MNN_ResizeTuner_tune(net.c, &cConfig, cInput, cShapes, count, C.int(rounds), &cTrials[0])
+	trials := make([]ResizeTrial, len(cTrials))
+	for i, t := range cTrials {
+		trials[i] = ResizeTrial{
+			Strategy:     ResizeStrategy(t.strategy),
+			Error:        ErrorCode(t.error),
+			Matched:      B2Go(t.matched),
+			MaxError:     float32(t.maxError),
+			Resizes:      int(t.resizes),
+			PrepareMs:    float64(t.prepareMs),
+			ResizeMeanMs: float64(t.resizeMeanMs),
+			ResizeP50Ms:  float64(t.resizeP50Ms),
+			ResizeP99Ms:  float64(t.resizeP99Ms),
+			ResizeMaxMs:  float64(t.resizeMaxMs),
+			RunMeanMs:    float64(t.runMeanMs),
+		}
+	}
+	return ResizeStrategy(best), trials
+}
+
+// PrepareResize gets a new session ready for the strategy; the FIXED strategies trace the shapes here
+// and leave the session at the last one. Only valid when s is the only session of its interpreter;
+// otherwise use PrepareResizeAll.
+func (s *Session) PrepareResize(strategy ResizeStrategy, input string, shapes [][]int) ErrorCode {
+	return PrepareResizeAll([]*Session{s}, strategy, input, shapes)
+}
+
+// PrepareResizeAll gets all serving sessions of one interpreter ready for the strategy in one trace,
+// before any of them serves: RESIZE_CHECK / RESIZE_FIX apply to every session of the interpreter
+func PrepareResizeAll(sessions []*Session, strategy ResizeStrategy, input string, shapes [][]int) ErrorCode {
+	if len(sessions) == 0 {
+		return INVALID_VALUE
+	}
+	var pinner runtime.Pinner
+	defer pinner.Unpin()
+	cShapes, count := resizeShapes(shapes, &pinner)
+	var cInput *C.char
+	if input != "" {
+		cInput = C.CString(input)
+		defer C.free(unsafe.Pointer(cInput))
+	}
+	cSessions := make([]*C.struct_MNN_Session, len(sessions))
+	for i, s := range sessions {
+		if s.Interpreter.c != sessions[0].Interpreter.c {
+			return INVALID_VALUE
+		}
+		cSessions[i] = s.c
+	}
+	return ErrorCode(C.MNN_ResizeStrategy_prepareAll(sessions[0].Interpreter.c, &cSessions[0], C.int(len(cSessions)),
+		C.MNN_ResizeStrategy(strategy), cInput, cShapes, count))
+}
+
+// ResizeWith resizes the session after ResizeTensor the way the strategy does
+func (s *Session) ResizeWith(strategy ResizeStrategy) {
+	C.MNN_ResizeStrategy_resize(s.Interpreter.c, s.c, C.MNN_ResizeStrategy(strategy))
+}
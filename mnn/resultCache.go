@@ -0,0 +1,80 @@
+package mnn
+
+/*
+#include "ResultCache_c.h"
+*/
+import "C"
+
+// ResultCacheConfig sizes the cache; zero values pick 64MB, 16 shards and no expiry
+type ResultCacheConfig struct {
+	CapacityBytes uint64
+	Shards        int
+	TTLMs         uint32
+}
+
+// ResultCacheStats is a snapshot of the cache counters
+type ResultCacheStats struct {
+	Hits      uint64
+	Misses    uint64 // runs that executed runSession
+	Coalesced uint64 // runs that waited for a concurrent identical request
+	Evictions uint64
+	Expired   uint64
+	Bytes     uint64
+	Entries   uint64
+}
+
+// ResultCache skips runSession for inputs whose outputs are already known
+type ResultCache struct {
+	c *C.struct_MNN_ResultCache
+}
+
+// NewResultCache creates a cache
+func NewResultCache(config ResultCacheConfig) *ResultCache {
+	cConfig := C.MNN_ResultCacheConfig{
+		capacityBytes: C.size_t(config.CapacityBytes),
+		shards:        C.int(config.Shards),
+		ttlMs:         C.uint32_t(config.TTLMs),
+	}
+	return &ResultCache{c: C.MNN_ResultCache_create(&cConfig)}
+}
+
+// Close frees all cached results
+func (r *ResultCache) Close() {
+	if r != nil && r.c != nil {
+		C.MNN_ResultCache_destroy(r.c)
+		r.c = nil
+	}
+}
+
+// Run runs session through the cache; the session's outputs hold the result either way
+func (r *ResultCache) Run(session *Session) (hit bool, code ErrorCode) {
+	return r.RunSalted(session, 0)
+}
+
+// RunSalted is Run with salt in the key; give sessions whose outputs may differ for the same inputs
+// (precision, backend, ...) different salts
+func (r *ResultCache) RunSalted(session *Session, salt uint64) (hit bool, code ErrorCode) {
+	var cHit C.MNN_BOOL
+	code = ErrorCode(C.MNN_ResultCache_runSalted(r.c, session.Interpreter.c, session.c, C.uint64_t(salt), &cHit))
+	return B2Go(cHit), code
+}
+
+// Clear drops every cached result
+func (r *ResultCache) Clear() {
+	C.MNN_ResultCache_clear(r.c)
+}
+
+// Stats returns the current counters
+func (r *ResultCache) Stats() ResultCacheStats {
+	var cStats C.MNN_ResultCacheStats
+	C.MNN_ResultCache_getStats(r.c, &cStats)
+	return ResultCacheStats{
+		Hits:      uint64(cStats.hits),
+		Misses:    uint64(cStats.misses),
+		Coalesced: uint64(cStats.coalesced),
+		Evictions: uint64(cStats.evictions),
+		Expired:   uint64(cStats.expired),
+		Bytes:     uint64(cStats.bytes),
+		Entries:   uint64(cStats.entries),
+	}
+}
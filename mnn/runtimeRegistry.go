@@ -0,0 +1,123 @@
+package mnn
+
+/*
+#include <stdlib.h>
+#include "RuntimeRegistry_c.h"
+*/
+import "C"
+import (
+	"unsafe"
+)
+
+// RuntimeRegistry shares MNN runtimes (and their thread pools) between models under a global thread budget
+type RuntimeRegistry struct {
+	c *C.struct_MNN_RuntimeRegistry
+}
+
+// SharedRuntime is one reference to a named runtime of a RuntimeRegistry
+type SharedRuntime struct {
+	c        *C.struct_MNN_SharedRuntime
+	released bool
+}
+
+// RuntimeRegistryStats is a snapshot of a registry's budget usage
+type RuntimeRegistryStats struct {
+	ThreadBudget int
+	ThreadsInUse int
+	RuntimeCount int
+	References   int
+}
+
+// NewRuntimeRegistry creates a registry; threadBudget <= 0 uses the number of online cores
+func NewRuntimeRegistry(threadBudget int) *RuntimeRegistry {
+	return &RuntimeRegistry{c: C.MNN_RuntimeRegistry_create(C.int(threadBudget))}
+}
+
+// Close destroys the registry; SharedRuntimes already acquired stay valid until released
+func (r *RuntimeRegistry) Close() {
+	if r != nil && r.c != nil {
+		C.MNN_RuntimeRegistry_destroy(r.c)
+		r.c = nil
+	}
+}
+
+// Acquire returns the runtime registered under name, creating it from config on first use.
+// The first caller's config wins; a CPU runtime's thread count is clamped to the budget left,
+// and RESOURCE_EXHAUSTED is returned when no budget is left.
+func (r *RuntimeRegistry) Acquire(name string, config *ScheduleConfig) (*SharedRuntime, ErrorCode) {
+	if r == nil || r.c == nil || config == nil {
+		return nil, ErrorCode(C.MNN_INVALID_VALUE)
+	}
+	cName := C.CString(name)
+	defer C.free(unsafe.Pointer(cName))
+	cConfig := config.ToCScheduleConfig()
+	defer config.Unpin()
+	var code C.MNN_ErrorCode
+	cRuntime := C.MNN_RuntimeRegistry_acquire(r.c, cName, &cConfig, &code)
+	if cRuntime == nil {
+		return nil, ErrorCode(code)
+	}
+	return &SharedRuntime{c: cRuntime}, ErrorCode(code)
+}
+
+// Stats returns the current budget usage
+func (r *RuntimeRegistry) Stats() RuntimeRegistryStats {
+	var cStats C.MNN_RuntimeRegistryStats
+	if r == nil || r.c == nil {
+		return RuntimeRegistryStats{}
+	}
+	C.MNN_RuntimeRegistry_getStats(r.c, &cStats)
+	return RuntimeRegistryStats{
+		ThreadBudget: int(cStats.threadBudget),
+		ThreadsInUse: int(cStats.threadsInUse),
+		RuntimeCount: int(cStats.runtimeCount),
+		References:   int(cStats.references),
+	}
+}
+
+// Release drops this reference. The runtime and its budget are freed once the last reference is dropped and
+// the last session created through it is released (by ReleaseSession, Interpreter.ReleaseSession or with its
+// interpreter); ReleaseSession stays usable after Release.
+func (s *SharedRuntime) Release() {
+	if s != nil && s.c != nil && !s.released {
+		C.MNN_SharedRuntime_release(s.c)
+		s.released = true
+	}
+}
+
+// Name returns the registry name of the runtime
+func (s *SharedRuntime) Name() string {
+	return C.GoString(C.MNN_SharedRuntime_name(s.c))
+}
+
+// NumThread returns the thread count the runtime was created with
+func (s *SharedRuntime) NumThread() int {
+	return int(C.MNN_SharedRuntime_numThread(s.c))
+}
+
+// CreateSession creates a session of net on the shared runtime; config's type and thread count are replaced by the runtime's
+func (s *SharedRuntime) CreateSession(net *Interpreter, config *ScheduleConfig) *Session {
+	cConfig := config.ToCScheduleConfig()
+	defer config.Unpin()
+	cSession := C.MNN_SharedRuntime_createSession(s.c, net.c, &cConfig)
+	if cSession == nil {
+		return nil
+	}
+	return &Session{c: cSession, Interpreter: net}
+}
+
+// RunSession runs session; runs of all sessions on this runtime are serialized
+func (s *SharedRuntime) RunSession(session *Session) ErrorCode {
+	return ErrorCode(C.MNN_SharedRuntime_runSession(s.c, session.Interpreter.c, session.c))
+}
+
+// ResizeSession resizes session under the runtime's lock
+func (s *SharedRuntime) ResizeSession(session *Session) {
+	C.MNN_SharedRuntime_resizeSession(s.c, session.Interpreter.c, session.c)
+}
+
+// ReleaseSession releases session under the runtime's lock and returns its threads to the budget
+// when it was the runtime's last user
+func (s *SharedRuntime) ReleaseSession(session *Session) bool {
+	return B2Go(C.MNN_SharedRuntime_releaseSession(s.c, session.Interpreter.c, session.c))
+}
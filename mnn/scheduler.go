@@ -0,0 +1,137 @@
+package mnn
+
+/*
+#include "Scheduler_c.h"
+*/
+import "C"
+import "time"
+
+// SchedulerClass describes one priority class; class 0 is the highest
+type SchedulerClass struct {
+	Weight      float32 // share of session time relative to the other classes
+	Preemptible bool    // a running request may be preempted by class 0
+}
+
+// SchedulerConfig configures a Scheduler
+type SchedulerConfig struct {
+	Sessions     int
+	Classes      []SchedulerClass
+	ReservedHigh int  // sessions only class 0 may use
+	StrictHigh   bool // class 0 is always served before the other classes
+	Preempt      bool // class 0 preempts preemptible runs at op boundaries when no session is free
+}
+
+// SchedulerClassStats holds per-class statistics
+type SchedulerClassStats struct {
+	Granted   uint64
+	Preempted uint64
+	Timeouts  uint64
+	Waiting   int
+	Holding   int
+	MeanWait  time.Duration
+	MaxWait   time.Duration
+}
+
+// Scheduler shares a pool of sessions of one model between priority classes
+type Scheduler struct {
+	c    *C.struct_MNN_Scheduler
+	nets []*Interpreter // per session; all but the first are owned by the C scheduler, never closed here
+}
+
+// SchedulerLease is a session held by one request until Release
+type SchedulerLease struct {
+	c         *C.struct_MNN_SchedulerLease
+	scheduler *Scheduler
+}
+
+// NewScheduler creates cfg.Sessions sessions of net and a scheduler in front of them.
+// The first session uses net, the others own replicas of it so that leases run in parallel;
+// net's model must not be released.
+func NewScheduler(net *Interpreter, config *ScheduleConfig, cfg SchedulerConfig) *Scheduler {
+	if len(cfg.Classes) == 0 || len(cfg.Classes) > C.MNN_SCHEDULER_MAX_CLASSES {
+		return nil
+	}
+	cConfig := config.ToCScheduleConfig()
+	defer config.Unpin()
+	var cCfg C.MNN_SchedulerConfig
+	cCfg.sessions = C.int(cfg.Sessions)
+	cCfg.classCount = C.int(len(cfg.Classes))
+	for i, class := range cfg.Classes {
+		cCfg.classes[i].weight = C.float(class.Weight)
+		cCfg.classes[i].preemptible = B2C(class.Preemptible)
+	}
+	cCfg.reservedHigh = C.int(cfg.ReservedHigh)
+	cCfg.strictHigh = B2C(cfg.StrictHigh)
+	cCfg.preempt = B2C(cfg.Preempt)
+	c := C.MNN_Scheduler_create(net.c, &cConfig, &cCfg)
+	if c == nil {
+		return nil
+	}
+	scheduler := &Scheduler{c: c, nets: []*Interpreter{net}}
+	for i := 1; i < cfg.Sessions; i++ {
+		scheduler.nets = append(scheduler.nets, &Interpreter{c: C.MNN_Scheduler_interpreter(c, C.int(i))})
+	}
+	return scheduler
+}
+
+// Close releases the sessions; every lease must have been released
+func (s *Scheduler) Close() {
+	if s != nil && s.c != nil {
+		C.MNN_Scheduler_destroy(s.c)
+		s.c = nil
+	}
+}
+
+// Acquire waits for a session for the given class; timeout 0 waits forever
+func (s *Scheduler) Acquire(class int, timeout time.Duration) (*SchedulerLease, ErrorCode) {
+	var code C.MNN_ErrorCode
+	c := C.MNN_Scheduler_acquire(s.c, C.int(class), C.uint64_t(timeout/time.Microsecond), &code)
+	if c == nil {
+		return nil, ErrorCode(code)
+	}
+	return &SchedulerLease{c: c, scheduler: s}, NO_ERROR
+}
+
+// Stats returns per-class statistics
+func (s *Scheduler) Stats() []SchedulerClassStats {
+	var cStats [C.MNN_SCHEDULER_MAX_CLASSES]C.MNN_SchedulerClassStats
+	n := int(C.MNN_Scheduler_getStats(s.c, &cStats[0], C.MNN_SCHEDULER_MAX_CLASSES))
+	stats := make([]SchedulerClassStats, n)
+	for i := range stats {
+		stats[i] = SchedulerClassStats{
+			Granted:   uint64(cStats[i].granted),
+			Preempted: uint64(cStats[i].preempted),
+			Timeouts:  uint64(cStats[i].timeouts),
+			Waiting:   int(cStats[i].waiting),
+			Holding:   int(cStats[i].holding),
+			MeanWait:  time.Duration(float64(cStats[i].meanWaitMs) * float64(time.Millisecond)),
+			MaxWait:   time.Duration(float64(cStats[i].maxWaitMs) * float64(time.Millisecond)),
+		}
+	}
+	return stats
+}
+
+// Session returns the leased session; fetch it again after Run, since preemption may move the lease
+func (l *SchedulerLease) Session() *Session {
+	cNet := C.MNN_SchedulerLease_interpreter(l.c)
+	net := l.scheduler.nets[0]
+	for _, item := range l.scheduler.nets {
+		if item.c == cNet {
+			net = item
+		}
+	}
+	return &Session{c: C.MNN_SchedulerLease_session(l.c), Interpreter: net}
+}
+
+// Run runs the leased session, restarting it on another session if it was preempted
+func (l *SchedulerLease) Run() ErrorCode {
+	return ErrorCode(C.MNN_SchedulerLease_run(l.c))
+}
+
+// Release returns the session to the scheduler
+func (l *SchedulerLease) Release() {
+	if l != nil && l.c != nil {
+		C.MNN_SchedulerLease_release(l.c)
+		l.c = nil
+	}
+}
@@ -0,0 +1,88 @@
+package mnn
+
+/*
+#include <stdlib.h>
+#include "Tap_c.h"
+*/
+import "C"
+import (
+	"runtime"
+	"unsafe"
+)
+
+// Tap copies the output of an op into Buffer as soon as the op finishes.
+// Buffer receives the tensor's raw elements; use a float32 buffer for float tensors.
+type Tap struct {
+	Op          string
+	OutputIndex int
+	Buffer      []float32
+}
+
+// TapResult describes what a tap captured in the last run
+type TapResult struct {
+	Captured  bool
+	Truncated bool // the tensor did not fit into Buffer
+	Size      int  // tensor size in bytes
+	Dims      []int
+}
+
+// TapSet is a set of taps; it must not be used by two runs at the same time
+type TapSet struct {
+	c      *C.struct_MNN_TapSet
+	pinner runtime.Pinner
+}
+
+// NewTapSet registers taps; the buffers stay pinned until Close
+func NewTapSet(taps []Tap) *TapSet {
+	if len(taps) == 0 {
+		return nil
+	}
+	set := &TapSet{}
+	cTaps := make([]C.MNN_Tap, len(taps))
+	for i, tap := range taps {
+		cTaps[i].op = C.CString(tap.Op)
+		defer C.free(unsafe.Pointer(cTaps[i].op))
+		cTaps[i].outputIndex = C.int(tap.OutputIndex)
+		if len(tap.Buffer) > 0 {
+			set.pinner.Pin(&tap.Buffer[0])
+			cTaps[i].buffer = unsafe.Pointer(&tap.Buffer[0])
+			cTaps[i].capacity = C.size_t(len(tap.Buffer) * 4)
+		}
+	}
+	set.c = C.MNN_TapSet_create(&cTaps[0], C.int(len(cTaps)))
+	if set.c == nil {
+		set.pinner.Unpin()
+		return nil
+	}
+	return set
+}
+
+// Close frees the tap set and unpins the buffers
+func (t *TapSet) Close() {
+	if t != nil && t.c != nil {
+		C.MNN_TapSet_destroy(t.c)
+		t.c = nil
+		t.pinner.Unpin()
+	}
+}
+
+// Run runs session to completion, filling every tap's buffer
+func (t *TapSet) Run(session *Session) ErrorCode {
+	return ErrorCode(C.MNN_TapSet_run(t.c, session.Interpreter.c, session.c))
+}
+
+// Result returns what tap index captured in the last run
+func (t *TapSet) Result(index int) TapResult {
+	var cResult C.MNN_TapResult
+	C.MNN_TapSet_result(t.c, C.int(index), &cResult)
+	dims := make([]int, int(cResult.dimCount))
+	for i := range dims {
+		dims[i] = int(cResult.dims[i])
+	}
+	return TapResult{
+		Captured:  B2Go(cResult.captured),
+		Truncated: B2Go(cResult.truncated),
+		Size:      int(cResult.size),
+		Dims:      dims,
+	}
+}
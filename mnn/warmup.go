@@ -0,0 +1,115 @@
+package mnn
+
+/*
+#include <stdlib.h>
+#include "Warmup_c.h"
+*/
+import "C"
+import (
+	"runtime"
+	"unsafe"
+)
+
+// WarmupShape is the shape of one input; an empty Input means the default input
+type WarmupShape struct {
+	Input string
+	Dims  []int
+}
+
+// WarmupBucket is a set of input shapes applied together; an empty bucket keeps the current shapes
+type WarmupBucket []WarmupShape
+
+// WarmupConfig controls how long each bucket is run
+type WarmupConfig struct {
+	MinRuns     int     // runs per bucket including the first, at least 2
+	MaxRuns     int     // upper bound while latency is not yet stable
+	Tolerance   float32 // two consecutive runs within this ratio count as stable
+	UpdateCache bool    // call UpdateCacheFile after all buckets
+}
+
+// WarmupResult reports the warm latency of one bucket
+type WarmupResult struct {
+	Code      ErrorCode
+	Runs      int
+	FirstMs   float64 // first run after resize, including tuning
+	SteadyMs  float64 // median of the following runs
+	MinMs     float64
+	LastMs    float64
+	Converged bool
+}
+
+// NewWarmupConfig returns the default warmup config
+func NewWarmupConfig() *WarmupConfig {
+	return &WarmupConfig{MinRuns: 3, MaxRuns: 20, Tolerance: 0.1, UpdateCache: true}
+}
+
+// Warmup resizes session to every bucket, runs it on synthetic inputs until latency is stable and
+// persists the tuning cache; config may be nil for the defaults. The session is left at the last bucket's shapes.
+func (s *Session) Warmup(buckets []WarmupBucket, config *WarmupConfig) ([]WarmupResult, ErrorCode) {
+	var pinner runtime.Pinner
+	defer pinner.Unpin()
+	var toFree []*C.char
+	defer func() {
+		for _, name := range toFree {
+			C.free(unsafe.Pointer(name))
+		}
+	}()
+
+	cBuckets := make([]C.MNN_WarmupBucket, len(buckets))
+	for i, bucket := range buckets {
+		if len(bucket) == 0 {
+			continue
+		}
+		cShapes := make([]C.MNN_WarmupShape, len(bucket))
+		for j, shape := range bucket {
+			if shape.Input != "" {
+				cShapes[j].input = C.CString(shape.Input)
+				toFree = append(toFree, cShapes[j].input)
+			}
+			if len(shape.Dims) > 0 {
+				dims := make([]C.int, len(shape.Dims))
+				for k, dim := range shape.Dims {
+					dims[k] = C.int(dim)
+				}
+				pinner.Pin(&dims[0])
+				cShapes[j].dims = &dims[0]
+				cShapes[j].dimCount = C.int(len(dims))
+			}
+		}
+		pinner.Pin(&cShapes[0])
+		cBuckets[i].shapes = &cShapes[0]
+		cBuckets[i].shapeCount = C.int(len(cShapes))
+	}
+
+	var cConfig *C.MNN_WarmupConfig
+	if config != nil {
+		cConfig = &C.MNN_WarmupConfig{
+			minRuns:     C.int(config.MinRuns),
+			maxRuns:     C.int(config.MaxRuns),
+			tolerance:   C.float(config.Tolerance),
+			updateCache: B2C(config.UpdateCache),
+		}
+	}
+	var bucketsPtr *C.MNN_WarmupBucket
+	var resultsPtr *C.MNN_WarmupResult
+	cResults := make([]C.MNN_WarmupResult, len(buckets))
+	if len(buckets) > 0 {
+		bucketsPtr = &cBuckets[0]
+		resultsPtr = &cResults[0]
+	}
+	code := C.MNN_Warmup_run(s.Interpreter.c, s.c, bucketsPtr, C.int(len(buckets)), cConfig, resultsPtr)
+
+	results := make([]WarmupResult, len(buckets))
+	for i, r := range cResults {
+		results[i] = WarmupResult{
+			Code:      ErrorCode(r.code),
+			Runs:      int(r.runs),
+			FirstMs:   float64(r.firstMs),
+			SteadyMs:  float64(r.steadyMs),
+			MinMs:     float64(r.minMs),
+			LastMs:    float64(r.lastMs),
+			Converged: B2Go(r.converged),
+		}
+	}
+	return results, ErrorCode(code)
+}